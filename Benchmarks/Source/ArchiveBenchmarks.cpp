@@ -0,0 +1,126 @@
+#include "Benchmarks.h"
+
+#include "Archive/7Zip/SevenZipArchive.h"
+#include "Archive/Tar/TarArchive.h"
+#include "Archive/Tar/TarGZipArchive.h"
+#include "Archive/Zip/ZipArchive.h"
+#include "BenchmarkFixtures.h"
+#include "BenchmarkSuite.h"
+#include "ByteBuffer.h"
+#include "Utilities/FileUtilities.h"
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+
+static constexpr size_t NUMBER_OF_ARCHIVE_ENTRIES = 512;
+static constexpr size_t ARCHIVE_ENTRY_SIZE = 32 * 1024;
+static constexpr size_t TAR_BLOCK_SIZE = 512;
+
+static bool removeDirectory(const std::string & directoryPath) {
+	std::error_code errorCode;
+	std::filesystem::remove_all(std::filesystem::u8path(directoryPath), errorCode);
+
+	if(errorCode) {
+		spdlog::error("Failed to remove benchmark output directory '{}': {}", directoryPath, errorCode.message());
+		return false;
+	}
+
+	return true;
+}
+
+static void runExtractionBenchmark(BenchmarkSuite & suite, const std::string & group, const std::string & archiveTypeName, Archive * archive, const std::string & outputDirectoryPath) {
+	if(archive == nullptr) {
+		suite.skip(group, "extractAllEntries" + archiveTypeName, "failed to open archive");
+		suite.skip(group, "extractAllEntriesParallel" + archiveTypeName, "failed to open archive");
+		return;
+	}
+
+	size_t numberOfFiles = archive->numberOfFiles();
+
+	suite.run(group, "extractAllEntries" + archiveTypeName, archive->getUncompressedSize(), [archive, &outputDirectoryPath, numberOfFiles]() {
+		return archive->extractAllEntries(outputDirectoryPath, true, true) >= numberOfFiles;
+	}, [&outputDirectoryPath]() {
+		return removeDirectory(outputDirectoryPath);
+	});
+
+	suite.run(group, "extractAllEntriesParallel" + archiveTypeName, archive->getUncompressedSize(), [archive, &outputDirectoryPath]() {
+		for(const Archive::ExtractionResult & extractionResult : archive->extractAllEntriesParallel(outputDirectoryPath, true, true)) {
+			if(extractionResult.status != Archive::ExtractionStatus::Extracted) {
+				return false;
+			}
+		}
+
+		return true;
+	}, [&outputDirectoryPath]() {
+		return removeDirectory(outputDirectoryPath);
+	});
+
+	removeDirectory(outputDirectoryPath);
+}
+
+void Benchmarks::runArchiveBenchmarks(BenchmarkSuite & suite, const std::string & workingDirectoryPath, const std::string & sevenZipArchiveFilePath) {
+	static const std::string GROUP("Archive");
+
+	if(!suite.isGroupEnabled(GROUP)) {
+		return;
+	}
+
+	std::string outputDirectoryPath(Utilities::joinPaths(workingDirectoryPath, "Extracted"));
+	std::string zipArchiveFilePath(Utilities::joinPaths(workingDirectoryPath, "fixture.zip"));
+	std::string tarGZipArchiveFilePath(Utilities::joinPaths(workingDirectoryPath, "fixture.tar.gz"));
+	std::string truncatedTarArchiveFilePath(Utilities::joinPaths(workingDirectoryPath, "truncated.tar"));
+
+	std::unique_ptr<ByteBuffer> tarData(BenchmarkFixtures::createTarData(NUMBER_OF_ARCHIVE_ENTRIES, ARCHIVE_ENTRY_SIZE, suite.getSeed()));
+
+	if(tarData != nullptr) {
+		suite.run(GROUP, "parseTar", tarData->getSize(), [&tarData]() {
+			return TarArchive::createFrom(std::make_unique<ByteBuffer>(*tarData)) != nullptr;
+		});
+	}
+	else {
+		suite.skip(GROUP, "parseTar", "failed to create tar fixture");
+	}
+
+	// cuts off the end of archive marker and part of the last entry's data, which must be rejected rather than read as a shorter archive
+	if(tarData != nullptr && ByteBuffer(tarData->getRawData(), tarData->getSize() - (TAR_BLOCK_SIZE * 2) - (ARCHIVE_ENTRY_SIZE / 2)).writeTo(truncatedTarArchiveFilePath, true)) {
+		suite.run(GROUP, "rejectTruncatedTar", tarData->getSize(), [&truncatedTarArchiveFilePath]() {
+			return TarArchive::readFrom(truncatedTarArchiveFilePath) == nullptr;
+		});
+	}
+	else {
+		suite.skip(GROUP, "rejectTruncatedTar", "failed to create truncated tar fixture");
+	}
+
+	if(BenchmarkFixtures::createZipArchive(zipArchiveFilePath, NUMBER_OF_ARCHIVE_ENTRIES, ARCHIVE_ENTRY_SIZE, suite.getSeed())) {
+		std::unique_ptr<ZipArchive> zipArchive(ZipArchive::readFrom(zipArchiveFilePath));
+
+		runExtractionBenchmark(suite, GROUP, "Zip", zipArchive.get(), outputDirectoryPath);
+	}
+	else {
+		suite.skip(GROUP, "extractAllEntriesZip", "failed to create zip fixture");
+	}
+
+	if(BenchmarkFixtures::createTarGZipArchive(tarGZipArchiveFilePath, NUMBER_OF_ARCHIVE_ENTRIES, ARCHIVE_ENTRY_SIZE, suite.getSeed())) {
+		suite.run(GROUP, "readTarGZip", NUMBER_OF_ARCHIVE_ENTRIES * ARCHIVE_ENTRY_SIZE, [&tarGZipArchiveFilePath]() {
+			return TarGZipArchive::readFrom(tarGZipArchiveFilePath) != nullptr;
+		});
+
+		std::unique_ptr<TarGZipArchive> tarGZipArchive(TarGZipArchive::readFrom(tarGZipArchiveFilePath));
+
+		runExtractionBenchmark(suite, GROUP, "TarGZip", tarGZipArchive.get(), outputDirectoryPath);
+	}
+	else {
+		suite.skip(GROUP, "extractAllEntriesTarGZip", "failed to create tar gzip fixture");
+	}
+
+	if(sevenZipArchiveFilePath.empty()) {
+		// there is no 7-Zip writer available, so this benchmark relies on an externally supplied fixture
+		suite.skip(GROUP, "extractAllEntriesSevenZip", "no 7-Zip fixture specified");
+	}
+	else {
+		std::unique_ptr<SevenZipArchive> sevenZipArchive(SevenZipArchive::readFrom(sevenZipArchiveFilePath));
+
+		runExtractionBenchmark(suite, GROUP, "SevenZip", sevenZipArchive.get(), outputDirectoryPath);
+	}
+}
@@ -0,0 +1,159 @@
+#include "BenchmarkFixtures.h"
+
+#include "Archive/Zip/ZipArchive.h"
+#include "ByteBuffer.h"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <limits>
+#include <random>
+#include <string_view>
+
+static constexpr size_t TAR_BLOCK_SIZE = 512;
+
+static constexpr std::array<std::string_view, 16> WORDS = {
+	"archive", "buffer", "compression", "directory", "entry", "file", "group", "header",
+	"index", "level", "method", "offset", "request", "response", "stream", "transfer"
+};
+
+static bool writeTarOctalNumber(ByteBuffer & data, uint64_t value, size_t fieldSize) {
+	return data.writeFixedLengthString(fmt::format("{:0{}o}", value, fieldSize - 1), fieldSize);
+}
+
+std::unique_ptr<ByteBuffer> BenchmarkFixtures::generateRandomData(size_t size, uint32_t seed) {
+	std::mt19937 randomGenerator(seed);
+	std::uniform_int_distribution<uint32_t> byteDistribution(0, std::numeric_limits<uint8_t>::max());
+
+	std::unique_ptr<ByteBuffer> data(std::make_unique<ByteBuffer>(size));
+	uint8_t * rawData = data->getRawData();
+
+	for(size_t i = 0; i < size; i++) {
+		rawData[i] = static_cast<uint8_t>(byteDistribution(randomGenerator));
+	}
+
+	return data;
+}
+
+std::unique_ptr<ByteBuffer> BenchmarkFixtures::generateTextData(size_t size, uint32_t seed) {
+	std::mt19937 randomGenerator(seed);
+	std::uniform_int_distribution<size_t> wordDistribution(0, WORDS.size() - 1);
+	std::uniform_int_distribution<uint32_t> lineLengthDistribution(4, 16);
+
+	std::string text;
+	text.reserve(size + 32);
+
+	while(text.size() < size) {
+		uint32_t lineLength = lineLengthDistribution(randomGenerator);
+
+		for(uint32_t i = 0; i < lineLength; i++) {
+			if(i != 0) {
+				text.push_back(' ');
+			}
+
+			text.append(WORDS[wordDistribution(randomGenerator)]);
+		}
+
+		text.push_back('\n');
+	}
+
+	text.resize(size);
+
+	return std::make_unique<ByteBuffer>(text);
+}
+
+std::string BenchmarkFixtures::getEntryPath(size_t entryIndex) {
+	return fmt::format("directory{}/file{}.txt", entryIndex % 8, entryIndex);
+}
+
+std::unique_ptr<ByteBuffer> BenchmarkFixtures::createTarData(size_t numberOfEntries, size_t entrySize, uint32_t seed) {
+	static constexpr size_t CHECKSUM_OFFSET = 148;
+
+	std::unique_ptr<ByteBuffer> tarData(std::make_unique<ByteBuffer>());
+	tarData->reserve((numberOfEntries * (((entrySize + TAR_BLOCK_SIZE - 1) / TAR_BLOCK_SIZE) + 1) + 2) * TAR_BLOCK_SIZE);
+
+	for(size_t i = 0; i < numberOfEntries; i++) {
+		size_t headerOffset = tarData->getWriteOffset();
+		std::unique_ptr<ByteBuffer> entryData(generateTextData(entrySize, seed + static_cast<uint32_t>(i)));
+
+		if(!tarData->writeFixedLengthString(getEntryPath(i), 100) ||
+		   !writeTarOctalNumber(*tarData, 0644, 8) ||
+		   !writeTarOctalNumber(*tarData, 0, 8) ||
+		   !writeTarOctalNumber(*tarData, 0, 8) ||
+		   !writeTarOctalNumber(*tarData, entrySize, 12) ||
+		   !writeTarOctalNumber(*tarData, 0, 12) ||
+		   !tarData->writeFillByte(8, ' ') ||
+		   !tarData->writeUnsignedByte('0') ||
+		   !tarData->writeFillByte(100) ||
+		   !tarData->writeFixedLengthString("ustar", 6) ||
+		   !tarData->writeString("00") ||
+		   !tarData->writeFillByte(TAR_BLOCK_SIZE - 265)) {
+			spdlog::error("Failed to write tar entry #{} header.", i + 1);
+			return nullptr;
+		}
+
+		uint32_t checksum = 0;
+
+		for(size_t j = 0; j < TAR_BLOCK_SIZE; j++) {
+			checksum += (*tarData)[headerOffset + j];
+		}
+
+		tarData->setWriteOffset(headerOffset + CHECKSUM_OFFSET);
+
+		if(!tarData->writeFixedLengthString(fmt::format("{:06o}", checksum), 7)) {
+			return nullptr;
+		}
+
+		tarData->setWriteOffset(headerOffset + TAR_BLOCK_SIZE);
+
+		if(!tarData->writeBytes(*entryData)) {
+			return nullptr;
+		}
+
+		if(entrySize % TAR_BLOCK_SIZE != 0 && !tarData->writeFillByte(TAR_BLOCK_SIZE - (entrySize % TAR_BLOCK_SIZE))) {
+			return nullptr;
+		}
+	}
+
+	if(!tarData->writeFillByte(TAR_BLOCK_SIZE * 2)) {
+		return nullptr;
+	}
+
+	return tarData;
+}
+
+bool BenchmarkFixtures::createTarGZipArchive(const std::string & filePath, size_t numberOfEntries, size_t entrySize, uint32_t seed) {
+	std::unique_ptr<ByteBuffer> tarData(createTarData(numberOfEntries, entrySize, seed));
+
+	if(tarData == nullptr) {
+		return false;
+	}
+
+	std::unique_ptr<ByteBuffer> compressedTarData(tarData->compressed(ByteBuffer::CompressionMethod::ZLib));
+
+	if(compressedTarData == nullptr) {
+		spdlog::error("Failed to compress tar benchmark fixture data.");
+		return false;
+	}
+
+	return compressedTarData->writeTo(filePath, true);
+}
+
+bool BenchmarkFixtures::createZipArchive(const std::string & filePath, size_t numberOfEntries, size_t entrySize, uint32_t seed) {
+	std::unique_ptr<ZipArchive> zipArchive(ZipArchive::createNew(filePath, true));
+
+	if(zipArchive == nullptr) {
+		spdlog::error("Failed to create zip benchmark fixture: '{}'.", filePath);
+		return false;
+	}
+
+	for(size_t i = 0; i < numberOfEntries; i++) {
+		if(zipArchive->addData(generateTextData(entrySize, seed + static_cast<uint32_t>(i)), getEntryPath(i)) == nullptr) {
+			spdlog::error("Failed to add entry #{} to zip benchmark fixture.", i + 1);
+			return false;
+		}
+	}
+
+	return zipArchive->save();
+}
@@ -0,0 +1,21 @@
+#ifndef _BENCHMARK_FIXTURES_H_
+#define _BENCHMARK_FIXTURES_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class ByteBuffer;
+
+namespace BenchmarkFixtures {
+
+	std::unique_ptr<ByteBuffer> generateRandomData(size_t size, uint32_t seed);
+	std::unique_ptr<ByteBuffer> generateTextData(size_t size, uint32_t seed);
+	std::unique_ptr<ByteBuffer> createTarData(size_t numberOfEntries, size_t entrySize, uint32_t seed);
+	bool createTarGZipArchive(const std::string & filePath, size_t numberOfEntries, size_t entrySize, uint32_t seed);
+	bool createZipArchive(const std::string & filePath, size_t numberOfEntries, size_t entrySize, uint32_t seed);
+	std::string getEntryPath(size_t entryIndex);
+
+}
+
+#endif // _BENCHMARK_FIXTURES_H_
@@ -0,0 +1,267 @@
+#include "BenchmarkSuite.h"
+
+#include "Core.h"
+#include "Utilities/StringUtilities.h"
+#include "Utilities/TimeUtilities.h"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+const size_t BenchmarkSuite::DEFAULT_NUMBER_OF_ITERATIONS = 10;
+const size_t BenchmarkSuite::DEFAULT_NUMBER_OF_WARMUP_ITERATIONS = 2;
+const uint32_t BenchmarkSuite::DEFAULT_SEED = 1337;
+
+BenchmarkSuite::BenchmarkSuite(size_t numberOfIterations, size_t numberOfWarmupIterations, uint32_t seed)
+	: m_numberOfIterations(std::max(numberOfIterations, static_cast<size_t>(1)))
+	, m_numberOfWarmupIterations(numberOfWarmupIterations)
+	, m_seed(seed) { }
+
+BenchmarkSuite::~BenchmarkSuite() { }
+
+double BenchmarkSuite::Result::getBytesPerSecond() const {
+	if(numberOfBytesPerIteration == 0 || medianDuration.count() <= 0) {
+		return 0.0;
+	}
+
+	return static_cast<double>(numberOfBytesPerIteration) / std::chrono::duration<double>(medianDuration).count();
+}
+
+size_t BenchmarkSuite::getNumberOfIterations() const {
+	return m_numberOfIterations;
+}
+
+size_t BenchmarkSuite::getNumberOfWarmupIterations() const {
+	return m_numberOfWarmupIterations;
+}
+
+uint32_t BenchmarkSuite::getSeed() const {
+	return m_seed;
+}
+
+bool BenchmarkSuite::hasFilter() const {
+	return !m_filter.empty();
+}
+
+const std::string & BenchmarkSuite::getFilter() const {
+	return m_filter;
+}
+
+void BenchmarkSuite::setFilter(const std::string & filter) {
+	m_filter = filter;
+}
+
+void BenchmarkSuite::clearFilter() {
+	m_filter.clear();
+}
+
+bool BenchmarkSuite::isEnabled(const std::string & group, const std::string & name) const {
+	return m_filter.empty() ||
+		   Utilities::contains(fmt::format("{}/{}", group, name), m_filter, false);
+}
+
+bool BenchmarkSuite::isGroupEnabled(const std::string & group) const {
+	if(m_filter.empty()) {
+		return true;
+	}
+
+	size_t separatorIndex = m_filter.find('/');
+
+	if(separatorIndex == std::string::npos) {
+		// the filter may match either a group or a benchmark name, so any group could contain a match
+		return true;
+	}
+
+	return Utilities::contains(group, std::string_view(m_filter.data(), separatorIndex), false);
+}
+
+bool BenchmarkSuite::run(const std::string & group, const std::string & name, uint64_t numberOfBytesPerIteration, std::function<bool()> function, std::function<bool()> setupFunction) {
+	if(!isEnabled(group, name)) {
+		return true;
+	}
+
+	Result result;
+	result.group = group;
+	result.name = name;
+	result.numberOfBytesPerIteration = numberOfBytesPerIteration;
+
+	if(function == nullptr) {
+		spdlog::error("Benchmark '{}/{}' has no function to run.", group, name);
+
+		m_results.push_back(result);
+
+		return false;
+	}
+
+	spdlog::info("Running benchmark '{}/{}'...", group, name);
+
+	std::vector<std::chrono::nanoseconds> durations;
+	durations.reserve(m_numberOfIterations);
+
+	for(size_t i = 0; i < m_numberOfWarmupIterations + m_numberOfIterations; i++) {
+		if(setupFunction != nullptr && !setupFunction()) {
+			spdlog::error("Failed to set up iteration #{} of benchmark '{}/{}'.", i + 1, group, name);
+
+			m_results.push_back(result);
+
+			return false;
+		}
+
+		std::chrono::time_point<std::chrono::steady_clock> startTimePoint(std::chrono::steady_clock::now());
+
+		bool success = function();
+
+		std::chrono::nanoseconds duration(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTimePoint));
+
+		if(!success) {
+			spdlog::error("Iteration #{} of benchmark '{}/{}' failed.", i + 1, group, name);
+
+			m_results.push_back(result);
+
+			return false;
+		}
+
+		if(i >= m_numberOfWarmupIterations) {
+			durations.push_back(duration);
+		}
+	}
+
+	std::sort(durations.begin(), durations.end());
+
+	std::chrono::nanoseconds totalDuration(0);
+
+	for(const std::chrono::nanoseconds & duration : durations) {
+		totalDuration += duration;
+	}
+
+	result.success = true;
+	result.numberOfIterations = durations.size();
+	result.minimumDuration = durations.front();
+	result.maximumDuration = durations.back();
+	result.meanDuration = totalDuration / static_cast<int64_t>(durations.size());
+
+	if(durations.size() % 2 == 0) {
+		result.medianDuration = (durations[durations.size() / 2 - 1] + durations[durations.size() / 2]) / 2;
+	}
+	else {
+		result.medianDuration = durations[durations.size() / 2];
+	}
+
+	double variance = 0.0;
+
+	for(const std::chrono::nanoseconds & duration : durations) {
+		double difference = static_cast<double>(duration.count() - result.meanDuration.count());
+		variance += difference * difference;
+	}
+
+	result.standardDeviation = std::chrono::nanoseconds(static_cast<int64_t>(std::sqrt(variance / static_cast<double>(durations.size()))));
+
+	spdlog::info("Benchmark '{}/{}' median: {} ns{}", group, name, result.medianDuration.count(), numberOfBytesPerIteration == 0 ? "" : fmt::format(" ({:.2f} MiB/s)", result.getBytesPerSecond() / (1024.0 * 1024.0)));
+
+	m_results.push_back(result);
+
+	return true;
+}
+
+void BenchmarkSuite::skip(const std::string & group, const std::string & name, const std::string & reason) {
+	if(!isEnabled(group, name)) {
+		return;
+	}
+
+	spdlog::warn("Skipping benchmark '{}/{}': {}", group, name, reason);
+
+	m_skipped.emplace_back(fmt::format("{}/{}", group, name), reason);
+}
+
+size_t BenchmarkSuite::numberOfResults() const {
+	return m_results.size();
+}
+
+size_t BenchmarkSuite::numberOfFailures() const {
+	return std::count_if(m_results.cbegin(), m_results.cend(), [](const Result & result) {
+		return !result.success;
+	});
+}
+
+const std::vector<BenchmarkSuite::Result> & BenchmarkSuite::getResults() const {
+	return m_results;
+}
+
+rapidjson::Document BenchmarkSuite::toJSON() const {
+	rapidjson::Document benchmarksDocument(rapidjson::kObjectType);
+	rapidjson::Document::AllocatorType & allocator = benchmarksDocument.GetAllocator();
+
+	rapidjson::Value coreValue(rapidjson::kObjectType);
+	coreValue.AddMember(rapidjson::StringRef("version"), rapidjson::Value(CORE_VERSION.c_str(), allocator), allocator);
+	coreValue.AddMember(rapidjson::StringRef("commitHash"), rapidjson::Value(CORE_COMMIT_HASH.c_str(), allocator), allocator);
+	benchmarksDocument.AddMember(rapidjson::StringRef("core"), coreValue, allocator);
+
+	std::string timestamp(Utilities::timePointToString(std::chrono::system_clock::now(), Utilities::TimeFormat::ISO8601));
+	benchmarksDocument.AddMember(rapidjson::StringRef("timestamp"), rapidjson::Value(timestamp.c_str(), allocator), allocator);
+
+	rapidjson::Value configurationValue(rapidjson::kObjectType);
+	configurationValue.AddMember(rapidjson::StringRef("iterations"), rapidjson::Value(static_cast<uint64_t>(m_numberOfIterations)), allocator);
+	configurationValue.AddMember(rapidjson::StringRef("warmupIterations"), rapidjson::Value(static_cast<uint64_t>(m_numberOfWarmupIterations)), allocator);
+	configurationValue.AddMember(rapidjson::StringRef("seed"), rapidjson::Value(m_seed), allocator);
+	configurationValue.AddMember(rapidjson::StringRef("filter"), rapidjson::Value(m_filter.c_str(), allocator), allocator);
+	benchmarksDocument.AddMember(rapidjson::StringRef("configuration"), configurationValue, allocator);
+
+	rapidjson::Value resultsValue(rapidjson::kArrayType);
+
+	for(const Result & result : m_results) {
+		rapidjson::Value resultValue(rapidjson::kObjectType);
+		resultValue.AddMember(rapidjson::StringRef("group"), rapidjson::Value(result.group.c_str(), allocator), allocator);
+		resultValue.AddMember(rapidjson::StringRef("name"), rapidjson::Value(result.name.c_str(), allocator), allocator);
+		resultValue.AddMember(rapidjson::StringRef("success"), rapidjson::Value(result.success), allocator);
+		resultValue.AddMember(rapidjson::StringRef("iterations"), rapidjson::Value(static_cast<uint64_t>(result.numberOfIterations)), allocator);
+		resultValue.AddMember(rapidjson::StringRef("bytesPerIteration"), rapidjson::Value(result.numberOfBytesPerIteration), allocator);
+		resultValue.AddMember(rapidjson::StringRef("minimumNanoseconds"), rapidjson::Value(static_cast<int64_t>(result.minimumDuration.count())), allocator);
+		resultValue.AddMember(rapidjson::StringRef("maximumNanoseconds"), rapidjson::Value(static_cast<int64_t>(result.maximumDuration.count())), allocator);
+		resultValue.AddMember(rapidjson::StringRef("meanNanoseconds"), rapidjson::Value(static_cast<int64_t>(result.meanDuration.count())), allocator);
+		resultValue.AddMember(rapidjson::StringRef("medianNanoseconds"), rapidjson::Value(static_cast<int64_t>(result.medianDuration.count())), allocator);
+		resultValue.AddMember(rapidjson::StringRef("standardDeviationNanoseconds"), rapidjson::Value(static_cast<int64_t>(result.standardDeviation.count())), allocator);
+		resultValue.AddMember(rapidjson::StringRef("bytesPerSecond"), rapidjson::Value(result.getBytesPerSecond()), allocator);
+		resultsValue.PushBack(resultValue, allocator);
+	}
+
+	benchmarksDocument.AddMember(rapidjson::StringRef("results"), resultsValue, allocator);
+
+	rapidjson::Value skippedValue(rapidjson::kArrayType);
+
+	for(const std::pair<std::string, std::string> & skipped : m_skipped) {
+		rapidjson::Value skippedEntryValue(rapidjson::kObjectType);
+		skippedEntryValue.AddMember(rapidjson::StringRef("benchmark"), rapidjson::Value(skipped.first.c_str(), allocator), allocator);
+		skippedEntryValue.AddMember(rapidjson::StringRef("reason"), rapidjson::Value(skipped.second.c_str(), allocator), allocator);
+		skippedValue.PushBack(skippedEntryValue, allocator);
+	}
+
+	benchmarksDocument.AddMember(rapidjson::StringRef("skipped"), skippedValue, allocator);
+
+	return benchmarksDocument;
+}
+
+std::string BenchmarkSuite::toSummaryString() const {
+	std::stringstream summaryStream;
+
+	for(const Result & result : m_results) {
+		summaryStream << fmt::format("{:<12} {:<40} ", result.group, result.name);
+
+		if(!result.success) {
+			summaryStream << "FAILED\n";
+			continue;
+		}
+
+		summaryStream << fmt::format("median {:>12} ns  min {:>12} ns  max {:>12} ns", result.medianDuration.count(), result.minimumDuration.count(), result.maximumDuration.count());
+
+		if(result.numberOfBytesPerIteration != 0) {
+			summaryStream << fmt::format("  {:>10.2f} MiB/s", result.getBytesPerSecond() / (1024.0 * 1024.0));
+		}
+
+		summaryStream << '\n';
+	}
+
+	return summaryStream.str();
+}
@@ -0,0 +1,65 @@
+#ifndef _BENCHMARK_SUITE_H_
+#define _BENCHMARK_SUITE_H_
+
+#include <rapidjson/document.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class BenchmarkSuite final {
+public:
+	struct Result final {
+		std::string group;
+		std::string name;
+		bool success = false;
+		size_t numberOfIterations = 0;
+		uint64_t numberOfBytesPerIteration = 0;
+		std::chrono::nanoseconds minimumDuration = {};
+		std::chrono::nanoseconds maximumDuration = {};
+		std::chrono::nanoseconds meanDuration = {};
+		std::chrono::nanoseconds medianDuration = {};
+		std::chrono::nanoseconds standardDeviation = {};
+
+		double getBytesPerSecond() const;
+	};
+
+	BenchmarkSuite(size_t numberOfIterations = DEFAULT_NUMBER_OF_ITERATIONS, size_t numberOfWarmupIterations = DEFAULT_NUMBER_OF_WARMUP_ITERATIONS, uint32_t seed = DEFAULT_SEED);
+	~BenchmarkSuite();
+
+	size_t getNumberOfIterations() const;
+	size_t getNumberOfWarmupIterations() const;
+	uint32_t getSeed() const;
+	bool hasFilter() const;
+	const std::string & getFilter() const;
+	void setFilter(const std::string & filter);
+	void clearFilter();
+	bool isEnabled(const std::string & group, const std::string & name) const;
+	bool isGroupEnabled(const std::string & group) const;
+	bool run(const std::string & group, const std::string & name, uint64_t numberOfBytesPerIteration, std::function<bool()> function, std::function<bool()> setupFunction = nullptr);
+	void skip(const std::string & group, const std::string & name, const std::string & reason);
+	size_t numberOfResults() const;
+	size_t numberOfFailures() const;
+	const std::vector<Result> & getResults() const;
+	rapidjson::Document toJSON() const;
+	std::string toSummaryString() const;
+
+	static const size_t DEFAULT_NUMBER_OF_ITERATIONS;
+	static const size_t DEFAULT_NUMBER_OF_WARMUP_ITERATIONS;
+	static const uint32_t DEFAULT_SEED;
+
+private:
+	size_t m_numberOfIterations;
+	size_t m_numberOfWarmupIterations;
+	uint32_t m_seed;
+	std::string m_filter;
+	std::vector<Result> m_results;
+	std::vector<std::pair<std::string, std::string>> m_skipped;
+
+	BenchmarkSuite(const BenchmarkSuite &) = delete;
+	const BenchmarkSuite & operator = (const BenchmarkSuite &) = delete;
+};
+
+#endif // _BENCHMARK_SUITE_H_
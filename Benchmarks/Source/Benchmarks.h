@@ -0,0 +1,18 @@
+#ifndef _BENCHMARKS_H_
+#define _BENCHMARKS_H_
+
+#include <string>
+
+class BenchmarkSuite;
+
+namespace Benchmarks {
+
+	void runByteBufferBenchmarks(BenchmarkSuite & suite);
+	void runCompressionBenchmarks(BenchmarkSuite & suite);
+	void runHashBenchmarks(BenchmarkSuite & suite, const std::string & workingDirectoryPath);
+	void runArchiveBenchmarks(BenchmarkSuite & suite, const std::string & workingDirectoryPath, const std::string & sevenZipArchiveFilePath = {});
+	void runHTTPServiceBenchmarks(BenchmarkSuite & suite);
+
+}
+
+#endif // _BENCHMARKS_H_
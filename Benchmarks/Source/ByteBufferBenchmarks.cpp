@@ -0,0 +1,136 @@
+#include "Benchmarks.h"
+
+#include "BenchmarkFixtures.h"
+#include "BenchmarkSuite.h"
+#include "ByteBuffer.h"
+
+#include <optional>
+#include <random>
+#include <vector>
+
+static constexpr size_t NUMBER_OF_VALUES = 1 << 18;
+
+template <typename T>
+static bool writeValues(ByteBuffer & buffer, bool (ByteBuffer::*writeFunction)(T)) {
+	buffer.clear();
+	buffer.setWriteOffset(0);
+
+	for(size_t i = 0; i < NUMBER_OF_VALUES; i++) {
+		if(!(buffer.*writeFunction)(static_cast<T>(i))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename T>
+static bool readValues(const ByteBuffer & buffer, std::optional<T> (ByteBuffer::*readFunction)() const) {
+	buffer.setReadOffset(0);
+
+	T total = 0;
+
+	for(size_t i = 0; i < NUMBER_OF_VALUES; i++) {
+		std::optional<T> optionalValue((buffer.*readFunction)());
+
+		if(!optionalValue.has_value()) {
+			return false;
+		}
+
+		total += optionalValue.value();
+	}
+
+	// keep the accumulated value observable so the reads cannot be optimized away
+	volatile T result = total;
+	static_cast<void>(result);
+
+	return true;
+}
+
+template <typename T>
+static void runTypedBenchmarks(BenchmarkSuite & suite, const std::string & typeName, bool (ByteBuffer::*writeFunction)(T), std::optional<T> (ByteBuffer::*readFunction)() const) {
+	static const std::string GROUP("ByteBuffer");
+
+	for(Endianness endianness : { Endianness::LittleEndian, Endianness::BigEndian }) {
+		std::string endiannessName(endianness == Endianness::LittleEndian ? "LittleEndian" : "BigEndian");
+		ByteBuffer buffer(endianness);
+		buffer.reserve(NUMBER_OF_VALUES * sizeof(T));
+
+		suite.run(GROUP, "write" + typeName + endiannessName, NUMBER_OF_VALUES * sizeof(T), [&buffer, writeFunction]() {
+			return writeValues(buffer, writeFunction);
+		});
+
+		if(!writeValues(buffer, writeFunction)) {
+			continue;
+		}
+
+		suite.run(GROUP, "read" + typeName + endiannessName, NUMBER_OF_VALUES * sizeof(T), [&buffer, readFunction]() {
+			return readValues(buffer, readFunction);
+		});
+	}
+}
+
+void Benchmarks::runByteBufferBenchmarks(BenchmarkSuite & suite) {
+	static const std::string GROUP("ByteBuffer");
+
+	if(!suite.isGroupEnabled(GROUP)) {
+		return;
+	}
+
+	runTypedBenchmarks<uint8_t>(suite, "UnsignedByte", &ByteBuffer::writeUnsignedByte, &ByteBuffer::readUnsignedByte);
+	runTypedBenchmarks<uint16_t>(suite, "UnsignedShort", &ByteBuffer::writeUnsignedShort, &ByteBuffer::readUnsignedShort);
+	runTypedBenchmarks<uint32_t>(suite, "UnsignedInteger", &ByteBuffer::writeUnsignedInteger, &ByteBuffer::readUnsignedInteger);
+	runTypedBenchmarks<uint64_t>(suite, "UnsignedLong", &ByteBuffer::writeUnsignedLong, &ByteBuffer::readUnsignedLong);
+	runTypedBenchmarks<float>(suite, "Float", &ByteBuffer::writeFloat, &ByteBuffer::readFloat);
+	runTypedBenchmarks<double>(suite, "Double", &ByteBuffer::writeDouble, &ByteBuffer::readDouble);
+
+	std::unique_ptr<ByteBuffer> randomData(BenchmarkFixtures::generateRandomData(NUMBER_OF_VALUES * sizeof(uint64_t), suite.getSeed()));
+	std::vector<size_t> randomOffsets(NUMBER_OF_VALUES);
+	std::mt19937 randomGenerator(suite.getSeed());
+	std::uniform_int_distribution<size_t> offsetDistribution(0, randomData->getSize() - sizeof(uint64_t));
+
+	for(size_t & offset : randomOffsets) {
+		offset = offsetDistribution(randomGenerator);
+	}
+
+	suite.run(GROUP, "getUnsignedLongRandomOffset", NUMBER_OF_VALUES * sizeof(uint64_t), [&randomData, &randomOffsets]() {
+		uint64_t total = 0;
+
+		for(size_t offset : randomOffsets) {
+			std::optional<uint64_t> optionalValue(randomData->getUnsignedLong(offset));
+
+			if(!optionalValue.has_value()) {
+				return false;
+			}
+
+			total += optionalValue.value();
+		}
+
+		volatile uint64_t result = total;
+		static_cast<void>(result);
+
+		return true;
+	});
+
+	std::unique_ptr<ByteBuffer> textData(BenchmarkFixtures::generateTextData(4 * 1024 * 1024, suite.getSeed()));
+
+	suite.run(GROUP, "readLine", textData->getSize(), [&textData]() {
+		textData->setReadOffset(0);
+
+		while(textData->getReadOffset() < textData->getSize()) {
+			if(!textData->readLine().has_value()) {
+				return false;
+			}
+		}
+
+		return true;
+	});
+
+	suite.run(GROUP, "toHexadecimal", randomData->getSize(), [&randomData]() {
+		return !randomData->toHexadecimal().empty();
+	});
+
+	suite.run(GROUP, "toBase64", randomData->getSize(), [&randomData]() {
+		return !randomData->toBase64().empty();
+	});
+}
@@ -0,0 +1,74 @@
+#include "Benchmarks.h"
+
+#include "BenchmarkFixtures.h"
+#include "BenchmarkSuite.h"
+#include "ByteBuffer.h"
+
+#include <magic_enum/magic_enum.hpp>
+
+#include <vector>
+
+static constexpr size_t LARGE_PAYLOAD_SIZE = 8 * 1024 * 1024;
+static constexpr size_t SMALL_PAYLOAD_SIZE = 4 * 1024;
+static constexpr size_t NUMBER_OF_SMALL_PAYLOADS = 256;
+
+void Benchmarks::runCompressionBenchmarks(BenchmarkSuite & suite) {
+	static const std::string GROUP("Compression");
+
+	if(!suite.isGroupEnabled(GROUP)) {
+		return;
+	}
+
+	std::unique_ptr<ByteBuffer> textData(BenchmarkFixtures::generateTextData(LARGE_PAYLOAD_SIZE, suite.getSeed()));
+	std::unique_ptr<ByteBuffer> randomData(BenchmarkFixtures::generateRandomData(LARGE_PAYLOAD_SIZE, suite.getSeed()));
+	std::vector<std::unique_ptr<ByteBuffer>> smallPayloads;
+
+	for(size_t i = 0; i < NUMBER_OF_SMALL_PAYLOADS; i++) {
+		smallPayloads.emplace_back(BenchmarkFixtures::generateTextData(SMALL_PAYLOAD_SIZE, suite.getSeed() + static_cast<uint32_t>(i)));
+	}
+
+	for(ByteBuffer::CompressionMethod compressionMethod : magic_enum::enum_values<ByteBuffer::CompressionMethod>()) {
+		std::string methodName(magic_enum::enum_name(compressionMethod));
+
+		for(const std::pair<std::string, const ByteBuffer *> & payload : std::vector<std::pair<std::string, const ByteBuffer *>>{ { "Text", textData.get() }, { "Random", randomData.get() } }) {
+			const ByteBuffer * data = payload.second;
+
+			suite.run(GROUP, "compress" + methodName + payload.first, data->getSize(), [data, compressionMethod]() {
+				return data->compressed(compressionMethod) != nullptr;
+			});
+
+			std::unique_ptr<ByteBuffer> compressedData(data->compressed(compressionMethod));
+
+			if(compressedData == nullptr) {
+				suite.skip(GROUP, "decompress" + methodName + payload.first, "failed to compress input data");
+				continue;
+			}
+
+			suite.run(GROUP, "decompress" + methodName + payload.first, data->getSize(), [&compressedData, data, compressionMethod]() {
+				std::unique_ptr<ByteBuffer> decompressedData(compressedData->decompressed(compressionMethod));
+
+				return decompressedData != nullptr &&
+					   decompressedData->getSize() == data->getSize();
+			});
+		}
+
+		suite.run(GROUP, "compress" + methodName + "SmallPayloads", NUMBER_OF_SMALL_PAYLOADS * SMALL_PAYLOAD_SIZE, [&smallPayloads, compressionMethod]() {
+			for(const std::unique_ptr<ByteBuffer> & smallPayload : smallPayloads) {
+				if(smallPayload->compressed(compressionMethod) == nullptr) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+	}
+
+	ByteBuffer::CompressionOptions multithreadedOptions;
+	multithreadedOptions.numberOfThreads = 0;
+
+	for(ByteBuffer::CompressionMethod compressionMethod : { ByteBuffer::CompressionMethod::XZ, ByteBuffer::CompressionMethod::ZStandard }) {
+		suite.run(GROUP, "compress" + std::string(magic_enum::enum_name(compressionMethod)) + "TextMultithreaded", textData->getSize(), [&textData, &multithreadedOptions, compressionMethod]() {
+			return textData->compressed(compressionMethod, multithreadedOptions) != nullptr;
+		});
+	}
+}
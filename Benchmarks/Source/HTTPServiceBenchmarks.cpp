@@ -0,0 +1,91 @@
+#include "Benchmarks.h"
+
+#include "BenchmarkFixtures.h"
+#include "BenchmarkSuite.h"
+#include "ByteBuffer.h"
+#include "LoopbackHTTPServer.h"
+#include "Network/HTTPService.h"
+
+#include <future>
+#include <vector>
+
+static constexpr size_t SMALL_RESPONSE_SIZE = 1024;
+static constexpr size_t LARGE_RESPONSE_SIZE = 1024 * 1024;
+static constexpr size_t NUMBER_OF_CONCURRENT_REQUESTS = 64;
+static constexpr size_t NUMBER_OF_SEQUENTIAL_REQUESTS = 32;
+
+static bool sendConcurrentRequests(HTTPService * httpService, const std::string & url, size_t numberOfRequests, size_t expectedResponseSize) {
+	std::vector<std::future<std::shared_ptr<HTTPResponse>>> responseFutures;
+	responseFutures.reserve(numberOfRequests);
+
+	for(size_t i = 0; i < numberOfRequests; i++) {
+		responseFutures.emplace_back(httpService->sendRequest(httpService->createRequest(HTTPRequest::Method::Get, url)));
+	}
+
+	bool success = true;
+
+	for(std::future<std::shared_ptr<HTTPResponse>> & responseFuture : responseFutures) {
+		if(!responseFuture.valid()) {
+			success = false;
+			continue;
+		}
+
+		std::shared_ptr<HTTPResponse> response(responseFuture.get());
+
+		if(response == nullptr || response->isFailure() || response->getSize() != expectedResponseSize) {
+			success = false;
+		}
+	}
+
+	return success;
+}
+
+static void runServerBenchmarks(BenchmarkSuite & suite, const std::string & group, HTTPService * httpService, size_t responseSize, const std::string & sizeName) {
+	LoopbackHTTPServer server(BenchmarkFixtures::generateRandomData(responseSize, suite.getSeed()));
+
+	if(!server.start()) {
+		suite.skip(group, "sequential" + sizeName, "failed to start loopback server");
+		suite.skip(group, "concurrent" + sizeName, "failed to start loopback server");
+		return;
+	}
+
+	std::string url(server.getURL("/data"));
+
+	suite.run(group, "sequential" + sizeName, NUMBER_OF_SEQUENTIAL_REQUESTS * responseSize, [httpService, &url, responseSize]() {
+		for(size_t i = 0; i < NUMBER_OF_SEQUENTIAL_REQUESTS; i++) {
+			std::shared_ptr<HTTPResponse> response(httpService->sendRequestAndWait(httpService->createRequest(HTTPRequest::Method::Get, url)));
+
+			if(response == nullptr || response->isFailure() || response->getSize() != responseSize) {
+				return false;
+			}
+		}
+
+		return true;
+	});
+
+	suite.run(group, "concurrent" + sizeName, NUMBER_OF_CONCURRENT_REQUESTS * responseSize, [httpService, &url, responseSize]() {
+		return sendConcurrentRequests(httpService, url, NUMBER_OF_CONCURRENT_REQUESTS, responseSize);
+	});
+
+	server.stop();
+}
+
+void Benchmarks::runHTTPServiceBenchmarks(BenchmarkSuite & suite) {
+	static const std::string GROUP("HTTPService");
+
+	if(!suite.isGroupEnabled(GROUP)) {
+		return;
+	}
+
+	HTTPService * httpService = HTTPService::getInstance();
+
+	if(httpService == nullptr || !httpService->initialize()) {
+		suite.skip(GROUP, "*", "failed to initialize HTTP service");
+		return;
+	}
+
+	runServerBenchmarks(suite, GROUP, httpService, SMALL_RESPONSE_SIZE, "Small");
+	runServerBenchmarks(suite, GROUP, httpService, LARGE_RESPONSE_SIZE, "Large");
+
+	httpService->stop();
+}
@@ -0,0 +1,39 @@
+#include "Benchmarks.h"
+
+#include "BenchmarkFixtures.h"
+#include "BenchmarkSuite.h"
+#include "ByteBuffer.h"
+#include "Utilities/FileUtilities.h"
+
+#include <magic_enum/magic_enum.hpp>
+
+static constexpr size_t HASH_PAYLOAD_SIZE = 16 * 1024 * 1024;
+
+void Benchmarks::runHashBenchmarks(BenchmarkSuite & suite, const std::string & workingDirectoryPath) {
+	static const std::string GROUP("Hash");
+
+	if(!suite.isGroupEnabled(GROUP)) {
+		return;
+	}
+
+	std::unique_ptr<ByteBuffer> data(BenchmarkFixtures::generateRandomData(HASH_PAYLOAD_SIZE, suite.getSeed()));
+	std::string dataFilePath(Utilities::joinPaths(workingDirectoryPath, "hash.bin"));
+	bool dataFileWritten = data->writeTo(dataFilePath, true);
+
+	for(ByteBuffer::HashType hashType : magic_enum::enum_values<ByteBuffer::HashType>()) {
+		std::string hashTypeName(magic_enum::enum_name(hashType));
+
+		suite.run(GROUP, hashTypeName, data->getSize(), [&data, hashType]() {
+			return !data->getHash(hashType, ByteBuffer::HashFormat::Hexadecimal).empty();
+		});
+
+		if(!dataFileWritten) {
+			suite.skip(GROUP, "file" + hashTypeName, "failed to write hash input file");
+			continue;
+		}
+
+		suite.run(GROUP, "file" + hashTypeName, data->getSize(), [&dataFilePath, hashType]() {
+			return !Utilities::getFileHash(dataFilePath, hashType).empty();
+		});
+	}
+}
@@ -0,0 +1,199 @@
+#include "LoopbackHTTPServer.h"
+
+#include "ByteBuffer.h"
+#include "Utilities/ThreadUtilities.h"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <array>
+
+LoopbackHTTPServer::LoopbackHTTPServer(std::unique_ptr<ByteBuffer> responseBody)
+	: m_responseBody(responseBody != nullptr ? std::move(responseBody) : std::make_unique<ByteBuffer>())
+	, m_running(false)
+	, m_numberOfRequestsServed(0) {
+	m_responseHeader = fmt::format(
+		"HTTP/1.1 200 OK\r\n"
+		"Content-Type: application/octet-stream\r\n"
+		"Content-Length: {}\r\n"
+		"Connection: keep-alive\r\n"
+		"\r\n",
+		m_responseBody->getSize()
+	);
+}
+
+LoopbackHTTPServer::~LoopbackHTTPServer() {
+	stop();
+}
+
+bool LoopbackHTTPServer::isRunning() const {
+	return m_running;
+}
+
+uint16_t LoopbackHTTPServer::getPort() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(m_acceptor == nullptr) {
+		return 0;
+	}
+
+	boost::system::error_code errorCode;
+	boost::asio::ip::tcp::endpoint endpoint(m_acceptor->local_endpoint(errorCode));
+
+	return errorCode ? 0 : endpoint.port();
+}
+
+std::string LoopbackHTTPServer::getURL(const std::string & path) const {
+	return fmt::format("http://127.0.0.1:{}{}", getPort(), path);
+}
+
+uint64_t LoopbackHTTPServer::numberOfRequestsServed() const {
+	return m_numberOfRequestsServed;
+}
+
+size_t LoopbackHTTPServer::getResponseBodySize() const {
+	return m_responseBody->getSize();
+}
+
+bool LoopbackHTTPServer::start() {
+	if(m_running) {
+		return true;
+	}
+
+	boost::system::error_code errorCode;
+	std::unique_ptr<boost::asio::ip::tcp::acceptor> acceptor(std::make_unique<boost::asio::ip::tcp::acceptor>(m_ioContext));
+	boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address("127.0.0.1"), 0);
+
+	acceptor->open(endpoint.protocol(), errorCode);
+
+	if(!errorCode) {
+		acceptor->bind(endpoint, errorCode);
+	}
+
+	if(!errorCode) {
+		acceptor->listen(boost::asio::socket_base::max_listen_connections, errorCode);
+	}
+
+	if(errorCode) {
+		spdlog::error("Failed to start loopback HTTP server: {}", errorCode.message());
+		return false;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_acceptor = std::move(acceptor);
+	}
+
+	m_running = true;
+	m_acceptThread = std::thread(&LoopbackHTTPServer::acceptConnections, this);
+	Utilities::setThreadName(m_acceptThread, "Loopback HTTP Server");
+
+	spdlog::info("Loopback HTTP server listening on port {}.", getPort());
+
+	return true;
+}
+
+void LoopbackHTTPServer::stop() {
+	uint16_t port = getPort();
+
+	if(!m_running.exchange(false)) {
+		return;
+	}
+
+	boost::system::error_code errorCode;
+
+	// closing the acceptor does not reliably interrupt a blocking accept call, so connect to it instead
+	boost::asio::ip::tcp::socket wakeSocket(m_ioContext);
+	wakeSocket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), port), errorCode);
+
+	if(m_acceptThread.joinable()) {
+		m_acceptThread.join();
+	}
+
+	wakeSocket.close(errorCode);
+
+	std::vector<std::thread> connectionThreads;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_acceptor->close(errorCode);
+
+		for(std::shared_ptr<boost::asio::ip::tcp::socket> & socket : m_sockets) {
+			socket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, errorCode);
+		}
+
+		connectionThreads = std::move(m_connectionThreads);
+		m_connectionThreads.clear();
+	}
+
+	for(std::thread & connectionThread : connectionThreads) {
+		if(connectionThread.joinable()) {
+			connectionThread.join();
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_sockets.clear();
+	m_acceptor.reset();
+}
+
+void LoopbackHTTPServer::acceptConnections() {
+	while(m_running) {
+		std::shared_ptr<boost::asio::ip::tcp::socket> socket(std::make_shared<boost::asio::ip::tcp::socket>(m_ioContext));
+		boost::system::error_code errorCode;
+
+		m_acceptor->accept(*socket, errorCode);
+
+		if(errorCode) {
+			if(m_running) {
+				spdlog::warn("Loopback HTTP server failed to accept connection: {}", errorCode.message());
+			}
+
+			continue;
+		}
+
+		socket->set_option(boost::asio::ip::tcp::no_delay(true), errorCode);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if(!m_running) {
+			break;
+		}
+
+		m_sockets.push_back(socket);
+		m_connectionThreads.emplace_back(&LoopbackHTTPServer::serveConnection, this, socket);
+	}
+}
+
+void LoopbackHTTPServer::serveConnection(std::shared_ptr<boost::asio::ip::tcp::socket> socket) {
+	static const std::string END_OF_HEADERS("\r\n\r\n");
+
+	boost::asio::streambuf requestBuffer;
+	std::array<boost::asio::const_buffer, 2> responseBuffers = {
+		boost::asio::buffer(m_responseHeader),
+		boost::asio::buffer(m_responseBody->getRawData(), m_responseBody->getSize())
+	};
+
+	while(m_running) {
+		boost::system::error_code errorCode;
+		size_t requestHeaderSize = boost::asio::read_until(*socket, requestBuffer, END_OF_HEADERS, errorCode);
+
+		if(errorCode) {
+			break;
+		}
+
+		// request bodies are not expected, so the header terminator marks the end of the request
+		requestBuffer.consume(requestHeaderSize);
+
+		boost::asio::write(*socket, responseBuffers, errorCode);
+
+		if(errorCode) {
+			break;
+		}
+
+		m_numberOfRequestsServed++;
+	}
+}
@@ -0,0 +1,48 @@
+#ifndef _LOOPBACK_HTTP_SERVER_H_
+#define _LOOPBACK_HTTP_SERVER_H_
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ByteBuffer;
+
+class LoopbackHTTPServer final {
+public:
+	LoopbackHTTPServer(std::unique_ptr<ByteBuffer> responseBody);
+	~LoopbackHTTPServer();
+
+	bool isRunning() const;
+	uint16_t getPort() const;
+	std::string getURL(const std::string & path = "/") const;
+	uint64_t numberOfRequestsServed() const;
+	size_t getResponseBodySize() const;
+	bool start();
+	void stop();
+
+private:
+	void acceptConnections();
+	void serveConnection(std::shared_ptr<boost::asio::ip::tcp::socket> socket);
+
+	std::unique_ptr<ByteBuffer> m_responseBody;
+	std::string m_responseHeader;
+	boost::asio::io_context m_ioContext;
+	std::unique_ptr<boost::asio::ip::tcp::acceptor> m_acceptor;
+	std::atomic<bool> m_running;
+	std::atomic<uint64_t> m_numberOfRequestsServed;
+	std::thread m_acceptThread;
+	std::vector<std::thread> m_connectionThreads;
+	std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> m_sockets;
+	mutable std::mutex m_mutex;
+
+	LoopbackHTTPServer(const LoopbackHTTPServer &) = delete;
+	const LoopbackHTTPServer & operator = (const LoopbackHTTPServer &) = delete;
+};
+
+#endif // _LOOPBACK_HTTP_SERVER_H_
@@ -0,0 +1,103 @@
+#include "Arguments/ArgumentParser.h"
+#include "Benchmarks.h"
+#include "BenchmarkSuite.h"
+#include "Factory/FactoryRegistry.h"
+#include "Utilities/RapidJSONUtilities.h"
+#include "Utilities/StringUtilities.h"
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+#include <iostream>
+#include <optional>
+
+static void printUsage() {
+	std::cout << "Usage: CoreBenchmarks [options]\n"
+			  << "  --output <file>         Write JSON results to the specified file instead of standard output.\n"
+			  << "  --iterations <count>    Number of measured iterations per benchmark.\n"
+			  << "  --warmup <count>        Number of unmeasured warmup iterations per benchmark.\n"
+			  << "  --seed <value>          Seed used to generate fixture data.\n"
+			  << "  --filter <text>         Only run benchmarks whose 'group/name' contains the specified text.\n"
+			  << "  --directory <path>      Working directory used for temporary fixture files.\n"
+			  << "  --seven-zip <file>      Optional 7-Zip archive used for the 7-Zip extraction benchmark.\n";
+}
+
+static std::optional<uint32_t> getUnsignedIntegerArgument(const ArgumentParser & arguments, const std::string & name, uint32_t defaultValue) {
+	if(!arguments.hasArgument(name)) {
+		return defaultValue;
+	}
+
+	std::optional<uint32_t> optionalValue(Utilities::parseUnsignedInteger(arguments.getFirstValue(name)));
+
+	if(!optionalValue.has_value()) {
+		spdlog::error("Invalid '{}' argument value: '{}'.", name, arguments.getFirstValue(name));
+	}
+
+	return optionalValue;
+}
+
+int main(int argc, char * argv[]) {
+	ArgumentParser arguments(argc, argv);
+
+	if(arguments.hasArgument("help") || arguments.hasArgument("?")) {
+		printUsage();
+		return 0;
+	}
+
+	std::optional<uint32_t> optionalNumberOfIterations(getUnsignedIntegerArgument(arguments, "iterations", static_cast<uint32_t>(BenchmarkSuite::DEFAULT_NUMBER_OF_ITERATIONS)));
+	std::optional<uint32_t> optionalNumberOfWarmupIterations(getUnsignedIntegerArgument(arguments, "warmup", static_cast<uint32_t>(BenchmarkSuite::DEFAULT_NUMBER_OF_WARMUP_ITERATIONS)));
+	std::optional<uint32_t> optionalSeed(getUnsignedIntegerArgument(arguments, "seed", BenchmarkSuite::DEFAULT_SEED));
+
+	if(!optionalNumberOfIterations.has_value() || !optionalNumberOfWarmupIterations.has_value() || !optionalSeed.has_value()) {
+		printUsage();
+		return 1;
+	}
+
+	FactoryRegistry::getInstance().assignDefaultFactories();
+
+	BenchmarkSuite suite(optionalNumberOfIterations.value(), optionalNumberOfWarmupIterations.value(), optionalSeed.value());
+
+	if(arguments.hasArgument("filter")) {
+		suite.setFilter(arguments.getFirstValue("filter"));
+	}
+
+	std::error_code errorCode;
+	std::filesystem::path workingDirectoryPath(arguments.hasArgument("directory") ? std::filesystem::u8path(arguments.getFirstValue("directory")) : std::filesystem::temp_directory_path(errorCode) / "CoreBenchmarks");
+
+	std::filesystem::create_directories(workingDirectoryPath, errorCode);
+
+	if(errorCode) {
+		spdlog::error("Failed to create benchmark working directory '{}': {}", workingDirectoryPath.string(), errorCode.message());
+		return 1;
+	}
+
+	Benchmarks::runByteBufferBenchmarks(suite);
+	Benchmarks::runCompressionBenchmarks(suite);
+	Benchmarks::runHashBenchmarks(suite, workingDirectoryPath.string());
+	Benchmarks::runArchiveBenchmarks(suite, workingDirectoryPath.string(), arguments.hasArgument("seven-zip") ? arguments.getFirstValue("seven-zip") : std::string());
+	Benchmarks::runHTTPServiceBenchmarks(suite);
+
+	if(!arguments.hasArgument("directory")) {
+		std::filesystem::remove_all(workingDirectoryPath, errorCode);
+	}
+
+	std::cerr << suite.toSummaryString();
+
+	rapidjson::Document resultsDocument(suite.toJSON());
+
+	if(arguments.hasArgument("output")) {
+		std::string outputFilePath(arguments.getFirstValue("output"));
+
+		if(!Utilities::saveJSONValueTo(resultsDocument, outputFilePath)) {
+			spdlog::error("Failed to write benchmark results to file: '{}'.", outputFilePath);
+			return 1;
+		}
+
+		spdlog::info("Wrote benchmark results to file: '{}'.", outputFilePath);
+	}
+	else {
+		std::cout << Utilities::valueToString(resultsDocument) << std::endl;
+	}
+
+	return suite.numberOfFailures() == 0 ? 0 : 1;
+}
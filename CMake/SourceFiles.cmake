@@ -31,6 +31,7 @@ set(CORE_SOURCE_FILES
 	Archive/Tar/TarArchive.h
 	Archive/Tar/TarArchive.cpp
 	Archive/Tar/TarArchiveEntry.cpp
+	Archive/Tar/TarArchiveStreamReader.cpp
 	Archive/Tar/TarBZip2Archive.h
 	Archive/Tar/TarBZip2Archive.cpp
 	Archive/Tar/TarGZipArchive.h
@@ -62,15 +63,23 @@ set(CORE_SOURCE_FILES
 	BitmaskOperators.h
 	ByteBuffer.h
 	ByteBuffer.cpp
+	ByteBufferView.h
+	ByteBufferView.cpp
 	Colour.h
 	Colour.cpp
 	Colours.cpp
 	Compression/BZip2Utilities.h
 	Compression/BZip2Utilities.cpp
+	Compression/CompressionStream.h
+	Compression/CompressionStream.cpp
+	Compression/CompressionStreamPool.h
+	Compression/CompressionStreamPool.cpp
 	Compression/LZMAUtilities.h
 	Compression/LZMAUtilities.cpp
 	Compression/ZLibUtilities.h
 	Compression/ZLibUtilities.cpp
+	Compression/ZStandardUtilities.h
+	Compression/ZStandardUtilities.cpp
 	Diff/OpenVCDiffByteBufferOutputStream.h
 	Diff/OpenVCDiffByteBufferOutputStream.cpp
 	Core.h
@@ -94,6 +103,8 @@ set(CORE_SOURCE_FILES
 	GitHub/GitHubReleaseCollection.cpp
 	GitHub/GitHubService.h
 	GitHub/GitHubService.cpp
+	Hasher.h
+	Hasher.cpp
 	Point2D.h
 	Point2D.cpp
 	Point3D.h
@@ -125,7 +136,13 @@ set(CORE_SOURCE_FILES
 	Math/Vector3.cpp
 	Math/Vector4.h
 	Math/Vector4.cpp
+	MemoryMappedFile.h
+	MemoryMappedFile.cpp
+	Network/HTTPCache.h
+	Network/HTTPCache.cpp
 	Network/HTTPConfiguration.h
+	Network/HTTPDownloader.h
+	Network/HTTPDownloader.cpp
 	Network/HTTPHeaders.h
 	Network/HTTPHeaders.cpp
 	Network/HTTPQueryParameters.h
@@ -136,8 +153,12 @@ set(CORE_SOURCE_FILES
 	Network/HTTPRequestSettings.cpp
 	Network/HTTPResponse.h
 	Network/HTTPResponse.cpp
+	Network/HTTPScheduler.h
+	Network/HTTPScheduler.cpp
 	Network/HTTPService.h
 	Network/HTTPService.cpp
+	Network/HTTPSubmissionQueue.h
+	Network/HTTPSubmissionQueue.cpp
 	Network/HTTPTransfer.h
 	Network/HTTPTransfer.cpp
 	Network/HTTPUtilities.h
@@ -173,6 +194,8 @@ set(CORE_SOURCE_FILES
 	Utilities/NumberUtilities.cpp
 	Utilities/RapidJSONUtilities.h
 	Utilities/RapidJSONUtilities.cpp
+	Utilities/SIMDUtilities.h
+	Utilities/SIMDUtilities.cpp
 	Utilities/StringUtilities.h
 	Utilities/StringUtilities.cpp
 	Utilities/ThreadUtilities.h
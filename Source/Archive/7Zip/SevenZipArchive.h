@@ -7,6 +7,8 @@
 #include <SevenZip/C/7zFile.h>
 
 #include <functional>
+#include <optional>
+#include <span>
 
 class SevenZipArchive final : public Archive {
 	friend class Entry;
@@ -42,6 +44,8 @@ public:
 	private:
 		Entry(uint64_t index, SevenZipArchive * parentArchive);
 
+		std::optional<std::span<const uint8_t>> extractData() const;
+
 		uint64_t m_index;
 		SevenZipArchive * m_parentArchive;
 
@@ -111,21 +111,13 @@ uint64_t SevenZipArchive::Entry::getUncompressedSize() const {
 }
 
 std::unique_ptr<ByteBuffer> SevenZipArchive::Entry::getData() const {
-	if(!isParentArchiveValid()) {
-		return nullptr;
-	}
+	std::optional<std::span<const uint8_t>> optionalData(extractData());
 
-	ExtractionData & extractionData = m_parentArchive->getCachedExtractionData();
-
-	size_t offset = 0;
-	size_t outputSizeProcessed = 0;
-	ISzAlloc temporaryAllocator = SevenZipArchive::DEFAULT_ALLOCATOR;
-
-	if(SzArEx_Extract(m_parentArchive->getRawArchiveHandle(), &m_parentArchive->getRawLookStreamHandle()->vt, m_index, &extractionData.blockIndex, &extractionData.outputBuffer, &extractionData.outputBufferSize, &offset, &outputSizeProcessed, m_parentArchive->getRawAllocatorHandle(), &temporaryAllocator) != SZ_OK) {
+	if(!optionalData.has_value()) {
 		return nullptr;
 	}
 
-	return std::make_unique<ByteBuffer>(extractionData.outputBuffer + offset, outputSizeProcessed);
+	return std::make_unique<ByteBuffer>(optionalData->data(), optionalData->size());
 }
 
 uint32_t SevenZipArchive::Entry::getCRC32() const {
@@ -137,14 +129,36 @@ uint32_t SevenZipArchive::Entry::getCRC32() const {
 }
 
 bool SevenZipArchive::Entry::writeToFile(const std::string & filePath, bool overwrite) {
-	std::unique_ptr<ByteBuffer> data(getData());
+	std::optional<std::span<const uint8_t>> optionalData(extractData());
 
-	if(data == nullptr) {
+	if(!optionalData.has_value()) {
 		spdlog::error("Failed to obtain 7-Zip entry file data when writing entry to file: '{}'.", filePath);
 		return false;
 	}
 
-	return data->writeTo(filePath, overwrite);
+	// the decoder unpacks whole solid blocks into the cached buffer, so the entry is written straight from it instead of being copied first
+	BufferStream stream(optionalData->data(), optionalData->size());
+
+	return writeStreamToFile(stream, filePath, overwrite);
+}
+
+std::optional<std::span<const uint8_t>> SevenZipArchive::Entry::extractData() const {
+	if(!isParentArchiveValid()) {
+		return {};
+	}
+
+	ExtractionData & extractionData = m_parentArchive->getCachedExtractionData();
+
+	size_t offset = 0;
+	size_t outputSizeProcessed = 0;
+	ISzAlloc temporaryAllocator = SevenZipArchive::DEFAULT_ALLOCATOR;
+
+	if(SzArEx_Extract(m_parentArchive->getRawArchiveHandle(), &m_parentArchive->getRawLookStreamHandle()->vt, m_index, &extractionData.blockIndex, &extractionData.outputBuffer, &extractionData.outputBufferSize, &offset, &outputSizeProcessed, m_parentArchive->getRawAllocatorHandle(), &temporaryAllocator) != SZ_OK) {
+		return {};
+	}
+
+	// the data points into the archive's cached extraction buffer, which is only valid until the next entry is extracted
+	return std::span<const uint8_t>(extractionData.outputBuffer + offset, outputSizeProcessed);
 }
 
 Archive * SevenZipArchive::Entry::getParentArchive() const {
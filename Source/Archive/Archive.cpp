@@ -1,16 +1,24 @@
 #include "Archive.h"
 
 #include "Utilities/FileUtilities.h"
-
-#include <filesystem>
+#include "Utilities/StringUtilities.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <set>
+#include <thread>
+
 Archive::Archive(Type type)
 	: m_type(type) { }
 
 Archive::Archive(Archive && a) noexcept
-	: m_type(a.m_type) { }
+	: m_type(a.m_type) {
+	a.invalidateEntryIndex();
+}
 
 Archive::Archive(const Archive & a)
 	: m_type(a.m_type) { }
@@ -18,6 +26,9 @@ Archive::Archive(const Archive & a)
 Archive & Archive::operator = (Archive && a) noexcept {
 	if(this != &a) {
 		m_type = a.m_type;
+
+		invalidateEntryIndex();
+		a.invalidateEntryIndex();
 	}
 
 	return *this;
@@ -26,11 +37,15 @@ Archive & Archive::operator = (Archive && a) noexcept {
 Archive & Archive::operator = (const Archive & a) {
 	m_type = a.m_type;
 
+	invalidateEntryIndex();
+
 	return *this;
 }
 
 Archive::~Archive() { }
 
+Archive::ConcurrentEntryReader::~ConcurrentEntryReader() { }
+
 Archive::Type Archive::getType() const {
 	return m_type;
 }
@@ -114,7 +129,8 @@ size_t Archive::numberOfDirectories() const {
 }
 
 bool Archive::hasEntry(const ArchiveEntry & entry) const {
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
+	const std::vector<std::shared_ptr<ArchiveEntry>> & entries = entryIndex->entries;
 
 	return entry.getParentArchive() == this &&
 		   entry.getIndex() < entries.size() &&
@@ -143,15 +159,17 @@ size_t Archive::indexOfEntry(const std::string & entryPath, bool caseSensitive)
 		return std::numeric_limits<size_t>::max();
 	}
 
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
+	std::string_view formattedEntryPath(Utilities::trimTrailingPathSeparator(entryPath));
+	std::unordered_map<std::string, std::vector<size_t>>::const_iterator indices(entryIndex->pathIndices.find(Utilities::toLowerCase(formattedEntryPath)));
 
-	for(std::vector<std::shared_ptr<ArchiveEntry>>::const_iterator i = entries.begin(); i != entries.end(); ++i) {
-		if(*i == nullptr) {
-			continue;
-		}
+	if(indices == entryIndex->pathIndices.cend()) {
+		return std::numeric_limits<size_t>::max();
+	}
 
-		if(Utilities::areStringsEqual(Utilities::trimTrailingPathSeparator((*i)->getPath()), Utilities::trimTrailingPathSeparator(entryPath), caseSensitive)) {
-			return i - entries.begin();
+	for(size_t index : indices->second) {
+		if(!caseSensitive || entryIndex->paths[index] == formattedEntryPath) {
+			return index;
 		}
 	}
 
@@ -163,19 +181,21 @@ size_t Archive::indexOfFirstEntryWithName(const std::string & entryName, bool in
 		return std::numeric_limits<size_t>::max();
 	}
 
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
+	std::string_view formattedEntryName(Utilities::trimTrailingPathSeparator(entryName));
+	std::unordered_map<std::string, std::vector<size_t>>::const_iterator indices(entryIndex->nameIndices.find(Utilities::toLowerCase(formattedEntryName)));
 
-	for(std::vector<std::shared_ptr<ArchiveEntry>>::const_iterator i = entries.begin(); i != entries.end(); ++i) {
-		if(*i == nullptr) {
-			continue;
-		}
+	if(indices == entryIndex->nameIndices.cend()) {
+		return std::numeric_limits<size_t>::max();
+	}
 
-		if(!includeSubdirectories && (*i)->isInSubdirectory()) {
+	for(std::vector<size_t>::const_iterator i = indices->second.cbegin(); i != indices->second.cend(); ++i) {
+		if(!includeSubdirectories && entryIndex->entries[*i]->isInSubdirectory()) {
 			continue;
 		}
 
-		if(Utilities::areStringsEqual(Utilities::trimTrailingPathSeparator((*i)->getName()), Utilities::trimTrailingPathSeparator(entryName), caseSensitive)) {
-			return i - entries.begin();
+		if(!caseSensitive || entryIndex->names[*i] == formattedEntryName) {
+			return *i;
 		}
 	}
 
@@ -187,19 +207,21 @@ size_t Archive::indexOfLastEntryWithName(const std::string & entryName, bool inc
 		return std::numeric_limits<size_t>::max();
 	}
 
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
+	std::string_view formattedEntryName(Utilities::trimTrailingPathSeparator(entryName));
+	std::unordered_map<std::string, std::vector<size_t>>::const_iterator indices(entryIndex->nameIndices.find(Utilities::toLowerCase(formattedEntryName)));
 
-	for(std::vector<std::shared_ptr<ArchiveEntry>>::const_reverse_iterator i = entries.crbegin(); i != entries.crend(); ++i) {
-		if(*i == nullptr) {
-			continue;
-		}
+	if(indices == entryIndex->nameIndices.cend()) {
+		return std::numeric_limits<size_t>::max();
+	}
 
-		if(!includeSubdirectories && (*i)->isInSubdirectory()) {
+	for(std::vector<size_t>::const_reverse_iterator i = indices->second.crbegin(); i != indices->second.crend(); ++i) {
+		if(!includeSubdirectories && entryIndex->entries[*i]->isInSubdirectory()) {
 			continue;
 		}
 
-		if(Utilities::areStringsEqual(Utilities::trimTrailingPathSeparator((*i)->getName()), Utilities::trimTrailingPathSeparator(entryName), caseSensitive)) {
-			return entries.crend() - i - 1;
+		if(!caseSensitive || entryIndex->names[*i] == formattedEntryName) {
+			return *i;
 		}
 	}
 
@@ -347,30 +369,30 @@ std::shared_ptr<ArchiveEntry> Archive::getLastEntryWithExtension(const std::vect
 }
 
 const std::shared_ptr<ArchiveEntry> Archive::getEntry(size_t index) const {
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
 
-	if(index >= entries.size()) {
+	if(index >= entryIndex->entries.size()) {
 		return std::shared_ptr<ArchiveEntry>();
 	}
 
-	return entries[index];
+	return entryIndex->entries[index];
 }
 
 std::shared_ptr<ArchiveEntry> Archive::getEntry(size_t index) {
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
 
-	if(index >= entries.size()) {
+	if(index >= entryIndex->entries.size()) {
 		return std::shared_ptr<ArchiveEntry>();
 	}
 
-	return entries[index];
+	return entryIndex->entries[index];
 }
 
 std::vector<std::shared_ptr<ArchiveEntry>> Archive::getRootEntries() const {
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
 	std::vector<std::shared_ptr<ArchiveEntry>> rootEntries;
 
-	for(const std::shared_ptr<ArchiveEntry> & entry : entries) {
+	for(const std::shared_ptr<ArchiveEntry> & entry : entryIndex->entries) {
 		if(entry == nullptr) {
 			continue;
 		}
@@ -470,42 +492,73 @@ std::vector<std::shared_ptr<ArchiveEntry>> Archive::getEntriesInDirectory(const
 		return getRootEntries();
 	}
 
-	std::string_view formattedDirectoryPath;
+	std::string_view formattedDirectoryPath(directoryPath);
 
 	if(directoryPath[0] == '/' || directoryPath[0] == '\\') {
-		formattedDirectoryPath = directoryPath.substr(0, directoryPath.length() - 1);
-	}
-	else {
-		formattedDirectoryPath = directoryPath;
+		formattedDirectoryPath = formattedDirectoryPath.substr(0, directoryPath.length() - 1);
 	}
 
-	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
+	std::vector<size_t> indices(findDirectoryEntryIndices(entryIndex->basePathIndices, entryIndex->basePaths, formattedDirectoryPath, includeSubdirectories, caseSensitive));
 	std::vector<std::shared_ptr<ArchiveEntry>> entriesInDirectory;
+	entriesInDirectory.reserve(indices.size());
 
-	for(const std::shared_ptr<ArchiveEntry> & entry : entries) {
-		if(entry == nullptr) {
+	for(size_t index : indices) {
+		entriesInDirectory.push_back(entryIndex->entries[index]);
+	}
+
+	return entriesInDirectory;
+}
+
+std::vector<std::shared_ptr<ArchiveEntry>> Archive::getChildEntries(const ArchiveEntry & directory, bool includeSubdirectories, bool caseSensitive) const {
+	std::shared_ptr<const EntryIndex> entryIndex(getEntryIndex());
+	std::vector<size_t> indices(findDirectoryEntryIndices(entryIndex->parentPathIndices, entryIndex->parentPaths, directory.getPath(), includeSubdirectories, caseSensitive));
+	std::vector<std::shared_ptr<ArchiveEntry>> children;
+	children.reserve(indices.size());
+
+	for(size_t index : indices) {
+		if(entryIndex->entries[index].get() == &directory) {
 			continue;
 		}
 
-		std::string entryBasePath(entry->getBasePath());
+		children.push_back(entryIndex->entries[index]);
+	}
 
-		if(includeSubdirectories) {
-			if(entryBasePath.length() < formattedDirectoryPath.length()) {
-				continue;
-			}
+	return children;
+}
 
-			if(Utilities::areStringsEqual(entryBasePath.substr(0, formattedDirectoryPath.length()), formattedDirectoryPath, caseSensitive)) {
-				entriesInDirectory.push_back(entry);
+std::vector<size_t> Archive::findDirectoryEntryIndices(const std::map<std::string, std::vector<size_t>> & directoryIndices, const std::vector<std::string> & directoryPaths, std::string_view directoryPath, bool includeSubdirectories, bool caseSensitive) {
+	std::string formattedDirectoryPath(Utilities::toLowerCase(directoryPath));
+	std::vector<size_t> indices;
+
+	if(!includeSubdirectories) {
+		std::map<std::string, std::vector<size_t>>::const_iterator directoryEntryIndices(directoryIndices.find(formattedDirectoryPath));
+
+		if(directoryEntryIndices == directoryIndices.cend()) {
+			return {};
+		}
+
+		for(size_t index : directoryEntryIndices->second) {
+			if(!caseSensitive || directoryPaths[index] == directoryPath) {
+				indices.push_back(index);
 			}
 		}
-		else {
-			if(Utilities::areStringsEqual(entryBasePath, formattedDirectoryPath, caseSensitive)) {
-				entriesInDirectory.push_back(entry);
+
+		return indices;
+	}
+
+	// directories sharing a common prefix are stored contiguously, so only the matching range needs to be visited
+	for(std::map<std::string, std::vector<size_t>>::const_iterator i = directoryIndices.lower_bound(formattedDirectoryPath); i != directoryIndices.cend() && i->first.starts_with(formattedDirectoryPath); ++i) {
+		for(size_t index : i->second) {
+			if(!caseSensitive || directoryPaths[index].starts_with(directoryPath)) {
+				indices.push_back(index);
 			}
 		}
 	}
 
-	return entriesInDirectory;
+	std::sort(indices.begin(), indices.end());
+
+	return indices;
 }
 
 std::shared_ptr<ArchiveEntry> Archive::extractFirstEntryWithExtension(const std::string & extension, const std::string & directory, bool overwrite, bool includeSubdirectories, bool caseSensitive) const {
@@ -726,6 +779,244 @@ size_t Archive::extractAllEntriesInSubdirectory(const std::string & destionation
 	return numberOfExtractedFileEntries;
 }
 
+std::vector<Archive::ExtractionResult> Archive::extractAllEntriesParallel(const std::string & destinationDirectoryPath, bool includeSubdirectories, bool overwrite, uint32_t numberOfThreads, const ExtractionProgressCallback & progressCallback) {
+	if(!isOpen()) {
+		return {};
+	}
+
+	std::vector<std::shared_ptr<ArchiveEntry>> entries(getEntries());
+	std::vector<std::pair<std::shared_ptr<ArchiveEntry>, std::string>> entriesToExtract;
+	entriesToExtract.reserve(entries.size());
+
+	for(const std::shared_ptr<ArchiveEntry> & entry : entries) {
+		if(entry == nullptr) {
+			continue;
+		}
+
+		if(!includeSubdirectories && entry->isInSubdirectory()) {
+			continue;
+		}
+
+		entriesToExtract.emplace_back(entry, Utilities::joinPaths(destinationDirectoryPath, entry->getPath()));
+	}
+
+	return extractEntriesParallel(entriesToExtract, overwrite, numberOfThreads, progressCallback);
+}
+
+std::vector<Archive::ExtractionResult> Archive::extractAllEntriesInSubdirectoryParallel(const std::string & destinationDirectoryPath, const std::string & archiveSubdirectory, bool relativeToSubdirectory, bool includeSubdirectories, bool overwrite, bool caseSensitive, uint32_t numberOfThreads, const ExtractionProgressCallback & progressCallback) {
+	if(!isOpen()) {
+		return {};
+	}
+
+	std::vector<std::shared_ptr<ArchiveEntry>> entriesInDirectory(getEntriesInDirectory(archiveSubdirectory, includeSubdirectories, caseSensitive));
+	std::vector<std::pair<std::shared_ptr<ArchiveEntry>, std::string>> entriesToExtract;
+	entriesToExtract.reserve(entriesInDirectory.size());
+
+	for(const std::shared_ptr<ArchiveEntry> & entry : entriesInDirectory) {
+		entriesToExtract.emplace_back(entry, Utilities::joinPaths(destinationDirectoryPath, relativeToSubdirectory ? entry->getPath().substr(archiveSubdirectory.length()) : entry->getPath()));
+	}
+
+	return extractEntriesParallel(entriesToExtract, overwrite, numberOfThreads, progressCallback);
+}
+
+std::unique_ptr<Archive::ConcurrentEntryReader> Archive::createConcurrentEntryReader() const {
+	return nullptr;
+}
+
+std::vector<Archive::ExtractionResult> Archive::extractEntriesParallel(const std::vector<std::pair<std::shared_ptr<ArchiveEntry>, std::string>> & entries, bool overwrite, uint32_t numberOfThreads, const ExtractionProgressCallback & progressCallback) {
+	std::vector<ExtractionResult> extractionResults;
+	extractionResults.reserve(entries.size());
+
+	std::vector<size_t> fileEntryIndices;
+	std::set<std::string> directoryPaths;
+
+	for(const std::pair<std::shared_ptr<ArchiveEntry>, std::string> & entry : entries) {
+		std::string destinationPath(Utilities::replaceAll(Utilities::replaceAll(entry.second, "\\", "/"), "//", "/"));
+
+		if(entry.first->isDirectory()) {
+			directoryPaths.insert(destinationPath);
+		}
+		else if(entry.first->isFile()) {
+			directoryPaths.insert(std::string(Utilities::getBasePath(destinationPath)));
+			fileEntryIndices.push_back(extractionResults.size());
+		}
+
+		extractionResults.push_back({ entry.first, destinationPath, entry.first->isDirectory() ? ExtractionStatus::Extracted : ExtractionStatus::Cancelled });
+	}
+
+	std::atomic<bool> cancelled(false);
+	std::mutex progressMutex;
+	size_t numberOfProcessedEntries = 0;
+
+	std::function<void (ExtractionResult &)> reportProgress([&cancelled, &progressMutex, &numberOfProcessedEntries, &progressCallback, &entries](ExtractionResult & extractionResult) {
+		std::lock_guard<std::mutex> lock(progressMutex);
+
+		numberOfProcessedEntries++;
+
+		if(progressCallback != nullptr && !progressCallback(*extractionResult.entry, extractionResult.status, numberOfProcessedEntries, entries.size())) {
+			cancelled = true;
+		}
+	});
+
+	// directories are created up front so that workers never race to create the same parent directory
+	std::error_code errorCode;
+
+	for(const std::string & directoryPath : directoryPaths) {
+		if(directoryPath.empty() || std::filesystem::is_directory(std::filesystem::path(directoryPath))) {
+			continue;
+		}
+
+		std::filesystem::create_directories(std::filesystem::path(directoryPath), errorCode);
+
+		if(errorCode) {
+			spdlog::error("Cannot extract files from archive, directory '{}' creation failed: {}", directoryPath, errorCode.message());
+
+			for(ExtractionResult & extractionResult : extractionResults) {
+				extractionResult.status = ExtractionStatus::Failed;
+			}
+
+			return extractionResults;
+		}
+	}
+
+	for(ExtractionResult & extractionResult : extractionResults) {
+		if(extractionResult.entry->isDirectory() && !cancelled) {
+			reportProgress(extractionResult);
+		}
+	}
+
+	if(numberOfThreads == 0) {
+		numberOfThreads = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+
+	numberOfThreads = static_cast<uint32_t>(std::min(static_cast<size_t>(numberOfThreads), std::max(fileEntryIndices.size(), static_cast<size_t>(1))));
+
+	std::atomic<size_t> nextFileEntryIndex(0);
+	std::mutex sharedReaderMutex;
+
+	std::function<void ()> extractFileEntries([this, &extractionResults, &fileEntryIndices, &nextFileEntryIndex, &cancelled, &sharedReaderMutex, &reportProgress, overwrite]() {
+		// each worker streams entries through its own reader so that memory use does not depend on entry sizes, archives which cannot read entries independently fall back to serializing extraction
+		std::unique_ptr<ConcurrentEntryReader> concurrentEntryReader(createConcurrentEntryReader());
+
+		while(true) {
+			size_t fileEntryIndex = nextFileEntryIndex++;
+
+			if(fileEntryIndex >= fileEntryIndices.size()) {
+				break;
+			}
+
+			ExtractionResult & extractionResult = extractionResults[fileEntryIndices[fileEntryIndex]];
+
+			if(cancelled) {
+				continue;
+			}
+
+			if(!overwrite && std::filesystem::is_regular_file(std::filesystem::path(extractionResult.destinationPath))) {
+				spdlog::warn("Skipping extraction of file from archive, destination file '{}' already exists! Did you intend to specify the overwrite flag?", extractionResult.destinationPath);
+
+				extractionResult.status = ExtractionStatus::Skipped;
+				reportProgress(extractionResult);
+
+				continue;
+			}
+
+			bool extracted = false;
+
+			if(concurrentEntryReader != nullptr) {
+				std::unique_ptr<ArchiveEntry::Stream> entryStream(concurrentEntryReader->openEntryStream(*extractionResult.entry));
+
+				if(entryStream == nullptr) {
+					spdlog::error("Failed to open archive entry stream when extracting entry to file: '{}'.", extractionResult.destinationPath);
+				}
+				else {
+					extracted = extractionResult.entry->writeStreamToFile(*entryStream, extractionResult.destinationPath, overwrite);
+				}
+			}
+			else {
+				std::lock_guard<std::mutex> lock(sharedReaderMutex);
+
+				extracted = extractionResult.entry->writeStreamToFile(extractionResult.destinationPath, overwrite);
+			}
+
+			if(!extracted) {
+				spdlog::error("Failed to write archive entry data to file: '{}'.", extractionResult.destinationPath);
+				extractionResult.status = ExtractionStatus::Failed;
+			}
+			else {
+				extractionResult.status = ExtractionStatus::Extracted;
+			}
+
+			reportProgress(extractionResult);
+		}
+	});
+
+	std::vector<std::thread> workerThreads;
+
+	for(uint32_t i = 1; i < numberOfThreads; i++) {
+		workerThreads.emplace_back(extractFileEntries);
+	}
+
+	extractFileEntries();
+
+	for(std::thread & workerThread : workerThreads) {
+		workerThread.join();
+	}
+
+	return extractionResults;
+}
+
+void Archive::invalidateEntryIndex() {
+	std::lock_guard<std::mutex> lock(m_entryIndexMutex);
+
+	m_entryIndex.reset();
+}
+
+std::shared_ptr<const Archive::EntryIndex> Archive::getEntryIndex() const {
+	std::lock_guard<std::mutex> lock(m_entryIndexMutex);
+
+	if(m_entryIndex != nullptr) {
+		return m_entryIndex;
+	}
+
+	std::shared_ptr<EntryIndex> entryIndex(std::make_shared<EntryIndex>());
+	entryIndex->entries = getEntries();
+
+	size_t numberOfEntries = entryIndex->entries.size();
+	entryIndex->paths.resize(numberOfEntries);
+	entryIndex->names.resize(numberOfEntries);
+	entryIndex->basePaths.resize(numberOfEntries);
+	entryIndex->parentPaths.resize(numberOfEntries);
+
+	for(size_t i = 0; i < numberOfEntries; i++) {
+		const std::shared_ptr<ArchiveEntry> & entry = entryIndex->entries[i];
+
+		if(entry == nullptr) {
+			continue;
+		}
+
+		std::string entryPath(entry->getPath());
+
+		entryIndex->paths[i] = Utilities::trimTrailingPathSeparator(entryPath);
+		entryIndex->names[i] = Utilities::trimTrailingPathSeparator(entry->getName());
+		entryIndex->basePaths[i] = Utilities::getBasePath(entryPath);
+
+		entryIndex->pathIndices[Utilities::toLowerCase(entryIndex->paths[i])].push_back(i);
+		entryIndex->nameIndices[Utilities::toLowerCase(entryIndex->names[i])].push_back(i);
+		entryIndex->basePathIndices[Utilities::toLowerCase(entryIndex->basePaths[i])].push_back(i);
+
+		size_t firstPathSeparatorIndex = entryPath.find_first_of("/");
+
+		if(firstPathSeparatorIndex != std::string::npos && firstPathSeparatorIndex != entryPath.length() - 1) {
+			entryIndex->parentPaths[i] = Utilities::addTrailingPathSeparator(Utilities::getFilePath(entryIndex->paths[i]));
+			entryIndex->parentPathIndices[Utilities::toLowerCase(entryIndex->parentPaths[i])].push_back(i);
+		}
+	}
+
+	m_entryIndex = entryIndex;
+
+	return m_entryIndex;
+}
+
 void Archive::updateParentArchive() {
 	std::shared_ptr<ArchiveEntry> currentArchiveEntry;
 
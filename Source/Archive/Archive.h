@@ -6,8 +6,14 @@
 #include "Utilities/StringUtilities.h"
 
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 class ArchiveFactoryRegistry;
@@ -25,6 +31,29 @@ public:
 		Zip
 	};
 
+	enum class ExtractionStatus : uint8_t {
+		Extracted,
+		Skipped,
+		Failed,
+		Cancelled
+	};
+
+	struct ExtractionResult {
+		std::shared_ptr<ArchiveEntry> entry;
+		std::string destinationPath;
+		ExtractionStatus status = ExtractionStatus::Cancelled;
+	};
+
+	// returning false from the progress callback cancels any entries which have not yet been started
+	using ExtractionProgressCallback = std::function<bool (const ArchiveEntry & entry, ExtractionStatus status, size_t numberOfProcessedEntries, size_t totalNumberOfEntries)>;
+
+	class ConcurrentEntryReader {
+	public:
+		virtual ~ConcurrentEntryReader();
+
+		virtual std::unique_ptr<ArchiveEntry::Stream> openEntryStream(const ArchiveEntry & entry) = 0;
+	};
+
 	Archive(Type type);
 	Archive(Archive && a) noexcept;
 	Archive(const Archive & a);
@@ -80,14 +109,37 @@ public:
 	std::vector<std::shared_ptr<ArchiveEntry>> extractAllEntriesWithExtensions(const std::vector<std::string> & extension, const std::string & directory, bool overwrite = false, bool includeSubdirectories = true, bool caseSensitive = false) const;
 	size_t extractAllEntries(const std::string & destinationDirectoryPath, bool includeSubdirectories = true, bool overwrite = false);
 	size_t extractAllEntriesInSubdirectory(const std::string & destionationDirectoryPath, const std::string & archiveSubdirectory, bool relativeToSubdirectory = true, bool includeSubdirectories = true, bool overwrite = false, bool caseSensitive = false);
+	std::vector<ExtractionResult> extractAllEntriesParallel(const std::string & destinationDirectoryPath, bool includeSubdirectories = true, bool overwrite = false, uint32_t numberOfThreads = 0, const ExtractionProgressCallback & progressCallback = nullptr);
+	std::vector<ExtractionResult> extractAllEntriesInSubdirectoryParallel(const std::string & destinationDirectoryPath, const std::string & archiveSubdirectory, bool relativeToSubdirectory = true, bool includeSubdirectories = true, bool overwrite = false, bool caseSensitive = false, uint32_t numberOfThreads = 0, const ExtractionProgressCallback & progressCallback = nullptr);
+	virtual std::unique_ptr<ConcurrentEntryReader> createConcurrentEntryReader() const;
 	void updateParentArchive();
 	virtual std::string toDebugString(bool includeDate = false) const = 0;
 
 protected:
 	virtual void setFilePath(const std::string & filePath) = 0;
+	void invalidateEntryIndex();
 
 private:
+	struct EntryIndex {
+		std::vector<std::shared_ptr<ArchiveEntry>> entries;
+		std::vector<std::string> paths;
+		std::vector<std::string> names;
+		std::vector<std::string> basePaths;
+		std::vector<std::string> parentPaths;
+		std::unordered_map<std::string, std::vector<size_t>> pathIndices;
+		std::unordered_map<std::string, std::vector<size_t>> nameIndices;
+		std::map<std::string, std::vector<size_t>> basePathIndices;
+		std::map<std::string, std::vector<size_t>> parentPathIndices;
+	};
+
+	std::shared_ptr<const EntryIndex> getEntryIndex() const;
+	std::vector<std::shared_ptr<ArchiveEntry>> getChildEntries(const ArchiveEntry & directory, bool includeSubdirectories, bool caseSensitive) const;
+	static std::vector<size_t> findDirectoryEntryIndices(const std::map<std::string, std::vector<size_t>> & directoryIndices, const std::vector<std::string> & directoryPaths, std::string_view directoryPath, bool includeSubdirectories, bool caseSensitive);
+	std::vector<ExtractionResult> extractEntriesParallel(const std::vector<std::pair<std::shared_ptr<ArchiveEntry>, std::string>> & entries, bool overwrite, uint32_t numberOfThreads, const ExtractionProgressCallback & progressCallback);
+
 	Type m_type;
+	mutable std::shared_ptr<const EntryIndex> m_entryIndex;
+	mutable std::mutex m_entryIndexMutex;
 };
 
 #endif // _ARCHIVE_H_
@@ -4,6 +4,59 @@
 #include "Utilities/FileUtilities.h"
 #include "Utilities/StringUtilities.h"
 
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+const size_t ArchiveEntry::STREAM_BUFFER_SIZE = 128 * 1024;
+
+ArchiveEntry::Stream::~Stream() { }
+
+bool ArchiveEntry::Stream::isAtEnd() const {
+	return getOffset() >= getSize();
+}
+
+ArchiveEntry::BufferStream::BufferStream(std::unique_ptr<ByteBuffer> data)
+	: m_data(std::move(data))
+	, m_rawData(m_data->getRawData())
+	, m_size(m_data->getSize())
+	, m_offset(0) { }
+
+ArchiveEntry::BufferStream::BufferStream(const uint8_t * data, size_t size)
+	: m_rawData(data)
+	, m_size(size)
+	, m_offset(0) { }
+
+ArchiveEntry::BufferStream::~BufferStream() { }
+
+uint64_t ArchiveEntry::BufferStream::getSize() const {
+	return m_size;
+}
+
+uint64_t ArchiveEntry::BufferStream::getOffset() const {
+	return m_offset;
+}
+
+std::optional<size_t> ArchiveEntry::BufferStream::read(uint8_t * data, size_t size) {
+	size_t numberOfBytesToRead = std::min(size, m_size - m_offset);
+
+	if(numberOfBytesToRead == 0) {
+		return 0;
+	}
+
+	if(data == nullptr) {
+		return {};
+	}
+
+	std::memcpy(data, m_rawData + m_offset, numberOfBytesToRead);
+	m_offset += numberOfBytesToRead;
+
+	return numberOfBytesToRead;
+}
+
 ArchiveEntry::ArchiveEntry() { }
 
 ArchiveEntry::~ArchiveEntry() { }
@@ -71,50 +124,98 @@ std::vector<std::shared_ptr<ArchiveEntry>> ArchiveEntry::getChildren(bool includ
 		return {};
 	}
 
-	std::vector<std::shared_ptr<ArchiveEntry>> children;
-	const std::vector<std::shared_ptr<ArchiveEntry>> & entries = getParentArchive()->getEntries();
+	return getParentArchive()->getChildEntries(*this, includeSubdirectories, caseSensitive);
+}
 
-	for(std::vector<std::shared_ptr<ArchiveEntry>>::const_iterator i = entries.begin(); i != entries.end(); ++i) {
-		if(*i == nullptr || (*i).get() == this) {
-			continue;
-		}
+std::unique_ptr<ArchiveEntry::Stream> ArchiveEntry::openStream() const {
+	// archives without an incremental decoder fall back to exposing the fully decompressed entry data
+	std::unique_ptr<ByteBuffer> data(getData());
 
-		const std::string & currentPath = (*i)->getPath();
-		size_t firstPathSeparatorIndex = currentPath.find_first_of("/");
+	if(data == nullptr) {
+		return nullptr;
+	}
 
-		std::string entryBasePath;
+	return std::make_unique<BufferStream>(std::move(data));
+}
 
-		if(firstPathSeparatorIndex != std::string::npos && firstPathSeparatorIndex != currentPath.length() - 1) {
-			entryBasePath = Utilities::addTrailingPathSeparator(Utilities::getFilePath(Utilities::trimTrailingPathSeparator(currentPath)));
-		}
+bool ArchiveEntry::writeToDirectory(const std::string & directoryPath, bool overwrite) {
+	return writeToFile(Utilities::joinPaths(directoryPath, getPath()), overwrite);
+}
 
-		if(entryBasePath.empty()) {
-			continue;
-		}
+bool ArchiveEntry::writeStreamToFile(const std::string & filePath, bool overwrite) const {
+	if(!isParentArchiveValid() || !isFile()) {
+		return false;
+	}
+
+	std::unique_ptr<Stream> stream(openStream());
+
+	if(stream == nullptr) {
+		spdlog::error("Failed to open archive entry '{}' stream when writing entry to file: '{}'.", getPath(), filePath);
+		return false;
+	}
+
+	return writeStreamToFile(*stream, filePath, overwrite);
+}
+
+bool ArchiveEntry::writeStreamToFile(Stream & stream, const std::string & filePath, bool overwrite) const {
+	// a single buffer per thread is reused for every copy, so memory use does not depend on the entry size
+	thread_local std::vector<uint8_t> s_streamBuffer(STREAM_BUFFER_SIZE);
+
+	std::string formattedDestinationFilePath(Utilities::replaceAll(Utilities::replaceAll(filePath, "\\", "/"), "//", "/"));
+
+	if(filePath != formattedDestinationFilePath) {
+		spdlog::debug("Updating archive entry file extraction path from '{}' to '{}'.", filePath, formattedDestinationFilePath);
+	}
+
+	std::filesystem::path destinationFilePath(formattedDestinationFilePath);
+
+	if(!overwrite && std::filesystem::exists(destinationFilePath)) {
+		return false;
+	}
+
+	std::error_code errorCode;
+	Utilities::createDirectoryStructureForFilePath(formattedDestinationFilePath, errorCode);
 
-		std::string path(getPath());
+	if(errorCode) {
+		spdlog::error("Failed to create archive entry extraction destination directory structure for file path '{}': {}", formattedDestinationFilePath, errorCode.message());
+		return false;
+	}
+
+	std::ofstream fileStream(destinationFilePath, std::ios::binary | std::ios::trunc);
+
+	if(!fileStream.is_open()) {
+		spdlog::error("Failed to open archive entry extraction destination file for writing: '{}'.", formattedDestinationFilePath);
+		return false;
+	}
 
-		if(includeSubdirectories) {
-			if(entryBasePath.length() < path.length()) {
-				continue;
-			}
+	while(true) {
+		std::optional<size_t> optionalNumberOfBytesRead(stream.read(s_streamBuffer.data(), s_streamBuffer.size()));
+
+		if(!optionalNumberOfBytesRead.has_value()) {
+			spdlog::error("Failed to read archive entry '{}' data at offset {} of {}.", getPath(), stream.getOffset(), stream.getSize());
+			break;
+		}
 
-			if(Utilities::areStringsEqual(std::string_view(entryBasePath.data(), path.length()), path, caseSensitive)) {
-				children.push_back(*i);
-			}
+		if(optionalNumberOfBytesRead.value() == 0) {
+			break;
 		}
-		else {
-			if(Utilities::areStringsEqual(entryBasePath, path, caseSensitive)) {
-				children.push_back(*i);
-			}
+
+		fileStream.write(reinterpret_cast<const char *>(s_streamBuffer.data()), optionalNumberOfBytesRead.value());
+
+		if(fileStream.fail()) {
+			spdlog::error("Failed to write archive entry '{}' data to file: '{}'.", getPath(), formattedDestinationFilePath);
+			break;
 		}
 	}
 
-	return children;
-}
+	fileStream.close();
 
-bool ArchiveEntry::writeToDirectory(const std::string & directoryPath, bool overwrite) {
-	return writeToFile(Utilities::joinPaths(directoryPath, getPath()), overwrite);
+	if(!stream.isAtEnd() || fileStream.fail()) {
+		std::filesystem::remove(destinationFilePath, errorCode);
+		return false;
+	}
+
+	return true;
 }
 
 bool ArchiveEntry::hasComment() const {
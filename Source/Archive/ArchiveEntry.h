@@ -6,6 +6,7 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,17 @@ class ArchiveEntry {
 	friend class Archive;
 
 public:
+	class Stream {
+	public:
+		virtual ~Stream();
+
+		virtual uint64_t getSize() const = 0;
+		virtual uint64_t getOffset() const = 0;
+		bool isAtEnd() const;
+		// returns the number of bytes read, which is zero at the end of the entry, or no value if an error occurred
+		virtual std::optional<size_t> read(uint8_t * data, size_t size) = 0;
+	};
+
 	ArchiveEntry();
 	virtual ~ArchiveEntry();
 
@@ -35,13 +47,40 @@ public:
 	virtual uint64_t getCompressedSize() const = 0;
 	virtual uint64_t getUncompressedSize() const = 0;
 	virtual std::unique_ptr<ByteBuffer> getData() const = 0;
+	// the stream may read the entry data in place, so it must not outlive the entry or be used after the entry is modified
+	virtual std::unique_ptr<Stream> openStream() const;
 	virtual uint32_t getCRC32() const = 0;
 	bool writeToDirectory(const std::string & directoryPath, bool overwrite = false);
 	virtual bool writeToFile(const std::string & filePath, bool overwrite = false) = 0;
 
 	static bool isDirectory(std::string_view path);
 
+	static const size_t STREAM_BUFFER_SIZE;
+
 protected:
+	class BufferStream final : public Stream {
+	public:
+		BufferStream(std::unique_ptr<ByteBuffer> data);
+		BufferStream(const uint8_t * data, size_t size);
+		~BufferStream() override;
+
+		// Stream Virtuals
+		uint64_t getSize() const override;
+		uint64_t getOffset() const override;
+		std::optional<size_t> read(uint8_t * data, size_t size) override;
+
+	private:
+		std::unique_ptr<ByteBuffer> m_data;
+		const uint8_t * m_rawData;
+		size_t m_size;
+		size_t m_offset;
+
+		BufferStream(const BufferStream &) = delete;
+		const BufferStream & operator = (const BufferStream &) = delete;
+	};
+
+	bool writeStreamToFile(const std::string & filePath, bool overwrite) const;
+	bool writeStreamToFile(Stream & stream, const std::string & filePath, bool overwrite) const;
 	virtual bool isParentArchiveValid() const;
 	virtual Archive * getParentArchive() const = 0;
 	virtual bool setParentArchive(Archive * archive) = 0;
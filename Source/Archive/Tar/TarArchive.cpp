@@ -193,7 +193,14 @@ std::unique_ptr<TarArchive> TarArchive::readFrom(const std::string & filePath) {
 		return nullptr;
 	}
 
-	std::unique_ptr<TarArchive> tarArchive(createFrom(ByteBuffer::readFrom(filePath)));
+	std::unique_ptr<StreamReader> reader(StreamReader::openFile(filePath));
+
+	if(reader == nullptr) {
+		return nullptr;
+	}
+
+	// only the entry headers are read up front, entry data is read from the file on demand using the recorded offsets
+	std::unique_ptr<TarArchive> tarArchive(parseEntries(*reader, false));
 
 	if(tarArchive == nullptr) {
 		return nullptr;
@@ -237,9 +244,65 @@ std::unique_ptr<TarArchive> TarArchive::createFrom(std::unique_ptr<ByteBuffer> d
 	return tarArchive;
 }
 
+std::unique_ptr<TarArchive> TarArchive::createFrom(StreamReader & reader) {
+	return parseEntries(reader, true);
+}
+
+std::unique_ptr<TarArchive> TarArchive::parseEntries(StreamReader & reader, bool loadData) {
+	std::unique_ptr<TarArchive> tarArchive(new TarArchive());
+
+	while(true) {
+		std::shared_ptr<Entry> tarEntry(reader.nextEntry());
+
+		if(tarEntry == nullptr) {
+			break;
+		}
+
+		if(tarEntry->isFile()) {
+			if(loadData) {
+				tarEntry->m_data = reader.readDataBytes();
+
+				if(tarEntry->m_data == nullptr) {
+					return nullptr;
+				}
+			}
+			else {
+				tarEntry->m_dataOffset = reader.getOffset();
+			}
+		}
+
+		tarEntry->m_parentArchive = tarArchive.get();
+
+		if(tarEntry->isDirectory()) {
+			tarArchive->m_numberOfDirectories++;
+		}
+		else {
+			tarArchive->m_numberOfFiles++;
+		}
+
+		tarArchive->m_entries.push_back(tarEntry);
+	}
+
+	if(reader.hasFailed() || reader.getOffset() == 0) {
+		return nullptr;
+	}
+
+	return tarArchive;
+}
+
 std::vector<std::shared_ptr<ArchiveEntry>> TarArchive::getEntries() const {
 	std::vector<std::shared_ptr<ArchiveEntry>> entries(m_entries.size());
 	std::copy(std::begin(m_entries), std::end(m_entries), std::begin(entries));
 
 	return entries;
 }
+
+std::unique_ptr<Archive::ConcurrentEntryReader> TarArchive::createConcurrentEntryReader() const {
+	return std::make_unique<ConcurrentReader>();
+}
+
+TarArchive::ConcurrentReader::~ConcurrentReader() { }
+
+std::unique_ptr<ArchiveEntry::Stream> TarArchive::ConcurrentReader::openEntryStream(const ArchiveEntry & entry) {
+	return entry.openStream();
+}
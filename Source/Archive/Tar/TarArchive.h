@@ -2,8 +2,13 @@
 #define _TAR_ARCHIVE_H_
 
 #include "Archive/Archive.h"
+#include "Compression/CompressionStream.h"
 
+#include <fstream>
 #include <functional>
+#include <optional>
+
+class ByteBufferView;
 
 class TarArchive : public Archive {
 	friend class Entry;
@@ -28,6 +33,7 @@ public:
 		uint64_t getCompressedSize() const override;
 		uint64_t getUncompressedSize() const override;
 		std::unique_ptr<ByteBuffer> getData() const override;
+		std::unique_ptr<Stream> openStream() const override;
 		uint32_t getCRC32() const override;
 		bool writeToFile(const std::string & filePath, bool overwrite = false) override;
 
@@ -55,10 +61,33 @@ public:
 		bool setParentArchive(Archive * archive) override;
 
 		static std::unique_ptr<Entry> parseFrom(const ByteBuffer & data);
+		static std::unique_ptr<Entry> parseHeaderFrom(const ByteBufferView & data);
 
 	private:
+		class FileStream final : public Stream {
+		public:
+			FileStream(std::unique_ptr<std::ifstream> fileStream, uint64_t size, const std::string & path);
+			~FileStream() override;
+
+			// Stream Virtuals
+			uint64_t getSize() const override;
+			uint64_t getOffset() const override;
+			std::optional<size_t> read(uint8_t * data, size_t size) override;
+
+		private:
+			std::unique_ptr<std::ifstream> m_fileStream;
+			uint64_t m_size;
+			uint64_t m_offset;
+			std::string m_path;
+
+			FileStream(const FileStream &) = delete;
+			const FileStream & operator = (const FileStream &) = delete;
+		};
+
 		Entry();
 
+		std::unique_ptr<std::ifstream> openDataFileStream() const;
+
 		uint64_t m_index;
 		std::string m_entryPath;
 		uint32_t m_fileMode = 0;
@@ -78,6 +107,7 @@ public:
 		std::string m_fileNamePrefix;
 		std::unique_ptr<std::array<uint8_t, 12>> m_padding;
 		std::unique_ptr<std::vector<uint8_t>> m_data;
+		std::optional<uint64_t> m_dataOffset;
 		TarArchive * m_parentArchive;
 
 		static const uint16_t DEFAULT_USTAR_VERSION;
@@ -94,6 +124,87 @@ public:
 		static const uint8_t EXTENDED_HEADER_WITH_METADATA_FOR_NEXT_FILE_FLAG;
 	};
 
+	// forward-only reader which parses entry headers from uncompressed or compressed tar data without holding the archive in memory
+	class StreamReader final {
+		friend class TarArchive;
+
+	public:
+		~StreamReader();
+
+		bool isCompressed() const;
+		bool isAtEnd() const;
+		bool hasFailed() const;
+		uint64_t getOffset() const;
+		std::shared_ptr<Entry> getCurrentEntry() const;
+		// skips any unread data belonging to the current entry, returns null at the end of the archive or if an error occurred
+		std::shared_ptr<Entry> nextEntry();
+		// scans forward from the current position, the reader must be re-opened to search entries which have already been passed
+		std::shared_ptr<Entry> findEntry(const std::string & entryPath, bool caseSensitive = false);
+		uint64_t numberOfRemainingDataBytes() const;
+		std::optional<size_t> readData(uint8_t * data, size_t size);
+		std::unique_ptr<ByteBuffer> readData();
+		bool skipData();
+		bool extractData(const std::string & filePath, bool overwrite = false);
+
+		static std::unique_ptr<StreamReader> openFile(const std::string & filePath, std::optional<ByteBuffer::CompressionMethod> compressionMethod = {});
+		// the data must remain valid for the lifetime of the reader
+		static std::unique_ptr<StreamReader> createFrom(const ByteBuffer & data, std::optional<ByteBuffer::CompressionMethod> compressionMethod = {});
+		static std::unique_ptr<StreamReader> createFrom(CompressionStream::InputCallback inputCallback, std::optional<ByteBuffer::CompressionMethod> compressionMethod = {});
+
+		static const size_t INPUT_CHUNK_SIZE;
+
+	private:
+		class DataStream final : public ArchiveEntry::Stream {
+		public:
+			DataStream(StreamReader & reader);
+			~DataStream() override;
+
+			// Stream Virtuals
+			uint64_t getSize() const override;
+			uint64_t getOffset() const override;
+			std::optional<size_t> read(uint8_t * data, size_t size) override;
+
+		private:
+			StreamReader & m_reader;
+			uint64_t m_size;
+
+			DataStream(const DataStream &) = delete;
+			const DataStream & operator = (const DataStream &) = delete;
+		};
+
+		StreamReader(CompressionStream::InputCallback inputCallback, std::unique_ptr<std::ifstream> fileStream = nullptr, uint64_t fileSize = 0);
+
+		bool initialize(std::optional<ByteBuffer::CompressionMethod> compressionMethod);
+		size_t numberOfBufferedBytes() const;
+		bool fillBuffer(size_t size);
+		bool readInput();
+		bool skipBytes(uint64_t size);
+		std::unique_ptr<std::vector<uint8_t>> readDataBytes();
+
+		CompressionStream::InputCallback m_inputCallback;
+		std::unique_ptr<std::ifstream> m_fileStream;
+		uint64_t m_fileSize;
+		std::unique_ptr<CompressionStream> m_decompressionStream;
+		std::vector<uint8_t> m_inputBuffer;
+		size_t m_inputBufferOffset;
+		size_t m_inputBufferSize;
+		std::vector<uint8_t> m_buffer;
+		size_t m_bufferOffset;
+		uint64_t m_numberOfBytesToDiscard;
+		uint64_t m_offset;
+		uint64_t m_remainingDataSize;
+		uint64_t m_remainingPaddingSize;
+		uint64_t m_entryIndex;
+		uint8_t m_numberOfEmptyHeaders;
+		std::shared_ptr<Entry> m_currentEntry;
+		bool m_inputEnded;
+		bool m_atEnd;
+		bool m_failed;
+
+		StreamReader(const StreamReader &) = delete;
+		const StreamReader & operator = (const StreamReader &) = delete;
+	};
+
 	TarArchive(TarArchive && t) noexcept;
 	TarArchive(const TarArchive & t);
 	TarArchive & operator = (TarArchive && t) noexcept;
@@ -109,21 +220,34 @@ public:
 	size_t numberOfFiles() const override;
 	size_t numberOfDirectories() const override;
 	std::vector<std::shared_ptr<ArchiveEntry>> getEntries() const override;
+	std::unique_ptr<ConcurrentEntryReader> createConcurrentEntryReader() const override;
 	std::string toDebugString(bool includeDate = false) const override;
 
 	static bool isTarArchive(const std::string & filePath);
 	static bool isTarArchive(const ByteBuffer & data);
 	static std::unique_ptr<TarArchive> readFrom(const std::string & filePath);
 	static std::unique_ptr<TarArchive> createFrom(std::unique_ptr<ByteBuffer> data);
+	static std::unique_ptr<TarArchive> createFrom(StreamReader & reader);
 
 	static const std::string DEFAULT_FILE_EXTENSION;
 
 protected:
+	// entry data is either copied out of memory or read through a file stream opened for each read, so it can be read from any number of threads at once
+	class ConcurrentReader final : public ConcurrentEntryReader {
+	public:
+		~ConcurrentReader() override;
+
+		// ConcurrentEntryReader Virtuals
+		std::unique_ptr<ArchiveEntry::Stream> openEntryStream(const ArchiveEntry & entry) override;
+	};
+
 	// Archive Virtuals
 	void setFilePath(const std::string & filePath) override;
 
 	TarArchive(const std::string & filePath = {});
 
+	static std::unique_ptr<TarArchive> parseEntries(StreamReader & reader, bool loadData);
+
 	std::vector<std::shared_ptr<Entry>> m_entries;
 	size_t m_numberOfFiles;
 	size_t m_numberOfDirectories;
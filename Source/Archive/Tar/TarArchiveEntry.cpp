@@ -1,12 +1,15 @@
 #include "TarArchive.h"
 
+#include "ByteBufferView.h"
 #include "TarUtilities.h"
 #include "Utilities/FileUtilities.h"
 #include "Utilities/StringUtilities.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 
 static constexpr uint16_t TAR_BLOCK_SIZE = 512;
 
@@ -48,6 +51,7 @@ TarArchive::Entry::Entry(TarArchive::Entry && e) noexcept
 	, m_fileNamePrefix(std::move(e.m_fileNamePrefix))
 	, m_padding(std::move(e.m_padding))
 	, m_data(std::move(e.m_data))
+	, m_dataOffset(e.m_dataOffset)
 	, m_parentArchive(nullptr) { }
 
 TarArchive::Entry::Entry(const TarArchive::Entry & e)
@@ -70,7 +74,8 @@ TarArchive::Entry::Entry(const TarArchive::Entry & e)
 	, m_deviceMinorNumber(e.m_deviceMinorNumber)
 	, m_fileNamePrefix(e.m_fileNamePrefix)
 	, m_padding(std::make_unique<std::array<uint8_t, 12>>(*e.m_padding))
-	, m_data(std::make_unique<std::vector<uint8_t>>(*e.m_data))
+	, m_data(e.m_data != nullptr ? std::make_unique<std::vector<uint8_t>>(*e.m_data) : nullptr)
+	, m_dataOffset(e.m_dataOffset)
 	, m_parentArchive(nullptr) { }
 
 TarArchive::Entry & TarArchive::Entry::operator = (TarArchive::Entry && e) noexcept {
@@ -96,6 +101,7 @@ TarArchive::Entry & TarArchive::Entry::operator = (TarArchive::Entry && e) noexc
 		m_fileNamePrefix = std::move(e.m_fileNamePrefix);
 		m_padding = std::move(e.m_padding);
 		m_data = std::move(e.m_data);
+		m_dataOffset = e.m_dataOffset;
 	}
 
 	return *this;
@@ -122,7 +128,8 @@ TarArchive::Entry & TarArchive::Entry::operator = (const TarArchive::Entry & e)
 	m_deviceMinorNumber = e.m_deviceMinorNumber;
 	m_fileNamePrefix = e.m_fileNamePrefix;
 	m_padding = std::make_unique<std::array<uint8_t, 12>>(*e.m_padding);
-	m_data = std::make_unique<std::vector<uint8_t>>(*e.m_data);
+	m_data = e.m_data != nullptr ? std::make_unique<std::vector<uint8_t>>(*e.m_data) : nullptr;
+	m_dataOffset = e.m_dataOffset;
 
 	return *this;
 }
@@ -166,32 +173,82 @@ std::unique_ptr<ByteBuffer> TarArchive::Entry::getData() const {
 		return nullptr;
 	}
 
-	return std::make_unique<ByteBuffer>(*m_data);
+	if(m_data != nullptr) {
+		return std::make_unique<ByteBuffer>(*m_data);
+	}
+
+	std::unique_ptr<std::ifstream> fileStream(openDataFileStream());
+
+	if(fileStream == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<ByteBuffer> data(std::make_unique<ByteBuffer>(m_fileSize));
+	data->resize(m_fileSize);
+
+	fileStream->read(reinterpret_cast<char *>(data->getRawData()), m_fileSize);
+
+	if(fileStream->fail()) {
+		spdlog::error("Failed to read {} bytes of tar entry data from '{}' for entry: '{}'.", m_fileSize, m_parentArchive->m_filePath, m_entryPath);
+		return nullptr;
+	}
+
+	return data;
 }
 
-uint32_t TarArchive::Entry::getCRC32() const {
-	return m_checksum;
+std::unique_ptr<ArchiveEntry::Stream> TarArchive::Entry::openStream() const {
+	if(isDirectory()) {
+		return nullptr;
+	}
+
+	if(m_data != nullptr) {
+		// entry data is already held in memory, so it is streamed in place rather than copied
+		return std::make_unique<BufferStream>(m_data->data(), m_data->size());
+	}
+
+	std::unique_ptr<std::ifstream> fileStream(openDataFileStream());
+
+	if(fileStream == nullptr) {
+		return nullptr;
+	}
+
+	return std::make_unique<FileStream>(std::move(fileStream), m_fileSize, m_entryPath);
 }
 
-bool TarArchive::Entry::writeToFile(const std::string & filePath, bool overwrite) {
-	if(!isParentArchiveValid() || isDirectory()) {
-		return false;
+std::unique_ptr<std::ifstream> TarArchive::Entry::openDataFileStream() const {
+	if(!m_dataOffset.has_value() || !isParentArchiveValid() || m_parentArchive->m_filePath.empty()) {
+		spdlog::error("Tar entry data is not available for entry: '{}'.", m_entryPath);
+		return nullptr;
 	}
 
-	std::string formattedDestinationFilePath(Utilities::replaceAll(Utilities::replaceAll(filePath, "\\", "/"), "//", "/"));
+	// each call opens its own file stream, so entries can be read from multiple threads at once
+	std::unique_ptr<std::ifstream> fileStream(std::make_unique<std::ifstream>(m_parentArchive->m_filePath, std::ios::binary));
 
-	if(filePath != formattedDestinationFilePath) {
-		spdlog::debug("Updating tar archive entry file extraction path from '{}' to '{}'.", filePath, formattedDestinationFilePath);
+	if(!fileStream->is_open()) {
+		spdlog::error("Failed to open tar archive file '{}' to read entry: '{}'.", m_parentArchive->m_filePath, m_entryPath);
+		return nullptr;
 	}
 
-	std::unique_ptr<ByteBuffer> data(getData());
+	fileStream->seekg(m_dataOffset.value());
+
+	if(fileStream->fail()) {
+		spdlog::error("Failed to seek to offset {} in tar archive file '{}' for entry: '{}'.", m_dataOffset.value(), m_parentArchive->m_filePath, m_entryPath);
+		return nullptr;
+	}
+
+	return fileStream;
+}
 
-	if(data == nullptr) {
-		spdlog::error("Failed to obtain tar archive entry file data when writing entry to file: '{}'.", filePath);
+uint32_t TarArchive::Entry::getCRC32() const {
+	return m_checksum;
+}
+
+bool TarArchive::Entry::writeToFile(const std::string & filePath, bool overwrite) {
+	if(!isParentArchiveValid() || isDirectory()) {
 		return false;
 	}
 
-	return data->writeTo(filePath, overwrite);
+	return writeStreamToFile(filePath, overwrite);
 }
 
 uint32_t TarArchive::Entry::getFileMode() const {
@@ -293,19 +350,49 @@ std::string TarArchive::Entry::fileTypeToString(uint8_t fileTypeFlag) {
 }
 
 std::unique_ptr<TarArchive::Entry> TarArchive::Entry::parseFrom(const ByteBuffer & data) {
+	if(data.getReadOffset() % TAR_BLOCK_SIZE != 0) {
+		spdlog::warn("Tar data is corrupted, data read offset of {} is not aligned to {} byte block.", data.getReadOffset(), TAR_BLOCK_SIZE);
+	}
+
+	// parse the header in place rather than copying each of its fields out of the buffer
+	std::unique_ptr<Entry> tarEntry(parseHeaderFrom(ByteBufferView(data.getRawData() + data.getReadOffset(), data.numberOfBytesRemaining(), data.getEndianness())));
+
+	if(tarEntry == nullptr) {
+		return nullptr;
+	}
+
+	data.skipReadBytes(TAR_BLOCK_SIZE);
+
+	if(tarEntry->isFile()) {
+		size_t dataPadding = (TAR_BLOCK_SIZE - (tarEntry->m_fileSize % TAR_BLOCK_SIZE));
+
+		tarEntry->m_data = data.readBytes(tarEntry->m_fileSize);
+
+		if(tarEntry->m_data == nullptr) {
+			spdlog::error("Failed to read '{}' bytes for tar {} entry: '{}'.", tarEntry->m_fileSize, tarEntry->isDirectory() ? "directory" : "file", tarEntry->m_entryPath);
+			return nullptr;
+		}
+
+		if(dataPadding != 512) {
+			if(!data.skipReadBytes(dataPadding)) {
+				return nullptr;
+			}
+		}
+	}
+
+	return tarEntry;
+}
+
+std::unique_ptr<TarArchive::Entry> TarArchive::Entry::parseHeaderFrom(const ByteBufferView & data) {
 	static constexpr uint16_t CHECKSUM_OFFSET = 148;
 	static constexpr uint16_t CHECKSUM_SIZE = 8;
 	static constexpr uint8_t EMPTY_CHECKSUM_BYTE = ' ';
 
 	if(!data.canReadBytes(TAR_BLOCK_SIZE)) {
-		spdlog::error("Tar data is truncated, missing entry header data. Expected at least {} bytes, but found only {} bytes.", TAR_BLOCK_SIZE, data.getSize() - data.getReadOffset());
+		spdlog::error("Tar data is truncated, missing entry header data. Expected at least {} bytes, but found only {} bytes.", TAR_BLOCK_SIZE, data.numberOfBytesRemaining());
 		return {};
 	}
 
-	if(data.getReadOffset() % TAR_BLOCK_SIZE != 0) {
-		spdlog::warn("Tar data is corrupted, data read offset of {} is not aligned to {} byte block.", data.getReadOffset(), TAR_BLOCK_SIZE);
-	}
-
 	size_t entryOffset = data.getReadOffset();
 
 	std::unique_ptr<Entry> tarEntry(new Entry());
@@ -328,28 +415,15 @@ std::unique_ptr<TarArchive::Entry> TarArchive::Entry::parseFrom(const ByteBuffer
 	tarEntry->m_deviceMajorNumber = static_cast<uint32_t>(TarUtilities::parseOctalNumber(data.readString(8, &error)));
 	tarEntry->m_deviceMinorNumber = static_cast<uint32_t>(TarUtilities::parseOctalNumber(data.readString(8, &error)));
 	tarEntry->m_fileNamePrefix = data.readString(155, &error);
-	tarEntry->m_padding = data.readBytes<12>();
 
-	if(error || tarEntry->m_padding == nullptr) {
+	std::optional<std::span<const uint8_t, 12>> optionalPadding(data.readBytes<12>());
+
+	if(error || !optionalPadding.has_value()) {
 		return nullptr;
 	}
 
-	if(tarEntry->isFile()) {
-		size_t dataPadding = (TAR_BLOCK_SIZE - (tarEntry->m_fileSize % TAR_BLOCK_SIZE));
-
-		tarEntry->m_data = data.readBytes(tarEntry->m_fileSize);
-
-		if(error) {
-			spdlog::error("Failed to read '{}' bytes for tar {} entry: '{}'.", tarEntry->m_fileSize, tarEntry->isDirectory() ? "directory" : "file", tarEntry->m_entryPath);
-			return nullptr;
-		}
-
-		if(dataPadding != 512) {
-			if(!data.skipReadBytes(dataPadding)) {
-				return nullptr;
-			}
-		}
-	}
+	tarEntry->m_padding = std::make_unique<std::array<uint8_t, 12>>();
+	std::copy(optionalPadding->begin(), optionalPadding->end(), tarEntry->m_padding->begin());
 
 	if(!tarEntry->m_entryPath.empty()) {
 		uint8_t currentByte = 0;
@@ -397,3 +471,38 @@ bool TarArchive::Entry::setParentArchive(Archive * archive) {
 
 	return true;
 }
+
+TarArchive::Entry::FileStream::FileStream(std::unique_ptr<std::ifstream> fileStream, uint64_t size, const std::string & path)
+	: m_fileStream(std::move(fileStream))
+	, m_size(size)
+	, m_offset(0)
+	, m_path(path) { }
+
+TarArchive::Entry::FileStream::~FileStream() { }
+
+uint64_t TarArchive::Entry::FileStream::getSize() const {
+	return m_size;
+}
+
+uint64_t TarArchive::Entry::FileStream::getOffset() const {
+	return m_offset;
+}
+
+std::optional<size_t> TarArchive::Entry::FileStream::read(uint8_t * data, size_t size) {
+	size_t numberOfBytesToRead = static_cast<size_t>(std::min(static_cast<uint64_t>(size), m_size - m_offset));
+
+	if(numberOfBytesToRead == 0) {
+		return 0;
+	}
+
+	m_fileStream->read(reinterpret_cast<char *>(data), numberOfBytesToRead);
+
+	if(m_fileStream->fail()) {
+		spdlog::error("Failed to read tar entry file data at offset {} of {} for entry: '{}'.", m_offset, m_size, m_path);
+		return {};
+	}
+
+	m_offset += numberOfBytesToRead;
+
+	return numberOfBytesToRead;
+}
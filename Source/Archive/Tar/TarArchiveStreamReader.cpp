@@ -0,0 +1,478 @@
+#include "TarArchive.h"
+
+#include "ByteBufferView.h"
+#include "Utilities/FileUtilities.h"
+#include "Utilities/StringUtilities.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+static constexpr uint16_t TAR_BLOCK_SIZE = 512;
+static constexpr uint8_t NUMBER_OF_END_OF_ARCHIVE_BLOCKS = 2;
+// compressed input is fed to the decompressor in small slices so that highly compressible data cannot expand into an arbitrarily large buffer
+static constexpr size_t DECOMPRESSION_INPUT_SLICE_SIZE = 4 * 1024;
+
+const size_t TarArchive::StreamReader::INPUT_CHUNK_SIZE = 128 * 1024;
+
+TarArchive::StreamReader::StreamReader(CompressionStream::InputCallback inputCallback, std::unique_ptr<std::ifstream> fileStream, uint64_t fileSize)
+	: m_inputCallback(std::move(inputCallback))
+	, m_fileStream(std::move(fileStream))
+	, m_fileSize(fileSize)
+	, m_inputBufferOffset(0)
+	, m_inputBufferSize(0)
+	, m_bufferOffset(0)
+	, m_numberOfBytesToDiscard(0)
+	, m_offset(0)
+	, m_remainingDataSize(0)
+	, m_remainingPaddingSize(0)
+	, m_entryIndex(0)
+	, m_numberOfEmptyHeaders(0)
+	, m_inputEnded(false)
+	, m_atEnd(false)
+	, m_failed(false) { }
+
+TarArchive::StreamReader::~StreamReader() { }
+
+bool TarArchive::StreamReader::initialize(std::optional<ByteBuffer::CompressionMethod> compressionMethod) {
+	if(compressionMethod.has_value()) {
+		m_decompressionStream = CompressionStream::createDecompressionStream(compressionMethod.value(), [this](const uint8_t * data, size_t size) {
+			// data which is being skipped is dropped as it is decompressed rather than buffered
+			size_t numberOfBytesToDiscard = static_cast<size_t>(std::min(m_numberOfBytesToDiscard, static_cast<uint64_t>(size)));
+
+			m_numberOfBytesToDiscard -= numberOfBytesToDiscard;
+			m_buffer.insert(m_buffer.end(), data + numberOfBytesToDiscard, data + size);
+
+			return true;
+		});
+
+		if(m_decompressionStream == nullptr) {
+			return false;
+		}
+
+		m_inputBuffer.resize(INPUT_CHUNK_SIZE);
+	}
+
+	return true;
+}
+
+bool TarArchive::StreamReader::isCompressed() const {
+	return m_decompressionStream != nullptr;
+}
+
+bool TarArchive::StreamReader::isAtEnd() const {
+	return m_atEnd;
+}
+
+bool TarArchive::StreamReader::hasFailed() const {
+	return m_failed;
+}
+
+uint64_t TarArchive::StreamReader::getOffset() const {
+	return m_offset;
+}
+
+std::shared_ptr<TarArchive::Entry> TarArchive::StreamReader::getCurrentEntry() const {
+	return m_currentEntry;
+}
+
+std::shared_ptr<TarArchive::Entry> TarArchive::StreamReader::nextEntry() {
+	if(m_atEnd || m_failed || !skipData()) {
+		return nullptr;
+	}
+
+	m_currentEntry.reset();
+
+	while(true) {
+		if(!fillBuffer(TAR_BLOCK_SIZE)) {
+			if(m_failed) {
+				return nullptr;
+			}
+
+			if(numberOfBufferedBytes() != 0) {
+				spdlog::error("Tar data is truncated, missing entry header data. Expected at least {} bytes, but found only {} bytes.", TAR_BLOCK_SIZE, numberOfBufferedBytes());
+				m_failed = true;
+				return nullptr;
+			}
+
+			if(m_numberOfEmptyHeaders < NUMBER_OF_END_OF_ARCHIVE_BLOCKS) {
+				spdlog::error("Tar data is truncated, reached end of data at offset {} before the end of archive marker.", m_offset);
+				m_failed = true;
+				return nullptr;
+			}
+
+			m_atEnd = true;
+
+			return nullptr;
+		}
+
+		ByteBufferView header(m_buffer.data() + m_bufferOffset, TAR_BLOCK_SIZE);
+
+		m_bufferOffset += TAR_BLOCK_SIZE;
+		m_offset += TAR_BLOCK_SIZE;
+
+		std::shared_ptr<Entry> tarEntry(Entry::parseHeaderFrom(header));
+
+		if(tarEntry == nullptr) {
+			m_failed = true;
+			return nullptr;
+		}
+
+		// empty headers mark the end of the archive and any record padding which follows it
+		if(tarEntry->m_entryPath.empty()) {
+			if(m_numberOfEmptyHeaders < NUMBER_OF_END_OF_ARCHIVE_BLOCKS) {
+				m_numberOfEmptyHeaders++;
+			}
+
+			continue;
+		}
+
+		m_numberOfEmptyHeaders = 0;
+
+		tarEntry->m_index = m_entryIndex++;
+		tarEntry->m_data.reset();
+
+		if(tarEntry->isFile()) {
+			m_remainingDataSize = tarEntry->m_fileSize;
+			m_remainingPaddingSize = tarEntry->m_fileSize % TAR_BLOCK_SIZE == 0 ? 0 : TAR_BLOCK_SIZE - (tarEntry->m_fileSize % TAR_BLOCK_SIZE);
+		}
+
+		m_currentEntry = tarEntry;
+
+		return tarEntry;
+	}
+}
+
+std::shared_ptr<TarArchive::Entry> TarArchive::StreamReader::findEntry(const std::string & entryPath, bool caseSensitive) {
+	std::string_view formattedEntryPath(Utilities::trimTrailingPathSeparator(entryPath));
+
+	while(true) {
+		std::shared_ptr<Entry> tarEntry(nextEntry());
+
+		if(tarEntry == nullptr) {
+			return nullptr;
+		}
+
+		if(Utilities::areStringsEqual(Utilities::trimTrailingPathSeparator(tarEntry->m_entryPath), formattedEntryPath, caseSensitive)) {
+			return tarEntry;
+		}
+	}
+}
+
+uint64_t TarArchive::StreamReader::numberOfRemainingDataBytes() const {
+	return m_remainingDataSize;
+}
+
+std::optional<size_t> TarArchive::StreamReader::readData(uint8_t * data, size_t size) {
+	if(m_failed) {
+		return {};
+	}
+
+	size_t numberOfBytesToRead = static_cast<size_t>(std::min(static_cast<uint64_t>(size), m_remainingDataSize));
+	size_t numberOfBytesRead = 0;
+
+	while(numberOfBytesRead < numberOfBytesToRead) {
+		if(numberOfBufferedBytes() == 0 && !fillBuffer(1)) {
+			if(!m_failed) {
+				spdlog::error("Tar data is truncated, missing {} bytes of data for entry: '{}'.", m_remainingDataSize - numberOfBytesRead, m_currentEntry->m_entryPath);
+				m_failed = true;
+			}
+
+			return {};
+		}
+
+		size_t numberOfBytesToCopy = std::min(numberOfBytesToRead - numberOfBytesRead, numberOfBufferedBytes());
+		std::memcpy(data + numberOfBytesRead, m_buffer.data() + m_bufferOffset, numberOfBytesToCopy);
+
+		m_bufferOffset += numberOfBytesToCopy;
+		m_offset += numberOfBytesToCopy;
+		numberOfBytesRead += numberOfBytesToCopy;
+	}
+
+	m_remainingDataSize -= numberOfBytesRead;
+
+	return numberOfBytesRead;
+}
+
+std::unique_ptr<ByteBuffer> TarArchive::StreamReader::readData() {
+	std::unique_ptr<std::vector<uint8_t>> data(readDataBytes());
+
+	if(data == nullptr) {
+		return nullptr;
+	}
+
+	return std::make_unique<ByteBuffer>(std::move(data));
+}
+
+std::unique_ptr<std::vector<uint8_t>> TarArchive::StreamReader::readDataBytes() {
+	if(m_currentEntry == nullptr || m_currentEntry->isDirectory()) {
+		return nullptr;
+	}
+
+	std::unique_ptr<std::vector<uint8_t>> data(std::make_unique<std::vector<uint8_t>>(m_remainingDataSize));
+
+	if(!data->empty() && !readData(data->data(), data->size()).has_value()) {
+		return nullptr;
+	}
+
+	return data;
+}
+
+bool TarArchive::StreamReader::skipData() {
+	if(m_failed) {
+		return false;
+	}
+
+	uint64_t numberOfBytesToSkip = m_remainingDataSize + m_remainingPaddingSize;
+
+	m_remainingDataSize = 0;
+	m_remainingPaddingSize = 0;
+
+	return skipBytes(numberOfBytesToSkip);
+}
+
+bool TarArchive::StreamReader::extractData(const std::string & filePath, bool overwrite) {
+	if(m_currentEntry == nullptr || m_currentEntry->isDirectory()) {
+		return false;
+	}
+
+	DataStream dataStream(*this);
+
+	return m_currentEntry->writeStreamToFile(dataStream, filePath, overwrite);
+}
+
+size_t TarArchive::StreamReader::numberOfBufferedBytes() const {
+	return m_buffer.size() - m_bufferOffset;
+}
+
+bool TarArchive::StreamReader::fillBuffer(size_t size) {
+	while(numberOfBufferedBytes() < size) {
+		if(m_failed || m_inputEnded) {
+			return false;
+		}
+
+		if(m_bufferOffset != 0) {
+			m_buffer.erase(m_buffer.begin(), m_buffer.begin() + m_bufferOffset);
+			m_bufferOffset = 0;
+		}
+
+		if(!readInput()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool TarArchive::StreamReader::readInput() {
+	if(m_decompressionStream == nullptr) {
+		size_t bufferSize = m_buffer.size();
+		m_buffer.resize(bufferSize + INPUT_CHUNK_SIZE);
+
+		std::optional<size_t> optionalNumberOfBytesRead(m_inputCallback(m_buffer.data() + bufferSize, INPUT_CHUNK_SIZE));
+
+		m_buffer.resize(bufferSize + std::min(optionalNumberOfBytesRead.value_or(0), INPUT_CHUNK_SIZE));
+
+		if(!optionalNumberOfBytesRead.has_value()) {
+			spdlog::error("Failed to read tar data at offset {}.", m_offset + numberOfBufferedBytes());
+			m_failed = true;
+			return false;
+		}
+
+		m_inputEnded = optionalNumberOfBytesRead.value() == 0;
+
+		return true;
+	}
+
+	// any compressed input left over from the previous call is decompressed before more is read
+	if(m_inputBufferOffset == m_inputBufferSize) {
+		std::optional<size_t> optionalNumberOfBytesRead(m_inputCallback(m_inputBuffer.data(), m_inputBuffer.size()));
+
+		if(!optionalNumberOfBytesRead.has_value()) {
+			spdlog::error("Failed to read compressed tar data.");
+			m_failed = true;
+			return false;
+		}
+
+		if(optionalNumberOfBytesRead.value() == 0) {
+			m_inputEnded = true;
+
+			if(!m_decompressionStream->finish()) {
+				m_failed = true;
+				return false;
+			}
+
+			return true;
+		}
+
+		m_inputBufferOffset = 0;
+		m_inputBufferSize = std::min(optionalNumberOfBytesRead.value(), m_inputBuffer.size());
+	}
+
+	size_t inputSliceSize = std::min(m_inputBufferSize - m_inputBufferOffset, DECOMPRESSION_INPUT_SLICE_SIZE);
+
+	if(!m_decompressionStream->write(m_inputBuffer.data() + m_inputBufferOffset, inputSliceSize)) {
+		m_failed = true;
+		return false;
+	}
+
+	m_inputBufferOffset += inputSliceSize;
+
+	return true;
+}
+
+bool TarArchive::StreamReader::skipBytes(uint64_t size) {
+	while(true) {
+		size_t numberOfBytesToSkip = static_cast<size_t>(std::min(size, static_cast<uint64_t>(numberOfBufferedBytes())));
+
+		m_bufferOffset += numberOfBytesToSkip;
+		m_offset += numberOfBytesToSkip;
+		size -= numberOfBytesToSkip;
+
+		if(size == 0) {
+			return true;
+		}
+
+		// uncompressed files can seek past entry data instead of reading it
+		if(m_decompressionStream == nullptr && m_fileStream != nullptr && !m_inputEnded) {
+			// seeking past the end of the file does not fail, so truncated data has to be detected up front
+			if(m_offset + size > m_fileSize) {
+				spdlog::error("Tar data is truncated, failed to skip {} bytes at offset {} of {}.", size, m_offset, m_fileSize);
+				m_failed = true;
+				return false;
+			}
+
+			m_fileStream->seekg(size, std::ios::cur);
+
+			if(m_fileStream->fail()) {
+				spdlog::error("Failed to skip {} bytes of tar data at offset {}.", size, m_offset);
+				m_failed = true;
+				return false;
+			}
+
+			m_offset += size;
+
+			return true;
+		}
+
+		if(m_decompressionStream != nullptr) {
+			m_buffer.clear();
+			m_bufferOffset = 0;
+			m_numberOfBytesToDiscard = size;
+
+			while(m_numberOfBytesToDiscard != 0) {
+				if(m_failed || m_inputEnded || !readInput()) {
+					if(!m_failed) {
+						spdlog::error("Tar data is truncated, failed to skip {} bytes at offset {}.", m_numberOfBytesToDiscard, m_offset + size - m_numberOfBytesToDiscard);
+						m_failed = true;
+					}
+
+					m_numberOfBytesToDiscard = 0;
+
+					return false;
+				}
+			}
+
+			m_offset += size;
+
+			return true;
+		}
+
+		if(!fillBuffer(1)) {
+			if(!m_failed) {
+				spdlog::error("Tar data is truncated, failed to skip {} bytes at offset {}.", size, m_offset);
+				m_failed = true;
+			}
+
+			return false;
+		}
+	}
+}
+
+std::unique_ptr<TarArchive::StreamReader> TarArchive::StreamReader::openFile(const std::string & filePath, std::optional<ByteBuffer::CompressionMethod> compressionMethod) {
+	if(!std::filesystem::is_regular_file(std::filesystem::path(filePath))) {
+		spdlog::error("Failed to open tar archive stream from non-existent file: '{}'!", filePath);
+		return nullptr;
+	}
+
+	std::unique_ptr<std::ifstream> fileStream(std::make_unique<std::ifstream>(filePath, std::ios::binary));
+
+	if(!fileStream->is_open()) {
+		spdlog::error("Failed to open tar archive file '{}' for reading.", filePath);
+		return nullptr;
+	}
+
+	std::error_code errorCode;
+	uint64_t fileSize = std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	if(errorCode) {
+		spdlog::error("Failed to determine tar archive file '{}' size: {}", filePath, errorCode.message());
+		return nullptr;
+	}
+
+	std::ifstream * rawFileStream = fileStream.get();
+
+	std::unique_ptr<StreamReader> reader(new StreamReader([rawFileStream](uint8_t * data, size_t size) -> std::optional<size_t> {
+		rawFileStream->read(reinterpret_cast<char *>(data), size);
+
+		if(rawFileStream->bad()) {
+			return {};
+		}
+
+		return static_cast<size_t>(rawFileStream->gcount());
+	}, std::move(fileStream), fileSize));
+
+	if(!reader->initialize(compressionMethod)) {
+		return nullptr;
+	}
+
+	return reader;
+}
+
+std::unique_ptr<TarArchive::StreamReader> TarArchive::StreamReader::createFrom(const ByteBuffer & data, std::optional<ByteBuffer::CompressionMethod> compressionMethod) {
+	const uint8_t * rawData = data.getRawData();
+	size_t dataSize = data.getSize();
+
+	return createFrom([rawData, dataSize, offset = static_cast<size_t>(0)](uint8_t * buffer, size_t size) mutable -> std::optional<size_t> {
+		size_t numberOfBytesToCopy = std::min(size, dataSize - offset);
+
+		std::memcpy(buffer, rawData + offset, numberOfBytesToCopy);
+		offset += numberOfBytesToCopy;
+
+		return numberOfBytesToCopy;
+	}, compressionMethod);
+}
+
+std::unique_ptr<TarArchive::StreamReader> TarArchive::StreamReader::createFrom(CompressionStream::InputCallback inputCallback, std::optional<ByteBuffer::CompressionMethod> compressionMethod) {
+	if(inputCallback == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<StreamReader> reader(new StreamReader(std::move(inputCallback)));
+
+	if(!reader->initialize(compressionMethod)) {
+		return nullptr;
+	}
+
+	return reader;
+}
+
+TarArchive::StreamReader::DataStream::DataStream(StreamReader & reader)
+	: m_reader(reader)
+	, m_size(reader.m_remainingDataSize) { }
+
+TarArchive::StreamReader::DataStream::~DataStream() { }
+
+uint64_t TarArchive::StreamReader::DataStream::getSize() const {
+	return m_size;
+}
+
+uint64_t TarArchive::StreamReader::DataStream::getOffset() const {
+	return m_size - m_reader.m_remainingDataSize;
+}
+
+std::optional<size_t> TarArchive::StreamReader::DataStream::read(uint8_t * data, size_t size) {
+	return m_reader.readData(data, size);
+}
@@ -112,12 +112,24 @@ std::unique_ptr<TarBZip2Archive> TarBZip2Archive::readFrom(const std::string & f
 		return nullptr;
 	}
 
-	std::unique_ptr<TarBZip2Archive> tarBZip2Archive(createFrom(ByteBuffer::readFrom(filePath)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::openFile(filePath, ByteBuffer::CompressionMethod::BZip2));
 
-	if(tarBZip2Archive == nullptr) {
+	if(reader == nullptr) {
 		return nullptr;
 	}
 
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
+
+	if(tarArchive == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarBZip2Archive> tarBZip2Archive(new TarBZip2Archive(std::move(tarArchive)));
+
+	std::error_code errorCode;
+	uint64_t compressedSize = std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	tarBZip2Archive->m_compressedSize = errorCode ? 0 : compressedSize;
 	tarBZip2Archive->m_filePath = filePath;
 
 	return tarBZip2Archive;
@@ -128,7 +140,13 @@ std::unique_ptr<TarBZip2Archive> TarBZip2Archive::createFrom(std::unique_ptr<Byt
 		return nullptr;
 	}
 
-	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(data->decompressed(ByteBuffer::CompressionMethod::BZip2)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::createFrom(*data, ByteBuffer::CompressionMethod::BZip2));
+
+	if(reader == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
 
 	if(tarArchive == nullptr) {
 		return nullptr;
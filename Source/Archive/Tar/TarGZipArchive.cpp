@@ -112,12 +112,24 @@ std::unique_ptr<TarGZipArchive> TarGZipArchive::readFrom(const std::string & fil
 		return nullptr;
 	}
 
-	std::unique_ptr<TarGZipArchive> tarGZipArchive(createFrom(ByteBuffer::readFrom(filePath)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::openFile(filePath, ByteBuffer::CompressionMethod::ZLib));
 
-	if(tarGZipArchive == nullptr) {
+	if(reader == nullptr) {
 		return nullptr;
 	}
 
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
+
+	if(tarArchive == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarGZipArchive> tarGZipArchive(new TarGZipArchive(std::move(tarArchive)));
+
+	std::error_code errorCode;
+	uint64_t compressedSize = std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	tarGZipArchive->m_compressedSize = errorCode ? 0 : compressedSize;
 	tarGZipArchive->m_filePath = filePath;
 
 	return tarGZipArchive;
@@ -128,7 +140,13 @@ std::unique_ptr<TarGZipArchive> TarGZipArchive::createFrom(std::unique_ptr<ByteB
 		return nullptr;
 	}
 
-	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(data->decompressed(ByteBuffer::CompressionMethod::ZLib)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::createFrom(*data, ByteBuffer::CompressionMethod::ZLib));
+
+	if(reader == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
 
 	if(tarArchive == nullptr) {
 		return nullptr;
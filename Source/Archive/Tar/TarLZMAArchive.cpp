@@ -103,12 +103,24 @@ std::unique_ptr<TarLZMAArchive> TarLZMAArchive::readFrom(const std::string & fil
 		return nullptr;
 	}
 
-	std::unique_ptr<TarLZMAArchive> tarLZMAArchive(createFrom(ByteBuffer::readFrom(filePath)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::openFile(filePath, ByteBuffer::CompressionMethod::LZMA));
 
-	if(tarLZMAArchive == nullptr) {
+	if(reader == nullptr) {
 		return nullptr;
 	}
 
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
+
+	if(tarArchive == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarLZMAArchive> tarLZMAArchive(new TarLZMAArchive(std::move(tarArchive)));
+
+	std::error_code errorCode;
+	uint64_t compressedSize = std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	tarLZMAArchive->m_compressedSize = errorCode ? 0 : compressedSize;
 	tarLZMAArchive->m_filePath = filePath;
 
 	return tarLZMAArchive;
@@ -119,7 +131,13 @@ std::unique_ptr<TarLZMAArchive> TarLZMAArchive::createFrom(std::unique_ptr<ByteB
 		return nullptr;
 	}
 
-	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(data->decompressed(ByteBuffer::CompressionMethod::LZMA)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::createFrom(*data, ByteBuffer::CompressionMethod::LZMA));
+
+	if(reader == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
 
 	if(tarArchive == nullptr) {
 		return nullptr;
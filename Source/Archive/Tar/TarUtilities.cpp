@@ -2,7 +2,7 @@
 
 #include <spdlog/spdlog.h>
 
-uint64_t TarUtilities::parseOctalNumber(const std::string & data) {
+uint64_t TarUtilities::parseOctalNumber(std::string_view data) {
 	if(data.empty()) {
 		return 0;
 	}
@@ -2,11 +2,11 @@
 #define _TAR_UTILITIES_H_
 
 #include <cstdint>
-#include <string>
+#include <string_view>
 
 namespace TarUtilities {
 
-	uint64_t parseOctalNumber(const std::string & data);
+	uint64_t parseOctalNumber(std::string_view data);
 
 }
 
@@ -103,12 +103,24 @@ std::unique_ptr<TarXZArchive> TarXZArchive::readFrom(const std::string & filePat
 		return nullptr;
 	}
 
-	std::unique_ptr<TarXZArchive> tarXZArchive(createFrom(ByteBuffer::readFrom(filePath)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::openFile(filePath, ByteBuffer::CompressionMethod::XZ));
 
-	if(tarXZArchive == nullptr) {
+	if(reader == nullptr) {
 		return nullptr;
 	}
 
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
+
+	if(tarArchive == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarXZArchive> tarXZArchive(new TarXZArchive(std::move(tarArchive)));
+
+	std::error_code errorCode;
+	uint64_t compressedSize = std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	tarXZArchive->m_compressedSize = errorCode ? 0 : compressedSize;
 	tarXZArchive->m_filePath = filePath;
 
 	return tarXZArchive;
@@ -119,7 +131,13 @@ std::unique_ptr<TarXZArchive> TarXZArchive::createFrom(std::unique_ptr<ByteBuffe
 		return nullptr;
 	}
 
-	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(data->decompressed(ByteBuffer::CompressionMethod::XZ)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::createFrom(*data, ByteBuffer::CompressionMethod::XZ));
+
+	if(reader == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
 
 	if(tarArchive == nullptr) {
 		return nullptr;
@@ -118,12 +118,24 @@ std::unique_ptr<TarZStandardArchive> TarZStandardArchive::readFrom(const std::st
 		return nullptr;
 	}
 
-	std::unique_ptr<TarZStandardArchive> tarZStandardArchive(createFrom(ByteBuffer::readFrom(filePath)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::openFile(filePath, ByteBuffer::CompressionMethod::ZStandard));
 
-	if(tarZStandardArchive == nullptr) {
+	if(reader == nullptr) {
 		return nullptr;
 	}
 
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
+
+	if(tarArchive == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarZStandardArchive> tarZStandardArchive(new TarZStandardArchive(std::move(tarArchive)));
+
+	std::error_code errorCode;
+	uint64_t compressedSize = std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	tarZStandardArchive->m_compressedSize = errorCode ? 0 : compressedSize;
 	tarZStandardArchive->m_filePath = filePath;
 
 	return tarZStandardArchive;
@@ -134,7 +146,13 @@ std::unique_ptr<TarZStandardArchive> TarZStandardArchive::createFrom(std::unique
 		return nullptr;
 	}
 
-	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(data->decompressed(ByteBuffer::CompressionMethod::ZStandard)));
+	std::unique_ptr<TarArchive::StreamReader> reader(TarArchive::StreamReader::createFrom(*data, ByteBuffer::CompressionMethod::ZStandard));
+
+	if(reader == nullptr) {
+		return nullptr;
+	}
+
+	std::unique_ptr<TarArchive> tarArchive(TarArchive::createFrom(*reader));
 
 	if(tarArchive == nullptr) {
 		return nullptr;
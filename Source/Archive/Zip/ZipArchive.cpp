@@ -509,6 +509,8 @@ size_t ZipArchive::removeEntry(Entry & entry, bool removeChildren) {
 		numberOfEntriesRemoved++;
 		entry.clearParentArchive();
 		m_entries[entry.getIndex()] = nullptr;
+
+		invalidateEntryIndex();
 	}
 
 	return numberOfEntriesRemoved;
@@ -555,6 +557,8 @@ size_t ZipArchive::removeAllEntries() {
 	m_numberOfFiles = 0;
 	m_numberOfDirectories = 0;
 
+	invalidateEntryIndex();
+
 	return numberOfEntriesRemoved;
 }
 
@@ -922,6 +926,8 @@ void ZipArchive::reset() {
 	m_compressedSize = 0;
 
 	m_entries.clear();
+
+	invalidateEntryIndex();
 }
 
 bool ZipArchive::initialize() {
@@ -974,6 +980,8 @@ bool ZipArchive::populateEntries() {
 	m_numberOfFiles = fileCount;
 	m_numberOfDirectories = directoryCount;
 
+	invalidateEntryIndex();
+
 	return true;
 }
 
@@ -1052,6 +1060,8 @@ bool ZipArchive::addEntry(std::unique_ptr<Entry> entry) {
 		}
 	}
 
+	invalidateEntryIndex();
+
 	return true;
 }
 
@@ -1062,6 +1072,65 @@ std::vector<std::shared_ptr<ArchiveEntry>> ZipArchive::getEntries() const {
 	return entries;
 }
 
+std::unique_ptr<Archive::ConcurrentEntryReader> ZipArchive::createConcurrentEntryReader() const {
+	// each reader opens its own read-only handle, which is only consistent with the entry indices if nothing has changed
+	if(!isOpen() || isModified()) {
+		return nullptr;
+	}
+
+	ZipArchiveHandle zipArchiveHandle;
+
+	if(m_sourceBuffer != nullptr) {
+		ZipUtilities::ZipErrorHandle zipError(ZipUtilities::createZipErrorHandle());
+		zip_source * zipSource = zip_source_buffer_create(m_sourceBuffer->getRawData(), m_sourceBuffer->getSize(), 0, zipError.get());
+
+		if(zipSource == nullptr) {
+			spdlog::error("Failed to create concurrent zip archive reader source buffer. {}", zip_error_strerror(zipError.get()));
+			return nullptr;
+		}
+
+		zipArchiveHandle = createZipArchiveHandle(zip_open_from_source(zipSource, ZIP_RDONLY, zipError.get()));
+
+		if(zipArchiveHandle == nullptr) {
+			zip_source_free(zipSource);
+
+			spdlog::error("Failed to open concurrent zip archive reader from source buffer. {}", zip_error_strerror(zipError.get()));
+			return nullptr;
+		}
+	}
+	else {
+		int zipErrorCode = 0;
+		zipArchiveHandle = createZipArchiveHandle(zip_open(m_filePath.c_str(), ZIP_RDONLY, &zipErrorCode));
+
+		if(zipArchiveHandle == nullptr) {
+			ZipUtilities::isSuccess(zipErrorCode, fmt::format("Failed to open concurrent zip archive reader for file: '{}'.", m_filePath));
+			return nullptr;
+		}
+	}
+
+	if(!m_password.empty() && !ZipUtilities::isSuccess(zip_set_default_password(zipArchiveHandle.get(), m_password.c_str()), "Failed to set concurrent zip archive reader password.")) {
+		return nullptr;
+	}
+
+	return std::make_unique<ConcurrentReader>(std::move(zipArchiveHandle));
+}
+
+ZipArchive::ConcurrentReader::ConcurrentReader(ZipArchiveHandle zipArchiveHandle)
+	: m_archiveHandle(std::move(zipArchiveHandle)) { }
+
+ZipArchive::ConcurrentReader::~ConcurrentReader() { }
+
+std::unique_ptr<ArchiveEntry::Stream> ZipArchive::ConcurrentReader::openEntryStream(const ArchiveEntry & entry) {
+	Entry::ZipFileHandle zipFileHandle(Entry::createZipFileHandle(zip_fopen_index(m_archiveHandle.get(), entry.getIndex(), ZIP_FL_ENC_GUESS)));
+
+	if(zipFileHandle == nullptr) {
+		spdlog::error("Failed to open zip entry for concurrent reading: '{}'.", entry.getPath());
+		return nullptr;
+	}
+
+	return std::make_unique<Entry::FileStream>(std::move(zipFileHandle), entry.getUncompressedSize(), entry.getPath());
+}
+
 zip * ZipArchive::getRawArchiveHandle() const {
 	return m_archiveHandle.get();
 }
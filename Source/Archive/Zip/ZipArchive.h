@@ -90,6 +90,7 @@ public:
 		uint64_t getCompressedSize() const override;
 		uint64_t getUncompressedSize() const override;
 		std::unique_ptr<ByteBuffer> getData() const override;
+		std::unique_ptr<Stream> openStream() const override;
 		uint32_t getCRC32() const override;
 		bool writeToFile(const std::string & filePath, bool overwrite = false) override;
 
@@ -102,6 +103,26 @@ public:
 	private:
 		using ZipFileHandle = std::unique_ptr<struct zip_file, std::function<void (struct zip_file *)>>;
 
+		class FileStream final : public Stream {
+		public:
+			FileStream(ZipFileHandle zipFileHandle, uint64_t size, const std::string & path);
+			~FileStream() override;
+
+			// Stream Virtuals
+			uint64_t getSize() const override;
+			uint64_t getOffset() const override;
+			std::optional<size_t> read(uint8_t * data, size_t size) override;
+
+		private:
+			ZipFileHandle m_zipFileHandle;
+			uint64_t m_size;
+			uint64_t m_offset;
+			std::string m_path;
+
+			FileStream(const FileStream &) = delete;
+			const FileStream & operator = (const FileStream &) = delete;
+		};
+
 		Entry(const std::string & path, uint64_t index, std::unique_ptr<ByteBuffer> data, std::chrono::time_point<std::chrono::system_clock> date, CompressionMethod compressionMethod, EncryptionMethod encryptionMethod, uint64_t compressedSize, uint64_t uncompressedSize, uint32_t crc32, ZipArchive * parentArchive);
 
 		bool setIndex(uint64_t index);
@@ -174,6 +195,7 @@ public:
 	size_t numberOfFiles() const override;
 	size_t numberOfDirectories() const override;
 	std::vector<std::shared_ptr<ArchiveEntry>> getEntries() const override;
+	std::unique_ptr<ConcurrentEntryReader> createConcurrentEntryReader() const override;
 	std::string toDebugString(bool includeDate = false) const override;
 
 	static const std::string DEFAULT_FILE_EXTENSION;
@@ -218,6 +240,21 @@ private:
 		const SourceBuffer & operator = (const SourceBuffer &) = delete;
 	};
 
+	class ConcurrentReader final : public ConcurrentEntryReader {
+	public:
+		ConcurrentReader(ZipArchiveHandle zipArchiveHandle);
+		~ConcurrentReader() override;
+
+		// ConcurrentEntryReader Virtuals
+		std::unique_ptr<ArchiveEntry::Stream> openEntryStream(const ArchiveEntry & entry) override;
+
+	private:
+		ZipArchiveHandle m_archiveHandle;
+
+		ConcurrentReader(const ConcurrentReader &) = delete;
+		const ConcurrentReader & operator = (const ConcurrentReader &) = delete;
+	};
+
 	ZipArchive(ZipArchiveHandle zipArchiveHandle, std::unique_ptr<SourceBuffer> zipSourceBuffer = nullptr, const std::string & filePath = {}, const std::string & password = {});
 	ZipArchive(ZipArchiveHandle zipArchiveHandle, const std::string & filePath, const std::string & password = {});
 
@@ -8,6 +8,7 @@
 #include <magic_enum/magic_enum.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <filesystem>
 
 ZipArchive::Entry::Entry(const std::string & path, uint64_t index, std::unique_ptr<ByteBuffer> data, std::chrono::time_point<std::chrono::system_clock> date, CompressionMethod compressionMethod, EncryptionMethod encryptionMethod, uint64_t compressedSize, uint64_t uncompressedSize, uint32_t crc32, ZipArchive * parentArchive)
@@ -99,6 +100,7 @@ bool ZipArchive::Entry::setName(const std::string & name) {
 
 		m_parentArchive->setModified();
 		m_path = newEntryPath;
+		m_parentArchive->invalidateEntryIndex();
 	}
 	else {
 		return false;
@@ -147,6 +149,7 @@ bool ZipArchive::Entry::setName(const std::string & name) {
 			spdlog::debug("Renamed zip entry directory child from '{}' to '{}'.", curentEntryPath, newCurrentEntryPath);
 
 			std::dynamic_pointer_cast<ZipArchive::Entry>(*i)->m_path = newCurrentEntryPath;
+			m_parentArchive->invalidateEntryIndex();
 		}
 	}
 
@@ -217,6 +220,7 @@ bool ZipArchive::Entry::move(const std::string & newBasePath, bool overwrite) {
 
 	m_parentArchive->setModified();
 	m_path = destinationEntryPath;
+	m_parentArchive->invalidateEntryIndex();
 
 	if(!children.empty()) {
 		std::string newChildPath;
@@ -255,6 +259,7 @@ bool ZipArchive::Entry::move(const std::string & newBasePath, bool overwrite) {
 			spdlog::debug("Renamed zip entry directory child from '{}' to '{}'.", i->first->getPath(), i->second);
 
 			std::dynamic_pointer_cast<ZipArchive::Entry>(i->first)->m_path = i->second;
+			m_parentArchive->invalidateEntryIndex();
 		}
 	}
 
@@ -364,6 +369,61 @@ std::unique_ptr<ByteBuffer> ZipArchive::Entry::getData() const {
 	return zipEntryData;
 }
 
+std::unique_ptr<ArchiveEntry::Stream> ZipArchive::Entry::openStream() const {
+	if(!isParentArchiveValid()) {
+		spdlog::error("Zip archive must be open to open the entry stream.");
+		return nullptr;
+	}
+
+	if(m_unsavedData != nullptr) {
+		// unsaved data is read in place rather than copied, so the stream is invalidated by any further changes to the entry
+		return std::make_unique<BufferStream>(m_unsavedData->getRawData(), m_unsavedData->getSize());
+	}
+
+	ZipFileHandle zipFileHandle(ZipArchive::Entry::createZipFileHandle(zip_fopen_index(m_parentArchive->getRawArchiveHandle(), m_index, ZIP_FL_ENC_GUESS)));
+
+	if(zipFileHandle == nullptr) {
+		return nullptr;
+	}
+
+	return std::make_unique<FileStream>(std::move(zipFileHandle), m_uncompressedSize, m_path);
+}
+
+ZipArchive::Entry::FileStream::FileStream(ZipFileHandle zipFileHandle, uint64_t size, const std::string & path)
+	: m_zipFileHandle(std::move(zipFileHandle))
+	, m_size(size)
+	, m_offset(0)
+	, m_path(path) { }
+
+ZipArchive::Entry::FileStream::~FileStream() { }
+
+uint64_t ZipArchive::Entry::FileStream::getSize() const {
+	return m_size;
+}
+
+uint64_t ZipArchive::Entry::FileStream::getOffset() const {
+	return m_offset;
+}
+
+std::optional<size_t> ZipArchive::Entry::FileStream::read(uint8_t * data, size_t size) {
+	size_t numberOfBytesToRead = static_cast<size_t>(std::min(static_cast<uint64_t>(size), m_size - m_offset));
+
+	if(numberOfBytesToRead == 0) {
+		return 0;
+	}
+
+	int64_t numberOfBytesRead = zip_fread(m_zipFileHandle.get(), data, numberOfBytesToRead);
+
+	if(numberOfBytesRead <= 0) {
+		spdlog::error("Failed to read zip entry file data at offset {} of {} for entry: '{}'.", m_offset, m_size, m_path);
+		return {};
+	}
+
+	m_offset += numberOfBytesRead;
+
+	return static_cast<size_t>(numberOfBytesRead);
+}
+
 bool ZipArchive::Entry::isCompressed() const {
 	return m_compressionMethod != CompressionMethod::Store;
 }
@@ -445,20 +505,7 @@ uint32_t ZipArchive::Entry::getCRC32() const {
 }
 
 bool ZipArchive::Entry::writeToFile(const std::string & filePath, bool overwrite) {
-	std::unique_ptr<ByteBuffer> data(getData());
-
-	if(data == nullptr) {
-		spdlog::error("Failed to obtain zip entry file data when writing entry to file: '{}'.", filePath);
-		return false;
-	}
-
-	std::string formattedDestinationFilePath(Utilities::replaceAll(Utilities::replaceAll(filePath, "\\", "/"), "//", "/"));
-
-	if(filePath != formattedDestinationFilePath) {
-		spdlog::debug("Updating zip entry file extraction path from '{}' to '{}'.", filePath, formattedDestinationFilePath);
-	}
-
-	return data->writeTo(formattedDestinationFilePath, overwrite);
+	return writeStreamToFile(filePath, overwrite);
 }
 
 bool ZipArchive::Entry::isParentArchiveValid() const {
@@ -1,11 +1,12 @@
 #include "ByteBuffer.h"
 
-#include "Compression/BZip2Utilities.h"
-#include "Compression/LZMAUtilities.h"
-#include "Compression/ZLibUtilities.h"
+#include "Compression/CompressionStream.h"
+#include "Compression/CompressionStreamPool.h"
+#include "Compression/ZStandardUtilities.h"
 #include "Diff/OpenVCDiffByteBufferOutputStream.h"
 #include "Utilities/FileUtilities.h"
 #include "Utilities/NumberUtilities.h"
+#include "Utilities/SIMDUtilities.h"
 #include "Utilities/StringUtilities.h"
 
 #include <cryptopp/cryptlib.h>
@@ -18,7 +19,9 @@
 #include <spdlog/spdlog.h>
 #include <zstd.h>
 
+#include <algorithm>
 #include <bitset>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <functional>
@@ -26,9 +29,6 @@
 #include <sstream>
 #include <utility>
 
-static constexpr const char * BASE_64_CHARACTERS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-static constexpr const char * BASE_16_CHARACTERS = "0123456789ABCDEF";
-
 const Endianness ByteBuffer::DEFAULT_ENDIANNESS = Endianness::BigEndian;
 const ByteBuffer::HashFormat ByteBuffer::DEFAULT_HASH_FORMAT = HashFormat::Hexadecimal;
 const ByteBuffer ByteBuffer::EMPTY_BYTE_BUFFER;
@@ -306,6 +306,25 @@ std::string ByteBuffer::getHash(HashType hashType, HashFormat hashFormat) const
 	return {};
 }
 
+std::string ByteBuffer::getHash(const uint8_t * data, size_t size, HashType hashType, HashFormat hashFormat) {
+	switch(hashType) {
+		case HashType::MD5: {
+			return getHash<CryptoPP::Weak::MD5>(data, size, hashFormat);
+		}
+		case HashType::SHA1: {
+			return getHash<CryptoPP::SHA1>(data, size, hashFormat);
+		}
+		case HashType::SHA256: {
+			return getHash<CryptoPP::SHA256>(data, size, hashFormat);
+		}
+		case HashType::SHA512: {
+			return getHash<CryptoPP::SHA512>(data, size, hashFormat);
+		}
+	}
+
+	return {};
+}
+
 size_t ByteBuffer::getReadOffset() const {
 	return m_readOffset;
 }
@@ -329,16 +348,7 @@ bool ByteBuffer::skipReadBytes(size_t numberOfBytes) const {
 }
 
 bool ByteBuffer::hasMoreLines() const {
-	uint8_t currentByte = 0;
-
-	for(size_t i = m_readOffset; i < m_data->size(); i++) {
-		currentByte = (*m_data)[i];
-
-		if(currentByte == '\n' || currentByte == '\r') {
-			return true;
-		}
-	}
-
+	// any remaining byte starts a line, whether or not it is followed by a line break
 	return m_readOffset < m_data->size();
 }
 
@@ -351,6 +361,15 @@ size_t ByteBuffer::numberOfLinesRemaining() const {
 }
 
 size_t ByteBuffer::numberOfLinesAfterOffset(size_t offset) const {
+	if(offset >= m_data->size()) {
+		return 0;
+	}
+
+	// without carriage returns every line feed ends exactly one line, so the lines can be counted directly
+	if(!Utilities::findByte(m_data->data() + offset, m_data->size() - offset, '\r').has_value()) {
+		return Utilities::countByte(m_data->data() + offset, m_data->size() - offset, '\n') + (m_data->back() == '\n' ? 0 : 1);
+	}
+
 	size_t currentOffset = offset;
 	size_t lineCount = 0;
 
@@ -394,6 +413,11 @@ size_t ByteBuffer::indexOfNextLineFrom(size_t offset, size_t * endOfLineIndex) c
 		return std::numeric_limits<size_t>::max();
 	}
 
+	// skip straight to the first line break character
+	std::optional<size_t> optionalLineBreakOffset(Utilities::findEitherByte(m_data->data() + offset, m_data->size() - offset, '\n', '\r'));
+
+	currentOffset = optionalLineBreakOffset.has_value() ? offset + optionalLineBreakOffset.value() : m_data->size();
+
 	while(currentOffset < m_data->size()) {
 		currentByte = (*m_data)[currentOffset];
 
@@ -1994,28 +2018,61 @@ bool ByteBuffer::writeBytes(const std::shared_ptr<const ByteBuffer> & buffer) {
 }
 
 bool ByteBuffer::containsString(const std::string & value, bool caseSensitive) const {
-	if(m_data->size() < value.length()) {
-		return false;
+	return indexOf(value, 0, caseSensitive).has_value();
+}
+
+std::optional<size_t> ByteBuffer::indexOf(uint8_t value, size_t offset) const {
+	if(offset >= m_data->size()) {
+		return {};
 	}
 
-	bool match = false;
+	std::optional<size_t> optionalIndex(Utilities::findByte(m_data->data() + offset, m_data->size() - offset, value));
 
-	for(size_t i = 0; i < m_data->size() - value.length() + 1; i++) {
-		match = true;
+	if(!optionalIndex.has_value()) {
+		return {};
+	}
 
-		for(size_t j = 0; j < value.length(); j++) {
-			if(Utilities::areCharactersEqual(m_data->at(i + j), value[j], caseSensitive)) {
-				match = false;
-				break;
-			}
-		}
+	return offset + optionalIndex.value();
+}
 
-		if(match) {
-			return true;
-		}
+std::optional<size_t> ByteBuffer::indexOf(const uint8_t * data, size_t size, size_t offset, bool caseSensitive) const {
+	if(offset > m_data->size() || (data == nullptr && size != 0)) {
+		return {};
 	}
 
-	return false;
+	std::optional<size_t> optionalIndex(Utilities::findBytes(m_data->data() + offset, m_data->size() - offset, data, size, caseSensitive));
+
+	if(!optionalIndex.has_value()) {
+		return {};
+	}
+
+	return offset + optionalIndex.value();
+}
+
+std::optional<size_t> ByteBuffer::indexOf(std::string_view value, size_t offset, bool caseSensitive) const {
+	return indexOf(reinterpret_cast<const uint8_t *>(value.data()), value.length(), offset, caseSensitive);
+}
+
+std::vector<size_t> ByteBuffer::findAll(const uint8_t * data, size_t size, size_t offset, bool caseSensitive) const {
+	std::vector<size_t> indices;
+
+	if(size == 0) {
+		return indices;
+	}
+
+	std::optional<size_t> optionalIndex;
+
+	// matches do not overlap
+	while((optionalIndex = indexOf(data, size, offset, caseSensitive)).has_value()) {
+		indices.push_back(optionalIndex.value());
+		offset = optionalIndex.value() + size;
+	}
+
+	return indices;
+}
+
+std::vector<size_t> ByteBuffer::findAll(std::string_view value, size_t offset, bool caseSensitive) const {
+	return findAll(reinterpret_cast<const uint8_t *>(value.data()), value.length(), offset, caseSensitive);
 }
 
 std::unique_ptr<ByteBuffer> ByteBuffer::diff(const ByteBuffer &targetData) {
@@ -2082,170 +2139,134 @@ std::unique_ptr<ByteBuffer> ByteBuffer::copyOfRange(size_t start, size_t end) co
 	return std::make_unique<ByteBuffer>(m_data->data() + (start * sizeof(uint8_t)), end - start + 1);
 }
 
-std::unique_ptr<ByteBuffer> ByteBuffer::decompressed(CompressionMethod decompressionMethod, size_t offset, size_t size) const {
-	if(offset == std::numeric_limits<size_t>::max()) {
-		offset = m_readOffset;
-	}
-
-	if(size == std::numeric_limits<size_t>::max()) {
-		size = m_data->size();
-	}
-
-	if(size > m_data->size() - offset) {
-		size = m_data->size() - offset;
-	}
-
-	if(size == 0) {
-		return nullptr;
-	}
-
+static std::unique_ptr<ByteBuffer> decompressData(ByteBuffer::CompressionMethod decompressionMethod, const ByteBuffer::CompressionOptions & options, const uint8_t * data, size_t size) {
 	std::unique_ptr<ByteBuffer> decompressedData(std::make_unique<ByteBuffer>());
 
-	switch(decompressionMethod) {
-		case CompressionMethod::BZip2: {
-			BZip2::StreamHandle bZip2Stream(BZip2::createDecompressionStreamHandle());
+	if(decompressionMethod == ByteBuffer::CompressionMethod::ZStandard) {
+		size_t firstFrameSize = ZSTD_findFrameCompressedSize(data, size);
 
-			if(bZip2Stream == nullptr) {
-				return nullptr;
-			}
+		if(!ZStandard::isSuccess(firstFrameSize, "Invalid Zstandard frame")) {
+			return nullptr;
+		}
 
-			static constexpr uint64_t OUTPUT_BUFFER_SIZE = 4096;
-			uint8_t outputBuffer[OUTPUT_BUFFER_SIZE];
-			int result = BZ_OK;
+		// only a lone frame that declares its content size can be decompressed in a single pass
+		unsigned long long uncompressedSize = firstFrameSize == size ? ZSTD_getFrameContentSize(data, size) : ZSTD_CONTENTSIZE_UNKNOWN;
 
-			bZip2Stream->next_in = reinterpret_cast<char *>(const_cast<uint8_t *>(m_data->data())) + offset;
-			bZip2Stream->avail_in = size;
-			bZip2Stream->next_out = reinterpret_cast<char *>(outputBuffer);
-			bZip2Stream->avail_out = OUTPUT_BUFFER_SIZE;
+		if(uncompressedSize == ZSTD_CONTENTSIZE_ERROR) {
+			spdlog::error("Failed to determine decompressed Zstandard data size.");
+			return nullptr;
+		}
 
-			while(true) {
-				result = BZ2_bzDecompress(bZip2Stream.get());
+		ZSTD_DCtx * zStandardContext = ZStandard::getThreadLocalDecompressionContext();
 
-				if(!BZip2::isSuccess(result, "Failed to decompress BZip2 data")) {
-					return nullptr;
-				}
+		if(zStandardContext == nullptr) {
+			return nullptr;
+		}
 
-				if(!decompressedData->writeBytes(outputBuffer, OUTPUT_BUFFER_SIZE - bZip2Stream->avail_out)) {
-					spdlog::error("Failed to write decompressed BZip2 data to buffer.");
-					return nullptr;
-				}
+		if(options.dictionary != nullptr && !ZStandard::isSuccess(ZSTD_DCtx_loadDictionary(zStandardContext, options.dictionary->getRawData(), options.dictionary->getSize()), "Failed to load Zstandard decompression dictionary")) {
+			return nullptr;
+		}
 
-				bZip2Stream->next_out = reinterpret_cast<char *>(outputBuffer);
-				bZip2Stream->avail_out = OUTPUT_BUFFER_SIZE;
+		if(options.windowSizeLog.has_value() && !ZStandard::isSuccess(ZSTD_DCtx_setParameter(zStandardContext, ZSTD_d_windowLogMax, options.windowSizeLog.value()), "Failed to set maximum Zstandard decompression window size")) {
+			return nullptr;
+		}
 
-				if(result == BZ_STREAM_END) {
-					return decompressedData;
-				}
-			}
+		if(uncompressedSize != ZSTD_CONTENTSIZE_UNKNOWN) {
+			decompressedData->resize(uncompressedSize);
 
-			break;
-		}
-		case CompressionMethod::LZMA:
-		case CompressionMethod::XZ: {
-			LZMA::StreamHandle lzmaStream(LZMA::createStreamHandle());
+			size_t result = ZSTD_decompressDCtx(zStandardContext, decompressedData->getRawData(), decompressedData->getSize(), data, size);
 
-			if(lzmaStream == nullptr) {
-				spdlog::error("Failed to initialize {} stream handle.", magic_enum::enum_name(decompressionMethod));
+			if(!ZStandard::isSuccess(result, "Failed to decompress Zstandard data")) {
 				return nullptr;
 			}
 
-			lzma_ret lzmaStatus = lzma_auto_decoder(lzmaStream.get(), std::numeric_limits<uint64_t>::max(), 0);
-
-			if(!LZMA::isSuccess(lzmaStatus, "Failed to initialize LZMA decoder")) {
+			if(result != uncompressedSize) {
+				spdlog::error("Decompressed Zstandard data size of {} bytes does not match expected size of {} bytes.", result, uncompressedSize);
 				return nullptr;
 			}
 
-			static constexpr uint64_t OUTPUT_BUFFER_SIZE = 4096;
-			uint8_t outputBuffer[OUTPUT_BUFFER_SIZE];
+			return decompressedData;
+		}
 
-			lzmaStream->next_in = m_data->data() + offset;
-			lzmaStream->avail_in = size;
-			lzmaStream->next_out = outputBuffer;
-			lzmaStream->avail_out = OUTPUT_BUFFER_SIZE;
+		// stream multiple frames or frames of unknown size into a geometrically growing buffer
+		ZSTD_inBuffer inputBuffer = { data, size, 0 };
+		size_t decompressedSize = 0;
+		size_t result = 0;
 
-			while(true) {
-				lzmaStatus = lzma_code(lzmaStream.get(), LZMA_FINISH);
+		decompressedData->resize(std::max(ZSTD_DStreamOutSize(), size * 2));
 
-				if(!decompressedData->writeBytes(outputBuffer, OUTPUT_BUFFER_SIZE - lzmaStream->avail_out)) {
-					spdlog::error("Failed to write decompressed LZMA data to buffer.");
-					return nullptr;
-				}
+		while(true) {
+			if(decompressedSize == decompressedData->getSize()) {
+				decompressedData->resize(decompressedData->getSize() * 2);
+			}
 
-				lzmaStream->next_out = outputBuffer;
-				lzmaStream->avail_out = OUTPUT_BUFFER_SIZE;
+			ZSTD_outBuffer outputBuffer = { decompressedData->getRawData(), decompressedData->getSize(), decompressedSize };
 
-				if(lzmaStatus == LZMA_STREAM_END) {
-					return decompressedData;
-				}
+			result = ZSTD_decompressStream(zStandardContext, &outputBuffer, &inputBuffer);
 
-				if(!LZMA::isSuccess(lzmaStatus, "Failed to decompress LZMA data")) {
-					return nullptr;
-				}
+			if(!ZStandard::isSuccess(result, "Failed to decompress Zstandard data")) {
+				return nullptr;
 			}
 
-			break;
-		}
-		case CompressionMethod::ZLib: {
-			ZLib::StreamHandle zLibStream(ZLib::createInflationStreamHandle());
+			decompressedSize = outputBuffer.pos;
 
-			if(zLibStream == nullptr) {
-				return nullptr;
+			if(inputBuffer.pos == inputBuffer.size && outputBuffer.pos < outputBuffer.size) {
+				break;
 			}
+		}
 
-			static constexpr uint64_t OUTPUT_BUFFER_SIZE = 4096;
-			uint8_t outputBuffer[OUTPUT_BUFFER_SIZE];
-			int zLibResult = Z_OK;
-
-			zLibStream->next_in = reinterpret_cast<Bytef *>(const_cast<uint8_t *>(m_data->data())) + offset;
-			zLibStream->avail_in = size;
-			zLibStream->next_out = reinterpret_cast<Bytef *>(outputBuffer);
-			zLibStream->avail_out = OUTPUT_BUFFER_SIZE;
+		if(result != 0) {
+			spdlog::error("Failed to decompress Zstandard data: input ended before the end of the last frame.");
+			return nullptr;
+		}
 
-			while(true) {
-				zLibResult = inflate(zLibStream.get(), Z_NO_FLUSH);
+		decompressedData->resize(decompressedSize);
 
-				if(!ZLib::isSuccess(zLibResult, "Failed to decompress ZLib data")) {
-					return nullptr;
-				}
+		return decompressedData;
+	}
 
-				if(!decompressedData->writeBytes(outputBuffer, OUTPUT_BUFFER_SIZE - zLibStream->avail_out)) {
-					spdlog::error("Failed to write decompressed ZLib data to buffer.");
-					return nullptr;
-				}
+	CompressionStreamPool & compressionStreamPool = CompressionStreamPool::getInstance();
 
-				zLibStream->next_out = reinterpret_cast<Bytef *>(outputBuffer);
-				zLibStream->avail_out = OUTPUT_BUFFER_SIZE;
+	std::unique_ptr<CompressionStream> decompressionStream(compressionStreamPool.acquireStream(decompressionMethod, CompressionStream::Mode::Decompress, options, [&decompressedData](const uint8_t * outputData, size_t outputSize) {
+		return decompressedData->writeBytes(outputData, outputSize);
+	}));
 
-				if(zLibResult == Z_STREAM_END) {
-					return decompressedData;
-				}
-			}
+	if(decompressionStream == nullptr ||
+	   !decompressionStream->write(data, size) ||
+	   !decompressionStream->finish()) {
+		return nullptr;
+	}
 
-			break;
-		}
-		case CompressionMethod::ZStandard: {
-			size_t uncompressedSize = ZSTD_getFrameContentSize(m_data->data() + offset, size);
+	compressionStreamPool.releaseStream(std::move(decompressionStream));
 
-			if(uncompressedSize == ZSTD_CONTENTSIZE_UNKNOWN || uncompressedSize == ZSTD_CONTENTSIZE_ERROR) {
-				spdlog::error("Failed to determine decompressed Zstandard data size.");
-				return nullptr;
-			}
+	return decompressedData;
+}
 
-			decompressedData->resize(uncompressedSize);
+static std::unique_ptr<ByteBuffer> compressData(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, const uint8_t * data, size_t size) {
+	CompressionStreamPool & compressionStreamPool = CompressionStreamPool::getInstance();
+	std::unique_ptr<ByteBuffer> compressedData(std::make_unique<ByteBuffer>());
 
-			if(ZSTD_isError(ZSTD_decompress(decompressedData->getRawData(), decompressedData->getSize(), m_data->data() + offset, size))) {
-				spdlog::error("Failed to decompress Zstandard data.");
-				return nullptr;
-			}
+	std::unique_ptr<CompressionStream> compressionStream(compressionStreamPool.acquireStream(compressionMethod, CompressionStream::Mode::Compress, options, [&compressedData](const uint8_t * outputData, size_t outputSize) {
+		return compressedData->writeBytes(outputData, outputSize);
+	}, std::min(size, CompressionStream::DEFAULT_CHUNK_SIZE)));
 
-			return decompressedData;
-		}
+	if(compressionStream == nullptr ||
+	   !compressionStream->setPledgedInputSize(size) ||
+	   !compressionStream->write(data, size) ||
+	   !compressionStream->finish()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	compressionStreamPool.releaseStream(std::move(compressionStream));
+
+	return compressedData;
 }
 
-std::unique_ptr<ByteBuffer> ByteBuffer::compressed(CompressionMethod compressionMethod, size_t offset, size_t size) const {
+std::unique_ptr<ByteBuffer> ByteBuffer::decompressed(CompressionMethod decompressionMethod, size_t offset, size_t size) const {
+	return decompressed(decompressionMethod, CompressionOptions(), offset, size);
+}
+
+std::unique_ptr<ByteBuffer> ByteBuffer::decompressed(CompressionMethod decompressionMethod, const CompressionOptions & options, size_t offset, size_t size) const {
 	if(offset == std::numeric_limits<size_t>::max()) {
 		offset = m_readOffset;
 	}
@@ -2262,166 +2283,41 @@ std::unique_ptr<ByteBuffer> ByteBuffer::compressed(CompressionMethod compression
 		return nullptr;
 	}
 
-	std::unique_ptr<ByteBuffer> compressedData(std::make_unique<ByteBuffer>());
-
-	switch(compressionMethod) {
-		case CompressionMethod::BZip2: {
-			BZip2::StreamHandle bZip2Stream(BZip2::createCompressionStreamHandle());
-
-			if(bZip2Stream == nullptr) {
-				return nullptr;
-			}
+	std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+	std::unique_ptr<ByteBuffer> decompressedData(decompressData(decompressionMethod, options, m_data->data() + offset, size));
 
-			static constexpr uint64_t OUTPUT_BUFFER_SIZE = 4096;
-			uint8_t outputBuffer[OUTPUT_BUFFER_SIZE];
-			int result = BZ_OK;
-
-			bZip2Stream->next_in = reinterpret_cast<char *>(const_cast<uint8_t *>(m_data->data())) + offset;
-			bZip2Stream->avail_in = size;
-			bZip2Stream->next_out = reinterpret_cast<char *>(outputBuffer);
-			bZip2Stream->avail_out = OUTPUT_BUFFER_SIZE;
-
-			while(true) {
-				result = BZ2_bzCompress(bZip2Stream.get(), BZ_FINISH);
-
-				if(!BZip2::isSuccess(result, "Failed to compress BZip2 data")) {
-					return nullptr;
-				}
+	CompressionStreamPool::getInstance().recordCall(decompressionMethod, CompressionStream::Mode::Decompress, std::chrono::steady_clock::now() - startTime, size, decompressedData != nullptr ? decompressedData->getSize() : 0, decompressedData != nullptr);
 
-				if(!compressedData->writeBytes(outputBuffer, OUTPUT_BUFFER_SIZE - bZip2Stream->avail_out)) {
-					spdlog::error("Failed to write compressed BZip2 data to buffer.");
-					return nullptr;
-				}
-
-				bZip2Stream->next_out = reinterpret_cast<char *>(outputBuffer);
-				bZip2Stream->avail_out = OUTPUT_BUFFER_SIZE;
-
-				if(result == BZ_STREAM_END) {
-					return compressedData;
-				}
-			}
-
-			break;
-		}
-		case CompressionMethod::LZMA:
-		case CompressionMethod::XZ: {
-			LZMA::StreamHandle lzmaStream(LZMA::createStreamHandle());
-
-			if(lzmaStream == nullptr) {
-				spdlog::error("Failed to initialize {} stream handle.", magic_enum::enum_name(compressionMethod));
-				return nullptr;
-			}
-
-			lzma_ret lzmaStatus = LZMA_OK;
-
-			if(compressionMethod == CompressionMethod::LZMA) {
-				lzma_options_lzma lzmaOptions;
-
-				if(lzma_lzma_preset(&lzmaOptions, LZMA_PRESET_DEFAULT)) {
-					spdlog::error("Failed to initialize LZMA encoder options with default preset.");
-					return nullptr;
-				}
-
-				lzmaStatus = lzma_alone_encoder(lzmaStream.get(), &lzmaOptions);
-			}
-			else if(compressionMethod == CompressionMethod::XZ) {
-				// TODO: Allow LZMA XZ compression present to be configurable (ie. 0 [fastest] - 9 [slowest], LZMA_PRESET_EXTREME)
-				static constexpr uint32_t DEFAULT_LZMA_COMPRESSION_PRESENT = 4;
-				lzmaStatus = lzma_easy_encoder(lzmaStream.get(), DEFAULT_LZMA_COMPRESSION_PRESENT, LZMA_CHECK_CRC64);
-			}
-
-			if(!LZMA::isSuccess(lzmaStatus, "Failed to initialize easy LZMA encoder")) {
-				return nullptr;
-			}
-
-			static constexpr uint64_t OUTPUT_BUFFER_SIZE = 4096;
-			uint8_t outputBuffer[OUTPUT_BUFFER_SIZE];
-
-			lzmaStream->next_in = m_data->data() + offset;
-			lzmaStream->avail_in = size;
-			lzmaStream->next_out = outputBuffer;
-			lzmaStream->avail_out = OUTPUT_BUFFER_SIZE;
-
-			while(true) {
-				lzmaStatus = lzma_code(lzmaStream.get(), LZMA_FINISH);
-
-				if(!compressedData->writeBytes(outputBuffer, OUTPUT_BUFFER_SIZE - lzmaStream->avail_out)) {
-					spdlog::error("Failed to write compressed LZMA data to buffer.");
-					return nullptr;
-				}
-
-				lzmaStream->next_out = outputBuffer;
-				lzmaStream->avail_out = OUTPUT_BUFFER_SIZE;
-
-				if(lzmaStatus == LZMA_STREAM_END) {
-					return compressedData;
-				}
-
-				if(!LZMA::isSuccess(lzmaStatus, "Failed to compress LZMA data")) {
-					return nullptr;
-				}
-			}
-
-			break;
-		}
-		case CompressionMethod::ZLib: {
-			ZLib::StreamHandle zLibStream(ZLib::createDeflationStreamHandle());
-
-			if(zLibStream == nullptr) {
-				return nullptr;
-			}
-
-			int zLibResult = Z_OK;
-			static constexpr uint64_t OUTPUT_BUFFER_SIZE = 4096;
-			uint8_t outputBuffer[OUTPUT_BUFFER_SIZE];
-
-			zLibStream->next_in = reinterpret_cast<Bytef *>(const_cast<uint8_t *>(m_data->data())) + offset;
-			zLibStream->avail_in = size;
-			zLibStream->next_out = outputBuffer;
-			zLibStream->avail_out = OUTPUT_BUFFER_SIZE;
-
-			while(true) {
-				zLibResult = deflate(zLibStream.get(), Z_FINISH);
-
-				if(!ZLib::isSuccess(zLibResult, "Failed to compress ZLib data")) {
-					return nullptr;
-				}
-
-				if(!compressedData->writeBytes(outputBuffer, OUTPUT_BUFFER_SIZE - zLibStream->avail_out)) {
-					spdlog::error("Failed to write compressed ZLib data to buffer.");
-					return nullptr;
-				}
-
-				zLibStream->next_out = outputBuffer;
-				zLibStream->avail_out = OUTPUT_BUFFER_SIZE;
+	return decompressedData;
+}
 
-				if(zLibResult == Z_STREAM_END) {
-					return compressedData;
-				}
-			}
+std::unique_ptr<ByteBuffer> ByteBuffer::compressed(CompressionMethod compressionMethod, size_t offset, size_t size) const {
+	return compressed(compressionMethod, CompressionOptions(), offset, size);
+}
 
-			break;
-		}
-		case CompressionMethod::ZStandard: {
-			size_t maximumCompressedSize = ZSTD_compressBound(size);
+std::unique_ptr<ByteBuffer> ByteBuffer::compressed(CompressionMethod compressionMethod, const CompressionOptions & options, size_t offset, size_t size) const {
+	if(offset == std::numeric_limits<size_t>::max()) {
+		offset = m_readOffset;
+	}
 
-			compressedData->resize(maximumCompressedSize);
+	if(size == std::numeric_limits<size_t>::max()) {
+		size = m_data->size();
+	}
 
-			// TODO: Allow Zstandard compression level to be customizable:
-			size_t compressedSize = ZSTD_compress(compressedData->getRawData(), compressedData->getSize(), m_data->data() + offset, size, ZSTD_CLEVEL_DEFAULT);
+	if(size > m_data->size() - offset) {
+		size = m_data->size() - offset;
+	}
 
-			if(ZSTD_isError(compressedSize)) {
-				spdlog::error("Failed to compress Zstandard data.");
-				return nullptr;
-			}
+	if(size == 0) {
+		return nullptr;
+	}
 
-			compressedData->resize(compressedSize);
+	std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+	std::unique_ptr<ByteBuffer> compressedData(compressData(compressionMethod, options, m_data->data() + offset, size));
 
-			return compressedData;
-		}
-	}
+	CompressionStreamPool::getInstance().recordCall(compressionMethod, CompressionStream::Mode::Compress, std::chrono::steady_clock::now() - startTime, size, compressedData != nullptr ? compressedData->getSize() : 0, compressedData != nullptr);
 
-	return nullptr;
+	return compressedData;
 }
 
 std::string ByteBuffer::toString() const {
@@ -2443,65 +2339,29 @@ std::string ByteBuffer::toBinary() const {
 }
 
 std::string ByteBuffer::toHexadecimal(bool uppercase) const {
-	std::string hex(m_data->size() * 2, '\0');
-
-	uint8_t modifier = uppercase ? 0x0 : 0x20;
+	std::string hex(Utilities::getHexadecimalEncodedLength(m_data->size()), '\0');
 
-	for(size_t i = 0; i < m_data->size(); i++) {
-		hex[ i * 2     ] = BASE_16_CHARACTERS[(*m_data)[i] >> 4]   | modifier;
-		hex[(i * 2) + 1] = BASE_16_CHARACTERS[(*m_data)[i] & 0x0f] | modifier;
-	}
+	Utilities::encodeHexadecimal(*m_data, hex, uppercase);
 
 	return hex;
 }
 
-std::string ByteBuffer::toBase64() const {
-	static constexpr char PADDING_CHARACTER = '=';
-
-	size_t length = (((m_data->size() / 3) + ((m_data->size() % 3 != 0) ? 1 : 0))) * 4;
-	std::string base64(length, '\0');
-	uint32_t value = 0;
-	size_t i = 0;
-	size_t offset = 0;
-
-	if(m_data->size() >= 3) {
-		for(; i < m_data->size() - 2; i += 3) {
-			value = static_cast<uint8_t>((*m_data)[i    ]) << 16 |
-					static_cast<uint8_t>((*m_data)[i + 1]) <<  8 |
-					static_cast<uint8_t>((*m_data)[i + 2]);
-
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 18) & 0x3f];
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 12) & 0x3f];
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 6)  & 0x3f];
-			base64[offset++] = BASE_64_CHARACTERS[(value)       & 0x3f];
-		}
-	}
-
-	switch(m_data->size() % 3) {
-		case 1:
-			value = static_cast<uint8_t>((*m_data)[i]) << 16;
-
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 18) & 0x3f];
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 12) & 0x3f];
-			base64[offset++] = PADDING_CHARACTER;
-			base64[offset++] = PADDING_CHARACTER;
-			break;
-
-		case 2:
-			value = static_cast<uint8_t>((*m_data)[i    ]) << 16 |
-					static_cast<uint8_t>((*m_data)[i + 1]) <<  8;
+bool ByteBuffer::toHexadecimal(std::span<char> output, bool uppercase) const {
+	return Utilities::encodeHexadecimal(*m_data, output, uppercase);
+}
 
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 18) & 0x3f];
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 12) & 0x3f];
-			base64[offset++] = BASE_64_CHARACTERS[(value >> 6)  & 0x3f];
-			base64[offset++] = PADDING_CHARACTER;
-			break;
+std::string ByteBuffer::toBase64() const {
+	std::string base64(Utilities::getBase64EncodedLength(m_data->size()), '\0');
 
-	}
+	Utilities::encodeBase64(*m_data, base64);
 
 	return base64;
 }
 
+bool ByteBuffer::toBase64(std::span<char> output) const {
+	return Utilities::encodeBase64(*m_data, output);
+}
+
 std::unique_ptr<ByteBuffer> ByteBuffer::fromBinary(const std::string & binary) {
 	if(binary.length() % 8 != 0 || binary.find_first_not_of("01") != std::string::npos) {
 		return nullptr;
@@ -2519,103 +2379,35 @@ std::unique_ptr<ByteBuffer> ByteBuffer::fromBinary(const std::string & binary) {
 }
 
 std::unique_ptr<ByteBuffer> ByteBuffer::fromHexadecimal(const std::string & hexadecimal) {
-	if(hexadecimal.length() % 2 != 0) {
+	std::optional<size_t> optionalSize(Utilities::getHexadecimalDecodedLength(hexadecimal));
+
+	if(!optionalSize.has_value()) {
 		return nullptr;
 	}
 
-	size_t size = hexadecimal.length() / 2;
-	uint8_t value = 0;
-	uint8_t part = 0;
-	uint8_t c = 0;
-	size_t offset = 0;
-	std::unique_ptr<ByteBuffer> buffer(std::make_unique<ByteBuffer>(size));
-	buffer->resize(size);
-
-	for(size_t i = 0; i < size; i += 2) {
-		for(int j = 0; j < 2; j++) {
-			c = static_cast<uint8_t>(hexadecimal[i + j]);
-
-			if(c >= '0' && c <= '9') {
-				part = c - '0';
-			}
-			else if(c >= 'A' && c <= 'Z') {
-				part = c - 'A' + 10;
-			}
-			else if(c >= 'a' && c <= 'z') {
-				part = c - 'a' + 10;
-			}
-			else {
-				return nullptr;
-			}
-
-			if(j == 0) {
-				value = part << 4;
-			}
-			else {
-				value |= part;
-			}
-		}
+	std::unique_ptr<ByteBuffer> buffer(std::make_unique<ByteBuffer>(optionalSize.value()));
+	buffer->resize(optionalSize.value());
 
-		(*buffer->m_data)[offset++] = value;
+	if(!Utilities::decodeHexadecimal(hexadecimal, *buffer->m_data)) {
+		return nullptr;
 	}
 
 	return buffer;
 }
 
 std::unique_ptr<ByteBuffer> ByteBuffer::fromBase64(const std::string & base64) {
-	uint8_t c = '\0';
-	uint8_t part = 0;
-	uint32_t value = 0;
-	uint8_t bitShift = 0;
-	size_t paddingLength = 0;
-
-	if(!base64.empty()) {
-		if(base64.back() == '=') {
-			paddingLength++;
-		}
+	std::optional<size_t> optionalSize(Utilities::getBase64DecodedLength(base64));
 
-		if(base64.length() > 1 && base64[base64.length() - 2] == '=') {
-			paddingLength++;
-		}
+	if(!optionalSize.has_value()) {
+		spdlog::error("Malformed base 64 data with length {}.", base64.length());
+		return nullptr;
 	}
 
-	std::unique_ptr<ByteBuffer> buffer(std::make_unique<ByteBuffer>((base64.length() * 3) / 4 - paddingLength));
-
-	for(size_t i = 0; i < base64.length() - paddingLength; i++) {
-		c = base64[i];
-
-		if(c >= 'A' && c <= 'Z') {
-			part = c - 'A';
-		}
-		else if(c >= 'a' && c <= 'z') {
-			part = c - 'a' + 26;
-		}
-		else if(c >= '0' && c <= '9') {
-			part = c - '0' + 52;
-		}
-		else if(c == '+') {
-			part = 62;
-		}
-		else if(c == '/') {
-			part = 63;
-		}
-		else {
-			spdlog::error("Invalid base 64 character '{}' at index {}.", static_cast<char>(c), i);
-			return nullptr;
-		}
-
-		value = (value << 6) | part;
-		bitShift += 6;
+	std::unique_ptr<ByteBuffer> buffer(std::make_unique<ByteBuffer>(optionalSize.value()));
+	buffer->resize(optionalSize.value());
 
-		if(bitShift >= 8) {
-			bitShift -= 8;
-			buffer->writeByte(value >> bitShift);
-			value &= (1 << bitShift) - 1;
-		}
-	}
-
-	if(bitShift != paddingLength * 2) {
-		spdlog::error("Malformed base 64 data.");
+	if(!Utilities::decodeBase64(base64, *buffer->m_data)) {
+		spdlog::error("Invalid base 64 data.");
 		return nullptr;
 	}
 
@@ -2653,13 +2445,31 @@ std::string ByteBuffer::hexadecimalToBinary(const std::string & hexadecimal) {
 }
 
 std::string ByteBuffer::hexadecimalToBase64(const std::string & hexadecimal) {
-	std::unique_ptr<ByteBuffer> buffer(fromHexadecimal(hexadecimal));
+	// decode and re-encode in chunks which are a multiple of 3 bytes long, so that padding only ever ends up after the final chunk
+	static constexpr size_t CHUNK_SIZE = 3 * 1024;
 
-	if(buffer == nullptr) {
+	std::optional<size_t> optionalSize(Utilities::getHexadecimalDecodedLength(hexadecimal));
+
+	if(!optionalSize.has_value()) {
 		return {};
 	}
 
-	return buffer->toBase64();
+	std::array<uint8_t, CHUNK_SIZE> chunk;
+	std::string base64(Utilities::getBase64EncodedLength(optionalSize.value()), '\0');
+	size_t base64Offset = 0;
+
+	for(size_t offset = 0; offset < optionalSize.value(); offset += CHUNK_SIZE) {
+		size_t chunkSize = std::min(CHUNK_SIZE, optionalSize.value() - offset);
+
+		if(!Utilities::decodeHexadecimal(std::string_view(hexadecimal).substr(offset * 2, chunkSize * 2), chunk)) {
+			return {};
+		}
+
+		Utilities::encodeBase64(std::span<const uint8_t>(chunk.data(), chunkSize), std::span<char>(base64).subspan(base64Offset));
+		base64Offset += Utilities::getBase64EncodedLength(chunkSize);
+	}
+
+	return base64;
 }
 
 std::string ByteBuffer::base64ToBinary(const std::string & base64) {
@@ -2673,13 +2483,38 @@ std::string ByteBuffer::base64ToBinary(const std::string & base64) {
 }
 
 std::string ByteBuffer::base64ToHexadecimal(const std::string & base64) {
-	std::unique_ptr<ByteBuffer> buffer(fromBase64(base64));
+	// decode whole quartets in chunks, so that padding is only ever present in the final chunk
+	static constexpr size_t CHUNK_SIZE = 3 * 1024;
+	static constexpr size_t BASE_64_CHUNK_LENGTH = (CHUNK_SIZE / 3) * 4;
 
-	if(buffer == nullptr) {
+	std::optional<size_t> optionalSize(Utilities::getBase64DecodedLength(base64));
+
+	if(!optionalSize.has_value()) {
 		return {};
 	}
 
-	return buffer->toHexadecimal();
+	std::array<uint8_t, CHUNK_SIZE> chunk;
+	std::string hexadecimal(Utilities::getHexadecimalEncodedLength(optionalSize.value()), '\0');
+	size_t hexadecimalOffset = 0;
+
+	for(size_t offset = 0; offset < base64.length(); offset += BASE_64_CHUNK_LENGTH) {
+		std::string_view base64Chunk(std::string_view(base64).substr(offset, BASE_64_CHUNK_LENGTH));
+		size_t chunkSize = Utilities::getBase64DecodedLength(base64Chunk).value();
+
+		if(!Utilities::decodeBase64(base64Chunk, chunk)) {
+			return {};
+		}
+
+		Utilities::encodeHexadecimal(std::span<const uint8_t>(chunk.data(), chunkSize), std::span<char>(hexadecimal).subspan(hexadecimalOffset));
+		hexadecimalOffset += Utilities::getHexadecimalEncodedLength(chunkSize);
+	}
+
+	// padding is only valid at the very end of the data
+	if(hexadecimalOffset != hexadecimal.length()) {
+		return {};
+	}
+
+	return hexadecimal;
 }
 
 const ByteBuffer & ByteBuffer::emptyByteBuffer() {
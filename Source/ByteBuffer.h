@@ -2,13 +2,20 @@
 #define _BYTE_BUFFER_H_
 
 #include "Endianness.h"
+#include "Utilities/SIMDUtilities.h"
 
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 class ByteBuffer final {
@@ -33,6 +40,14 @@ public:
 		ZStandard
 	};
 
+	struct CompressionOptions {
+		std::optional<int32_t> level;
+		bool extreme = false;
+		std::optional<uint8_t> windowSizeLog;
+		std::shared_ptr<const ByteBuffer> dictionary;
+		uint32_t numberOfThreads = 1;
+	};
+
 	ByteBuffer(Endianness endianness = DEFAULT_ENDIANNESS);
 	ByteBuffer(size_t initialCapacity, Endianness endianness = DEFAULT_ENDIANNESS);
 	ByteBuffer(const uint8_t * data, size_t size, Endianness endianness = DEFAULT_ENDIANNESS);
@@ -82,6 +97,9 @@ public:
 	template <class A>
 	std::string getHash(HashFormat hashFormat = DEFAULT_HASH_FORMAT) const;
 	std::string getHash(HashType hashType, HashFormat hashFormat = DEFAULT_HASH_FORMAT) const;
+	template <class A>
+	static std::string getHash(const uint8_t * data, size_t size, HashFormat hashFormat = DEFAULT_HASH_FORMAT);
+	static std::string getHash(const uint8_t * data, size_t size, HashType hashType, HashFormat hashFormat = DEFAULT_HASH_FORMAT);
 
 	size_t getReadOffset() const;
 	void setReadOffset(size_t offset) const;
@@ -133,6 +151,14 @@ public:
 	template <size_t N>
 	std::unique_ptr<std::array<uint8_t, N>> getBytes(size_t offset) const;
 	std::unique_ptr<std::vector<uint8_t>> getBytes(size_t numberOfBytes, size_t offset) const;
+	template <Endianness E, typename T, size_t N>
+	bool getArray(std::span<T, N> values, size_t offset) const;
+	template <Endianness E, typename T, size_t N>
+	bool getArray(std::array<T, N> & values, size_t offset) const;
+	template <Endianness E, typename T, size_t N>
+	bool getArray(T (& values)[N], size_t offset) const;
+	template <Endianness E, typename... Fields>
+	std::optional<std::tuple<Fields...>> getStruct(size_t offset) const;
 
 	int8_t peekByte(bool * error) const;
 	std::optional<int8_t> peekByte() const;
@@ -195,6 +221,14 @@ public:
 	template <size_t N>
 	std::unique_ptr<std::array<uint8_t, N>> readBytes() const;
 	std::unique_ptr<std::vector<uint8_t>> readBytes(size_t numberOfBytes) const;
+	template <Endianness E, typename T, size_t N>
+	bool readArray(std::span<T, N> values) const;
+	template <Endianness E, typename T, size_t N>
+	bool readArray(std::array<T, N> & values) const;
+	template <Endianness E, typename T, size_t N>
+	bool readArray(T (& values)[N]) const;
+	template <Endianness E, typename... Fields>
+	std::optional<std::tuple<Fields...>> readStruct() const;
 
 	bool putByte(int8_t value, size_t offset);
 	bool putUnsignedByte(uint8_t value, size_t offset);
@@ -215,6 +249,8 @@ public:
 	bool putBytes(const std::vector<uint8_t> & data, size_t offset);
 	bool putBytes(const ByteBuffer & buffer, size_t offset);
 	bool putBytes(const std::shared_ptr<const ByteBuffer> & buffer, size_t offset);
+	template <Endianness E, typename T, size_t N>
+	bool putArray(std::span<T, N> values, size_t offset);
 
 	bool insertByte(int8_t value, size_t offset);
 	bool insertUnsignedByte(uint8_t value, size_t offset);
@@ -257,8 +293,17 @@ public:
 	bool writeBytes(const std::vector<uint8_t> & data);
 	bool writeBytes(const ByteBuffer & buffer);
 	bool writeBytes(const std::shared_ptr<const ByteBuffer> & buffer);
+	template <Endianness E, typename T, size_t N>
+	bool writeArray(std::span<T, N> values);
+	template <Endianness E, typename... Fields>
+	bool writeStruct(const Fields & ... fields);
 
 	bool containsString(const std::string & value, bool caseSensitive = true) const;
+	std::optional<size_t> indexOf(uint8_t value, size_t offset = 0) const;
+	std::optional<size_t> indexOf(const uint8_t * data, size_t size, size_t offset = 0, bool caseSensitive = true) const;
+	std::optional<size_t> indexOf(std::string_view value, size_t offset = 0, bool caseSensitive = true) const;
+	std::vector<size_t> findAll(const uint8_t * data, size_t size, size_t offset = 0, bool caseSensitive = true) const;
+	std::vector<size_t> findAll(std::string_view value, size_t offset = 0, bool caseSensitive = true) const;
 
 	std::unique_ptr<ByteBuffer> diff(const ByteBuffer &targetData);
 	std::unique_ptr<ByteBuffer> patch(const ByteBuffer &diffData);
@@ -266,12 +311,16 @@ public:
 	std::unique_ptr<ByteBuffer> clone() const;
 	std::unique_ptr<ByteBuffer> copyOfRange(size_t start, size_t end) const;
 	std::unique_ptr<ByteBuffer> decompressed(CompressionMethod compressionMethod, size_t offset = 0, size_t size = std::numeric_limits<size_t>::max()) const;
+	std::unique_ptr<ByteBuffer> decompressed(CompressionMethod compressionMethod, const CompressionOptions & options, size_t offset = 0, size_t size = std::numeric_limits<size_t>::max()) const;
 	std::unique_ptr<ByteBuffer> compressed(CompressionMethod compressionMethod, size_t offset = 0, size_t size = std::numeric_limits<size_t>::max()) const;
+	std::unique_ptr<ByteBuffer> compressed(CompressionMethod compressionMethod, const CompressionOptions & options, size_t offset = 0, size_t size = std::numeric_limits<size_t>::max()) const;
 	std::string toString() const;
 	std::string_view toStringView() const;
 	std::string toBinary() const;
 	std::string toHexadecimal(bool uppercase = false) const;
+	bool toHexadecimal(std::span<char> output, bool uppercase = false) const;
 	std::string toBase64() const;
+	bool toBase64(std::span<char> output) const;
 
 	static std::unique_ptr<ByteBuffer> fromBinary(const std::string & binary);
 	static std::unique_ptr<ByteBuffer> fromHexadecimal(const std::string & hexadecimal);
@@ -335,12 +384,17 @@ void ByteBuffer::setData(const std::array<uint8_t, N> & data) {
 
 template <class A>
 std::string ByteBuffer::getHash(HashFormat hashFormat) const {
-	if(isEmpty()) {
+	return getHash<A>(m_data->data(), m_data->size(), hashFormat);
+}
+
+template <class A>
+std::string ByteBuffer::getHash(const uint8_t * data, size_t size, HashFormat hashFormat) {
+	if(data == nullptr || size == 0) {
 		return {};
 	}
 
 	A hash;
-	hash.Update(m_data->data(), m_data->size());
+	hash.Update(data, size);
 	ByteBuffer digest(hash.DigestSize());
 	digest.resize(hash.DigestSize());
 	hash.Final(digest.getRawData());
@@ -381,6 +435,98 @@ std::unique_ptr<std::array<uint8_t, N>> ByteBuffer::readBytes() const {
 	return bytes;
 }
 
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::getArray(std::span<T, N> values, size_t offset) const {
+	static_assert(isEndianValueType<T>(), "Arrays can only contain 1, 2, 4 or 8 byte arithmetic values.");
+
+	if(offset > m_data->size() || m_data->size() - offset < values.size_bytes()) {
+		return false;
+	}
+
+	if constexpr(sizeof(T) == 1 || isNativeEndianness<E>()) {
+		std::memcpy(values.data(), m_data->data() + offset, values.size_bytes());
+	}
+	else {
+		Utilities::reverseByteOrder(m_data->data() + offset, reinterpret_cast<uint8_t *>(values.data()), sizeof(T), values.size());
+	}
+
+	return true;
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::getArray(std::array<T, N> & values, size_t offset) const {
+	return getArray<E>(std::span<T, N>(values), offset);
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::getArray(T (& values)[N], size_t offset) const {
+	return getArray<E>(std::span<T, N>(values), offset);
+}
+
+template <Endianness E, typename... Fields>
+std::optional<std::tuple<Fields...>> ByteBuffer::getStruct(size_t offset) const {
+	static constexpr size_t STRUCT_SIZE = (sizeof(Fields) + ... + 0);
+
+	if(offset > m_data->size() || m_data->size() - offset < STRUCT_SIZE) {
+		return {};
+	}
+
+	const uint8_t * fieldData = m_data->data() + offset;
+
+	// braced initialization evaluates the fields in order
+	return std::tuple<Fields...>{fromEndianBytes<E, Fields>(std::exchange(fieldData, fieldData + sizeof(Fields)))...};
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::readArray(std::span<T, N> values) const {
+	if(!getArray<E>(values, m_readOffset)) {
+		return false;
+	}
+
+	m_readOffset += values.size_bytes();
+
+	return true;
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::readArray(std::array<T, N> & values) const {
+	return readArray<E>(std::span<T, N>(values));
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::readArray(T (& values)[N]) const {
+	return readArray<E>(std::span<T, N>(values));
+}
+
+template <Endianness E, typename... Fields>
+std::optional<std::tuple<Fields...>> ByteBuffer::readStruct() const {
+	std::optional<std::tuple<Fields...>> fields(getStruct<E, Fields...>(m_readOffset));
+
+	if(fields.has_value()) {
+		m_readOffset += (sizeof(Fields) + ... + 0);
+	}
+
+	return fields;
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::putArray(std::span<T, N> values, size_t offset) {
+	static_assert(isEndianValueType<std::remove_cv_t<T>>(), "Arrays can only contain 1, 2, 4 or 8 byte arithmetic values.");
+
+	if(!autoResize(offset, values.size_bytes())) {
+		return false;
+	}
+
+	if constexpr(sizeof(T) == 1 || isNativeEndianness<E>()) {
+		std::memcpy(m_data->data() + offset, values.data(), values.size_bytes());
+	}
+	else {
+		Utilities::reverseByteOrder(reinterpret_cast<const uint8_t *>(values.data()), m_data->data() + offset, sizeof(T), values.size());
+	}
+
+	return true;
+}
+
 template <size_t N>
 bool ByteBuffer::putBytes(const std::array<uint8_t, N> & data, size_t offset) {
 	return putBytes(data.data(), data.size(), offset);
@@ -402,4 +548,32 @@ bool ByteBuffer::writeBytes(const std::array<uint8_t, N> & data) {
 	return false;
 }
 
+template <Endianness E, typename T, size_t N>
+bool ByteBuffer::writeArray(std::span<T, N> values) {
+	if(putArray<E>(values, m_writeOffset)) {
+		m_writeOffset += values.size_bytes();
+
+		return true;
+	}
+
+	return false;
+}
+
+template <Endianness E, typename... Fields>
+bool ByteBuffer::writeStruct(const Fields & ... fields) {
+	static constexpr size_t STRUCT_SIZE = (sizeof(Fields) + ... + 0);
+
+	if(!autoResize(m_writeOffset, STRUCT_SIZE)) {
+		return false;
+	}
+
+	uint8_t * fieldData = m_data->data() + m_writeOffset;
+
+	(toEndianBytes<E>(fields, std::exchange(fieldData, fieldData + sizeof(Fields))), ...);
+
+	m_writeOffset += STRUCT_SIZE;
+
+	return true;
+}
+
 #endif // _BYTE_BUFFER_H_
@@ -0,0 +1,1173 @@
+#include "ByteBufferView.h"
+
+#include "Utilities/SIMDUtilities.h"
+
+#include <double-conversion/ieee.h>
+
+#include <algorithm>
+#include <cstring>
+
+ByteBufferView::ByteBufferView(Endianness endianness)
+	: m_endianness(endianness)
+	, m_readOffset(0) { }
+
+ByteBufferView::ByteBufferView(const uint8_t * data, size_t size, Endianness endianness)
+	: m_data(data, data == nullptr ? 0 : size)
+	, m_endianness(endianness)
+	, m_readOffset(0) { }
+
+ByteBufferView::ByteBufferView(std::span<const uint8_t> data, Endianness endianness)
+	: m_data(data)
+	, m_endianness(endianness)
+	, m_readOffset(0) { }
+
+ByteBufferView::ByteBufferView(std::string_view data, Endianness endianness)
+	: m_data(reinterpret_cast<const uint8_t *>(data.data()), data.length())
+	, m_endianness(endianness)
+	, m_readOffset(0) { }
+
+ByteBufferView::ByteBufferView(const ByteBuffer & buffer)
+	: m_data(buffer.getData())
+	, m_endianness(buffer.getEndianness())
+	, m_readOffset(0) { }
+
+ByteBufferView::ByteBufferView(const ByteBufferView & view)
+	: m_data(view.m_data)
+	, m_endianness(view.m_endianness)
+	, m_readOffset(view.m_readOffset) { }
+
+ByteBufferView & ByteBufferView::operator = (const ByteBufferView & view) {
+	m_data = view.m_data;
+	m_endianness = view.m_endianness;
+	m_readOffset = view.m_readOffset;
+
+	return *this;
+}
+
+ByteBufferView::~ByteBufferView() { }
+
+std::span<const uint8_t> ByteBufferView::getData() const {
+	return m_data;
+}
+
+const uint8_t * ByteBufferView::getRawData() const {
+	return m_data.data();
+}
+
+bool ByteBufferView::isEmpty() const {
+	return m_data.empty();
+}
+
+bool ByteBufferView::isNotEmpty() const {
+	return !m_data.empty();
+}
+
+size_t ByteBufferView::getSize() const {
+	return m_data.size();
+}
+
+Endianness ByteBufferView::getEndianness() const {
+	return m_endianness;
+}
+
+void ByteBufferView::setEndianness(Endianness endianness) const {
+	m_endianness = endianness;
+}
+
+size_t ByteBufferView::getReadOffset() const {
+	return m_readOffset;
+}
+
+void ByteBufferView::setReadOffset(size_t offset) const {
+	m_readOffset = offset > m_data.size() ? m_data.size() : offset;
+}
+
+bool ByteBufferView::canReadBytes(size_t numberOfBytes) const {
+	return canReadBytesAt(m_readOffset, numberOfBytes);
+}
+
+bool ByteBufferView::skipReadBytes(size_t numberOfBytes) const {
+	if(!canReadBytes(numberOfBytes)) {
+		return false;
+	}
+
+	m_readOffset += numberOfBytes;
+
+	return true;
+}
+
+bool ByteBufferView::hasMoreLines() const {
+	return m_readOffset < m_data.size();
+}
+
+size_t ByteBufferView::indexOfNextLineFrom(size_t offset, size_t * lineEndOffset) const {
+	if(offset >= m_data.size()) {
+		return std::numeric_limits<size_t>::max();
+	}
+
+	std::optional<size_t> optionalLineBreakOffset(Utilities::findEitherByte(m_data.data() + offset, m_data.size() - offset, '\n', '\r'));
+
+	if(!optionalLineBreakOffset.has_value()) {
+		if(lineEndOffset != nullptr) {
+			*lineEndOffset = m_data.size();
+		}
+
+		return m_data.size();
+	}
+
+	size_t lineBreakOffset = offset + optionalLineBreakOffset.value();
+
+	if(lineEndOffset != nullptr) {
+		*lineEndOffset = lineBreakOffset;
+	}
+
+	// lines end with a line feed, a carriage return, or a carriage return followed by a line feed
+	if(m_data[lineBreakOffset] == '\r' && lineBreakOffset + 1 < m_data.size() && m_data[lineBreakOffset + 1] == '\n') {
+		return lineBreakOffset + 2;
+	}
+
+	return lineBreakOffset + 1;
+}
+
+size_t ByteBufferView::numberOfBytesRemaining() const {
+	return m_data.size() - m_readOffset;
+}
+
+ByteBufferView ByteBufferView::getRemainingBytes() const {
+	return ByteBufferView(m_data.subspan(m_readOffset), m_endianness);
+}
+
+bool ByteBufferView::isEndOfBuffer() const {
+	return m_readOffset >= m_data.size();
+}
+
+void ByteBufferView::resetReadOffset() const {
+	setReadOffset(0);
+}
+
+int8_t ByteBufferView::getByte(size_t offset, bool * error) const {
+	return static_cast<int8_t>(getUnsignedByte(offset, error));
+}
+
+std::optional<int8_t> ByteBufferView::getByte(size_t offset) const {
+	bool error = false;
+
+	int8_t value = getByte(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint8_t ByteBufferView::getUnsignedByte(size_t offset, bool * error) const {
+	if(!canReadBytesAt(offset, sizeof(uint8_t))) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return 0;
+	}
+
+	return m_data[offset];
+}
+
+std::optional<uint8_t> ByteBufferView::getUnsignedByte(size_t offset) const {
+	bool error = false;
+
+	uint8_t value = getUnsignedByte(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int16_t ByteBufferView::getShort(size_t offset, bool * error) const {
+	return static_cast<int16_t>(getUnsignedShort(offset, error));
+}
+
+std::optional<int16_t> ByteBufferView::getShort(size_t offset) const {
+	bool error = false;
+
+	int16_t value = getShort(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint16_t ByteBufferView::getUnsignedShort(size_t offset, bool * error) const {
+	if(!canReadBytesAt(offset, sizeof(uint16_t))) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return 0;
+	}
+
+	uint16_t value = 0u;
+	std::memcpy(&value, m_data.data() + offset, sizeof(uint16_t));
+
+	return fromEndian(value, m_endianness);
+}
+
+std::optional<uint16_t> ByteBufferView::getUnsignedShort(size_t offset) const {
+	bool error = false;
+
+	uint16_t value = getUnsignedShort(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int32_t ByteBufferView::getInteger(size_t offset, bool * error) const {
+	return static_cast<int32_t>(getUnsignedInteger(offset, error));
+}
+
+std::optional<int32_t> ByteBufferView::getInteger(size_t offset) const {
+	bool error = false;
+
+	int32_t value = getInteger(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint32_t ByteBufferView::getUnsignedInteger(size_t offset, bool * error) const {
+	if(!canReadBytesAt(offset, sizeof(uint32_t))) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return 0;
+	}
+
+	uint32_t value = 0u;
+	std::memcpy(&value, m_data.data() + offset, sizeof(uint32_t));
+
+	return fromEndian(value, m_endianness);
+}
+
+std::optional<uint32_t> ByteBufferView::getUnsignedInteger(size_t offset) const {
+	bool error = false;
+
+	uint32_t value = getUnsignedInteger(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int64_t ByteBufferView::getLong(size_t offset, bool * error) const {
+	return static_cast<int64_t>(getUnsignedLong(offset, error));
+}
+
+std::optional<int64_t> ByteBufferView::getLong(size_t offset) const {
+	bool error = false;
+
+	int64_t value = getLong(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint64_t ByteBufferView::getUnsignedLong(size_t offset, bool * error) const {
+	if(!canReadBytesAt(offset, sizeof(uint64_t))) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return 0;
+	}
+
+	uint64_t value = 0u;
+	std::memcpy(&value, m_data.data() + offset, sizeof(uint64_t));
+
+	return fromEndian(value, m_endianness);
+}
+
+std::optional<uint64_t> ByteBufferView::getUnsignedLong(size_t offset) const {
+	bool error = false;
+
+	uint64_t value = getUnsignedLong(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+float ByteBufferView::getFloat(size_t offset, bool * error) const {
+	return double_conversion::uint32_to_float(getUnsignedInteger(offset, error));
+}
+
+std::optional<float> ByteBufferView::getFloat(size_t offset) const {
+	bool error = false;
+
+	float value = getFloat(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+double ByteBufferView::getDouble(size_t offset, bool * error) const {
+	return double_conversion::uint64_to_double(getUnsignedLong(offset, error));
+}
+
+std::optional<double> ByteBufferView::getDouble(size_t offset) const {
+	bool error = false;
+
+	double value = getDouble(offset, &error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::getString(size_t length, size_t offset, bool * error) const {
+	if(!canReadBytesAt(offset, length)) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return {};
+	}
+
+	// fixed length strings end early at the first null terminator
+	std::optional<size_t> optionalNullTerminatorIndex(Utilities::findByte(m_data.data() + offset, length, 0));
+
+	return std::string_view(reinterpret_cast<const char *>(m_data.data() + offset), optionalNullTerminatorIndex.has_value() ? optionalNullTerminatorIndex.value() : length);
+}
+
+std::optional<std::string_view> ByteBufferView::getString(size_t length, size_t offset) const {
+	bool error = false;
+
+	std::string_view value(getString(length, offset, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::getNullTerminatedString(size_t offset, bool * error) const {
+	if(offset >= m_data.size()) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return {};
+	}
+
+	// an unterminated string runs until the end of the data
+	std::optional<size_t> optionalNullTerminatorIndex(Utilities::findByte(m_data.data() + offset, m_data.size() - offset, 0));
+
+	return std::string_view(reinterpret_cast<const char *>(m_data.data() + offset), optionalNullTerminatorIndex.has_value() ? optionalNullTerminatorIndex.value() : m_data.size() - offset);
+}
+
+std::optional<std::string_view> ByteBufferView::getNullTerminatedString(size_t offset) const {
+	bool error = false;
+
+	std::string_view value(getNullTerminatedString(offset, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::getLine(size_t offset, size_t * nextLineIndex, bool * error) const {
+	if(offset >= m_data.size()) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return {};
+	}
+
+	size_t lineEndOffset = m_data.size();
+	size_t nextLineIndexInternal = indexOfNextLineFrom(offset, &lineEndOffset);
+
+	if(nextLineIndex != nullptr) {
+		*nextLineIndex = nextLineIndexInternal;
+	}
+
+	return std::string_view(reinterpret_cast<const char *>(m_data.data() + offset), lineEndOffset - offset);
+}
+
+std::optional<std::string_view> ByteBufferView::getLine(size_t offset, size_t * nextLineIndex) const {
+	bool error = false;
+
+	std::string_view value(getLine(offset, nextLineIndex, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::span<const uint8_t> ByteBufferView::getBytes(size_t numberOfBytes, size_t offset, bool * error) const {
+	if(!canReadBytesAt(offset, numberOfBytes)) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return {};
+	}
+
+	return m_data.subspan(offset, numberOfBytes);
+}
+
+std::optional<std::span<const uint8_t>> ByteBufferView::getBytes(size_t numberOfBytes, size_t offset) const {
+	bool error = false;
+
+	std::span<const uint8_t> value(getBytes(numberOfBytes, offset, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int8_t ByteBufferView::peekByte(bool * error) const {
+	return getByte(m_readOffset, error);
+}
+
+std::optional<int8_t> ByteBufferView::peekByte() const {
+	bool error = false;
+
+	int8_t value = peekByte(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint8_t ByteBufferView::peekUnsignedByte(bool * error) const {
+	return getUnsignedByte(m_readOffset, error);
+}
+
+std::optional<uint8_t> ByteBufferView::peekUnsignedByte() const {
+	bool error = false;
+
+	uint8_t value = peekUnsignedByte(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int16_t ByteBufferView::peekShort(bool * error) const {
+	return getShort(m_readOffset, error);
+}
+
+std::optional<int16_t> ByteBufferView::peekShort() const {
+	bool error = false;
+
+	int16_t value = peekShort(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint16_t ByteBufferView::peekUnsignedShort(bool * error) const {
+	return getUnsignedShort(m_readOffset, error);
+}
+
+std::optional<uint16_t> ByteBufferView::peekUnsignedShort() const {
+	bool error = false;
+
+	uint16_t value = peekUnsignedShort(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int32_t ByteBufferView::peekInteger(bool * error) const {
+	return getInteger(m_readOffset, error);
+}
+
+std::optional<int32_t> ByteBufferView::peekInteger() const {
+	bool error = false;
+
+	int32_t value = peekInteger(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint32_t ByteBufferView::peekUnsignedInteger(bool * error) const {
+	return getUnsignedInteger(m_readOffset, error);
+}
+
+std::optional<uint32_t> ByteBufferView::peekUnsignedInteger() const {
+	bool error = false;
+
+	uint32_t value = peekUnsignedInteger(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int64_t ByteBufferView::peekLong(bool * error) const {
+	return getLong(m_readOffset, error);
+}
+
+std::optional<int64_t> ByteBufferView::peekLong() const {
+	bool error = false;
+
+	int64_t value = peekLong(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint64_t ByteBufferView::peekUnsignedLong(bool * error) const {
+	return getUnsignedLong(m_readOffset, error);
+}
+
+std::optional<uint64_t> ByteBufferView::peekUnsignedLong() const {
+	bool error = false;
+
+	uint64_t value = peekUnsignedLong(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+float ByteBufferView::peekFloat(bool * error) const {
+	return getFloat(m_readOffset, error);
+}
+
+std::optional<float> ByteBufferView::peekFloat() const {
+	bool error = false;
+
+	float value = peekFloat(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+double ByteBufferView::peekDouble(bool * error) const {
+	return getDouble(m_readOffset, error);
+}
+
+std::optional<double> ByteBufferView::peekDouble() const {
+	bool error = false;
+
+	double value = peekDouble(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::peekString(size_t length, bool * error) const {
+	return getString(length, m_readOffset, error);
+}
+
+std::optional<std::string_view> ByteBufferView::peekString(size_t length) const {
+	bool error = false;
+
+	std::string_view value(peekString(length, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::peekNullTerminatedString(bool * error) const {
+	return getNullTerminatedString(m_readOffset, error);
+}
+
+std::optional<std::string_view> ByteBufferView::peekNullTerminatedString() const {
+	bool error = false;
+
+	std::string_view value(peekNullTerminatedString(&error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::peekLine(bool * error) const {
+	return getLine(m_readOffset, nullptr, error);
+}
+
+std::optional<std::string_view> ByteBufferView::peekLine() const {
+	bool error = false;
+
+	std::string_view value(peekLine(&error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::span<const uint8_t> ByteBufferView::peekBytes(size_t numberOfBytes, bool * error) const {
+	return getBytes(numberOfBytes, m_readOffset, error);
+}
+
+std::optional<std::span<const uint8_t>> ByteBufferView::peekBytes(size_t numberOfBytes) const {
+	bool error = false;
+
+	std::span<const uint8_t> value(peekBytes(numberOfBytes, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int8_t ByteBufferView::readByte(bool * error) const {
+	bool e = false;
+	int8_t value = getByte(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(int8_t);
+	}
+
+	return value;
+}
+
+std::optional<int8_t> ByteBufferView::readByte() const {
+	bool error = false;
+
+	int8_t value = readByte(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint8_t ByteBufferView::readUnsignedByte(bool * error) const {
+	bool e = false;
+	uint8_t value = getUnsignedByte(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(uint8_t);
+	}
+
+	return value;
+}
+
+std::optional<uint8_t> ByteBufferView::readUnsignedByte() const {
+	bool error = false;
+
+	uint8_t value = readUnsignedByte(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int16_t ByteBufferView::readShort(bool * error) const {
+	bool e = false;
+	int16_t value = getShort(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(int16_t);
+	}
+
+	return value;
+}
+
+std::optional<int16_t> ByteBufferView::readShort() const {
+	bool error = false;
+
+	int16_t value = readShort(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint16_t ByteBufferView::readUnsignedShort(bool * error) const {
+	bool e = false;
+	uint16_t value = getUnsignedShort(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(uint16_t);
+	}
+
+	return value;
+}
+
+std::optional<uint16_t> ByteBufferView::readUnsignedShort() const {
+	bool error = false;
+
+	uint16_t value = readUnsignedShort(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int32_t ByteBufferView::readInteger(bool * error) const {
+	bool e = false;
+	int32_t value = getInteger(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(int32_t);
+	}
+
+	return value;
+}
+
+std::optional<int32_t> ByteBufferView::readInteger() const {
+	bool error = false;
+
+	int32_t value = readInteger(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint32_t ByteBufferView::readUnsignedInteger(bool * error) const {
+	bool e = false;
+	uint32_t value = getUnsignedInteger(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(uint32_t);
+	}
+
+	return value;
+}
+
+std::optional<uint32_t> ByteBufferView::readUnsignedInteger() const {
+	bool error = false;
+
+	uint32_t value = readUnsignedInteger(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+int64_t ByteBufferView::readLong(bool * error) const {
+	bool e = false;
+	int64_t value = getLong(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(int64_t);
+	}
+
+	return value;
+}
+
+std::optional<int64_t> ByteBufferView::readLong() const {
+	bool error = false;
+
+	int64_t value = readLong(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+uint64_t ByteBufferView::readUnsignedLong(bool * error) const {
+	bool e = false;
+	uint64_t value = getUnsignedLong(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(uint64_t);
+	}
+
+	return value;
+}
+
+std::optional<uint64_t> ByteBufferView::readUnsignedLong() const {
+	bool error = false;
+
+	uint64_t value = readUnsignedLong(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+float ByteBufferView::readFloat(bool * error) const {
+	bool e = false;
+	float value = getFloat(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(float);
+	}
+
+	return value;
+}
+
+std::optional<float> ByteBufferView::readFloat() const {
+	bool error = false;
+
+	float value = readFloat(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+double ByteBufferView::readDouble(bool * error) const {
+	bool e = false;
+	double value = getDouble(m_readOffset, &e);
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += sizeof(double);
+	}
+
+	return value;
+}
+
+std::optional<double> ByteBufferView::readDouble() const {
+	bool error = false;
+
+	double value = readDouble(&error);
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::readString(size_t length, bool * error) const {
+	bool e = false;
+	std::string_view value(getString(length, m_readOffset, &e));
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += length;
+	}
+
+	return value;
+}
+
+std::optional<std::string_view> ByteBufferView::readString(size_t length) const {
+	bool error = false;
+
+	std::string_view value(readString(length, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::readFixedLengthString(size_t length, size_t fixedLength, bool * error) const {
+	if(length > fixedLength || !canReadBytes(fixedLength)) {
+		if(error != nullptr) {
+			*error = true;
+		}
+
+		return {};
+	}
+
+	std::string_view value(getString(length, m_readOffset, error));
+	m_readOffset += fixedLength;
+
+	return value;
+}
+
+std::optional<std::string_view> ByteBufferView::readFixedLengthString(size_t length, size_t fixedLength) const {
+	bool error = false;
+
+	std::string_view value(readFixedLengthString(length, fixedLength, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::readNullTerminatedString(bool * error) const {
+	bool e = false;
+	std::string_view value(getNullTerminatedString(m_readOffset, &e));
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		// skip over the null terminator as well, if there is one
+		setReadOffset(m_readOffset + value.length() + 1);
+	}
+
+	return value;
+}
+
+std::optional<std::string_view> ByteBufferView::readNullTerminatedString() const {
+	bool error = false;
+
+	std::string_view value(readNullTerminatedString(&error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::string_view ByteBufferView::readLine(bool * error) const {
+	bool e = false;
+	size_t nextLineIndex = std::numeric_limits<size_t>::max();
+	std::string_view line(getLine(m_readOffset, &nextLineIndex, &e));
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset = nextLineIndex;
+	}
+
+	return line;
+}
+
+std::optional<std::string_view> ByteBufferView::readLine() const {
+	bool error = false;
+
+	std::string_view value(readLine(&error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+std::span<const uint8_t> ByteBufferView::readBytes(size_t numberOfBytes, bool * error) const {
+	bool e = false;
+	std::span<const uint8_t> value(getBytes(numberOfBytes, m_readOffset, &e));
+
+	if(e) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		m_readOffset += numberOfBytes;
+	}
+
+	return value;
+}
+
+std::optional<std::span<const uint8_t>> ByteBufferView::readBytes(size_t numberOfBytes) const {
+	bool error = false;
+
+	std::span<const uint8_t> value(readBytes(numberOfBytes, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+bool ByteBufferView::containsString(std::string_view value, bool caseSensitive) const {
+	return indexOf(value, 0, caseSensitive).has_value();
+}
+
+std::optional<size_t> ByteBufferView::indexOf(uint8_t value, size_t offset) const {
+	if(offset >= m_data.size()) {
+		return {};
+	}
+
+	std::optional<size_t> optionalIndex(Utilities::findByte(m_data.data() + offset, m_data.size() - offset, value));
+
+	if(!optionalIndex.has_value()) {
+		return {};
+	}
+
+	return offset + optionalIndex.value();
+}
+
+std::optional<size_t> ByteBufferView::indexOf(std::string_view value, size_t offset, bool caseSensitive) const {
+	if(offset > m_data.size()) {
+		return {};
+	}
+
+	std::optional<size_t> optionalIndex(Utilities::findBytes(m_data.data() + offset, m_data.size() - offset, reinterpret_cast<const uint8_t *>(value.data()), value.length(), caseSensitive));
+
+	if(!optionalIndex.has_value()) {
+		return {};
+	}
+
+	return offset + optionalIndex.value();
+}
+
+std::optional<ByteBufferView> ByteBufferView::viewOfRange(size_t start, size_t end) const {
+	if(start >= end || end >= m_data.size()) {
+		return {};
+	}
+
+	return ByteBufferView(m_data.subspan(start, end - start + 1), m_endianness);
+}
+
+std::unique_ptr<ByteBuffer> ByteBufferView::copyOfRange(size_t start, size_t end) const {
+	if(start >= end || end >= m_data.size()) {
+		return nullptr;
+	}
+
+	return std::make_unique<ByteBuffer>(m_data.data() + start, end - start + 1, m_endianness);
+}
+
+std::unique_ptr<ByteBuffer> ByteBufferView::toByteBuffer() const {
+	return std::make_unique<ByteBuffer>(m_data.data(), m_data.size(), m_endianness);
+}
+
+std::string_view ByteBufferView::toStringView() const {
+	return std::string_view(reinterpret_cast<const char *>(m_data.data()), m_data.size());
+}
+
+uint8_t ByteBufferView::operator [] (size_t index) const {
+	return m_data[index];
+}
+
+bool ByteBufferView::operator == (const ByteBufferView & view) const {
+	return std::equal(m_data.begin(), m_data.end(), view.m_data.begin(), view.m_data.end());
+}
+
+bool ByteBufferView::operator != (const ByteBufferView & view) const {
+	return !operator == (view);
+}
+
+bool ByteBufferView::canReadBytesAt(size_t offset, size_t numberOfBytes) const {
+	return offset <= m_data.size() && m_data.size() - offset >= numberOfBytes;
+}
@@ -0,0 +1,276 @@
+#ifndef _BYTE_BUFFER_VIEW_H_
+#define _BYTE_BUFFER_VIEW_H_
+
+#include "ByteBuffer.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+class ByteBufferView final {
+public:
+	ByteBufferView(Endianness endianness = ByteBuffer::DEFAULT_ENDIANNESS);
+	ByteBufferView(const uint8_t * data, size_t size, Endianness endianness = ByteBuffer::DEFAULT_ENDIANNESS);
+	ByteBufferView(std::span<const uint8_t> data, Endianness endianness = ByteBuffer::DEFAULT_ENDIANNESS);
+	ByteBufferView(std::string_view data, Endianness endianness = ByteBuffer::DEFAULT_ENDIANNESS);
+	ByteBufferView(const ByteBuffer & buffer);
+	ByteBufferView(const ByteBufferView & view);
+	ByteBufferView & operator = (const ByteBufferView & view);
+	~ByteBufferView();
+
+	std::span<const uint8_t> getData() const;
+	const uint8_t * getRawData() const;
+	bool isEmpty() const;
+	bool isNotEmpty() const;
+	size_t getSize() const;
+	Endianness getEndianness() const;
+	void setEndianness(Endianness endianness) const;
+
+	size_t getReadOffset() const;
+	void setReadOffset(size_t offset) const;
+	bool canReadBytes(size_t numberOfBytes) const;
+	bool skipReadBytes(size_t numberOfBytes) const;
+	bool hasMoreLines() const;
+	size_t indexOfNextLineFrom(size_t offset, size_t * lineEndOffset = nullptr) const;
+	size_t numberOfBytesRemaining() const;
+	ByteBufferView getRemainingBytes() const;
+	bool isEndOfBuffer() const;
+	void resetReadOffset() const;
+
+	int8_t getByte(size_t offset, bool * error) const;
+	std::optional<int8_t> getByte(size_t offset) const;
+	uint8_t getUnsignedByte(size_t offset, bool * error) const;
+	std::optional<uint8_t> getUnsignedByte(size_t offset) const;
+	int16_t getShort(size_t offset, bool * error) const;
+	std::optional<int16_t> getShort(size_t offset) const;
+	uint16_t getUnsignedShort(size_t offset, bool * error) const;
+	std::optional<uint16_t> getUnsignedShort(size_t offset) const;
+	int32_t getInteger(size_t offset, bool * error) const;
+	std::optional<int32_t> getInteger(size_t offset) const;
+	uint32_t getUnsignedInteger(size_t offset, bool * error) const;
+	std::optional<uint32_t> getUnsignedInteger(size_t offset) const;
+	int64_t getLong(size_t offset, bool * error) const;
+	std::optional<int64_t> getLong(size_t offset) const;
+	uint64_t getUnsignedLong(size_t offset, bool * error) const;
+	std::optional<uint64_t> getUnsignedLong(size_t offset) const;
+	float getFloat(size_t offset, bool * error) const;
+	std::optional<float> getFloat(size_t offset) const;
+	double getDouble(size_t offset, bool * error) const;
+	std::optional<double> getDouble(size_t offset) const;
+	std::string_view getString(size_t length, size_t offset, bool * error) const;
+	std::optional<std::string_view> getString(size_t length, size_t offset) const;
+	std::string_view getNullTerminatedString(size_t offset, bool * error) const;
+	std::optional<std::string_view> getNullTerminatedString(size_t offset) const;
+	std::string_view getLine(size_t offset, size_t * nextLineIndex, bool * error) const;
+	std::optional<std::string_view> getLine(size_t offset, size_t * nextLineIndex = nullptr) const;
+	template <size_t N>
+	std::optional<std::span<const uint8_t, N>> getBytes(size_t offset) const;
+	std::span<const uint8_t> getBytes(size_t numberOfBytes, size_t offset, bool * error) const;
+	std::optional<std::span<const uint8_t>> getBytes(size_t numberOfBytes, size_t offset) const;
+	template <Endianness E, typename T, size_t N>
+	bool getArray(std::span<T, N> values, size_t offset) const;
+	template <Endianness E, typename T, size_t N>
+	bool getArray(std::array<T, N> & values, size_t offset) const;
+	template <Endianness E, typename T, size_t N>
+	bool getArray(T (& values)[N], size_t offset) const;
+	template <Endianness E, typename... Fields>
+	std::optional<std::tuple<Fields...>> getStruct(size_t offset) const;
+
+	int8_t peekByte(bool * error) const;
+	std::optional<int8_t> peekByte() const;
+	uint8_t peekUnsignedByte(bool * error) const;
+	std::optional<uint8_t> peekUnsignedByte() const;
+	int16_t peekShort(bool * error) const;
+	std::optional<int16_t> peekShort() const;
+	uint16_t peekUnsignedShort(bool * error) const;
+	std::optional<uint16_t> peekUnsignedShort() const;
+	int32_t peekInteger(bool * error) const;
+	std::optional<int32_t> peekInteger() const;
+	uint32_t peekUnsignedInteger(bool * error) const;
+	std::optional<uint32_t> peekUnsignedInteger() const;
+	int64_t peekLong(bool * error) const;
+	std::optional<int64_t> peekLong() const;
+	uint64_t peekUnsignedLong(bool * error) const;
+	std::optional<uint64_t> peekUnsignedLong() const;
+	float peekFloat(bool * error) const;
+	std::optional<float> peekFloat() const;
+	double peekDouble(bool * error) const;
+	std::optional<double> peekDouble() const;
+	std::string_view peekString(size_t length, bool * error) const;
+	std::optional<std::string_view> peekString(size_t length) const;
+	std::string_view peekNullTerminatedString(bool * error) const;
+	std::optional<std::string_view> peekNullTerminatedString() const;
+	std::string_view peekLine(bool * error) const;
+	std::optional<std::string_view> peekLine() const;
+	template <size_t N>
+	std::optional<std::span<const uint8_t, N>> peekBytes() const;
+	std::span<const uint8_t> peekBytes(size_t numberOfBytes, bool * error) const;
+	std::optional<std::span<const uint8_t>> peekBytes(size_t numberOfBytes) const;
+
+	int8_t readByte(bool * error) const;
+	std::optional<int8_t> readByte() const;
+	uint8_t readUnsignedByte(bool * error) const;
+	std::optional<uint8_t> readUnsignedByte() const;
+	int16_t readShort(bool * error) const;
+	std::optional<int16_t> readShort() const;
+	uint16_t readUnsignedShort(bool * error) const;
+	std::optional<uint16_t> readUnsignedShort() const;
+	int32_t readInteger(bool * error) const;
+	std::optional<int32_t> readInteger() const;
+	uint32_t readUnsignedInteger(bool * error) const;
+	std::optional<uint32_t> readUnsignedInteger() const;
+	int64_t readLong(bool * error) const;
+	std::optional<int64_t> readLong() const;
+	uint64_t readUnsignedLong(bool * error) const;
+	std::optional<uint64_t> readUnsignedLong() const;
+	float readFloat(bool * error) const;
+	std::optional<float> readFloat() const;
+	double readDouble(bool * error) const;
+	std::optional<double> readDouble() const;
+	std::string_view readString(size_t length, bool * error) const;
+	std::optional<std::string_view> readString(size_t length) const;
+	std::string_view readFixedLengthString(size_t length, size_t fixedLength, bool * error) const;
+	std::optional<std::string_view> readFixedLengthString(size_t length, size_t fixedLength) const;
+	std::string_view readNullTerminatedString(bool * error) const;
+	std::optional<std::string_view> readNullTerminatedString() const;
+	std::string_view readLine(bool * error) const;
+	std::optional<std::string_view> readLine() const;
+	template <size_t N>
+	std::optional<std::span<const uint8_t, N>> readBytes() const;
+	std::span<const uint8_t> readBytes(size_t numberOfBytes, bool * error) const;
+	std::optional<std::span<const uint8_t>> readBytes(size_t numberOfBytes) const;
+	template <Endianness E, typename T, size_t N>
+	bool readArray(std::span<T, N> values) const;
+	template <Endianness E, typename T, size_t N>
+	bool readArray(std::array<T, N> & values) const;
+	template <Endianness E, typename T, size_t N>
+	bool readArray(T (& values)[N]) const;
+	template <Endianness E, typename... Fields>
+	std::optional<std::tuple<Fields...>> readStruct() const;
+
+	bool containsString(std::string_view value, bool caseSensitive = true) const;
+	std::optional<size_t> indexOf(uint8_t value, size_t offset = 0) const;
+	std::optional<size_t> indexOf(std::string_view value, size_t offset = 0, bool caseSensitive = true) const;
+
+	std::optional<ByteBufferView> viewOfRange(size_t start, size_t end) const;
+	std::unique_ptr<ByteBuffer> copyOfRange(size_t start, size_t end) const;
+	std::unique_ptr<ByteBuffer> toByteBuffer() const;
+	std::string_view toStringView() const;
+
+	uint8_t operator [] (size_t index) const;
+
+	bool operator == (const ByteBufferView & view) const;
+	bool operator != (const ByteBufferView & view) const;
+
+private:
+	bool canReadBytesAt(size_t offset, size_t numberOfBytes) const;
+
+	std::span<const uint8_t> m_data;
+	mutable Endianness m_endianness;
+	mutable size_t m_readOffset;
+};
+
+template <size_t N>
+std::optional<std::span<const uint8_t, N>> ByteBufferView::getBytes(size_t offset) const {
+	if(!canReadBytesAt(offset, N)) {
+		return {};
+	}
+
+	return m_data.subspan(offset).template first<N>();
+}
+
+template <size_t N>
+std::optional<std::span<const uint8_t, N>> ByteBufferView::peekBytes() const {
+	return getBytes<N>(m_readOffset);
+}
+
+template <size_t N>
+std::optional<std::span<const uint8_t, N>> ByteBufferView::readBytes() const {
+	std::optional<std::span<const uint8_t, N>> bytes(getBytes<N>(m_readOffset));
+
+	if(bytes.has_value()) {
+		m_readOffset += N;
+	}
+
+	return bytes;
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBufferView::getArray(std::span<T, N> values, size_t offset) const {
+	static_assert(isEndianValueType<T>(), "Arrays can only contain 1, 2, 4 or 8 byte arithmetic values.");
+
+	if(!canReadBytesAt(offset, values.size_bytes())) {
+		return false;
+	}
+
+	if constexpr(sizeof(T) == 1 || isNativeEndianness<E>()) {
+		std::memcpy(values.data(), m_data.data() + offset, values.size_bytes());
+	}
+	else {
+		Utilities::reverseByteOrder(m_data.data() + offset, reinterpret_cast<uint8_t *>(values.data()), sizeof(T), values.size());
+	}
+
+	return true;
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBufferView::getArray(std::array<T, N> & values, size_t offset) const {
+	return getArray<E>(std::span<T, N>(values), offset);
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBufferView::getArray(T (& values)[N], size_t offset) const {
+	return getArray<E>(std::span<T, N>(values), offset);
+}
+
+template <Endianness E, typename... Fields>
+std::optional<std::tuple<Fields...>> ByteBufferView::getStruct(size_t offset) const {
+	if(!canReadBytesAt(offset, (sizeof(Fields) + ... + 0))) {
+		return {};
+	}
+
+	const uint8_t * fieldData = m_data.data() + offset;
+
+	// braced initialization evaluates the fields in order
+	return std::tuple<Fields...>{fromEndianBytes<E, Fields>(std::exchange(fieldData, fieldData + sizeof(Fields)))...};
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBufferView::readArray(std::span<T, N> values) const {
+	if(!getArray<E>(values, m_readOffset)) {
+		return false;
+	}
+
+	m_readOffset += values.size_bytes();
+
+	return true;
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBufferView::readArray(std::array<T, N> & values) const {
+	return readArray<E>(std::span<T, N>(values));
+}
+
+template <Endianness E, typename T, size_t N>
+bool ByteBufferView::readArray(T (& values)[N]) const {
+	return readArray<E>(std::span<T, N>(values));
+}
+
+template <Endianness E, typename... Fields>
+std::optional<std::tuple<Fields...>> ByteBufferView::readStruct() const {
+	std::optional<std::tuple<Fields...>> fields(getStruct<E, Fields...>(m_readOffset));
+
+	if(fields.has_value()) {
+		m_readOffset += (sizeof(Fields) + ... + 0);
+	}
+
+	return fields;
+}
+
+#endif // _BYTE_BUFFER_VIEW_H_
@@ -1,6 +1,7 @@
 #include "Colour.h"
 
 #include "ByteBuffer.h"
+#include "ByteBufferView.h"
 #include "Math/ExtendedMath.h"
 
 #include <fmt/core.h>
@@ -259,18 +260,18 @@ Colour Colour::lerp(const Colour & c, const Colour & d, float amount) {
 				  static_cast<uint8_t>(lerpedAlpha));
 }
 
-Colour Colour::getFrom(const ByteBuffer & byteBuffer, size_t offset, bool * error) {
+Colour Colour::getFrom(const ByteBufferView & byteBuffer, size_t offset, bool * error) {
 	return getFrom(byteBuffer, offset, true, DEFAULT_BYTE_ORDER, error);
 }
 
-Colour Colour::getFrom(const ByteBuffer & byteBuffer, size_t offset, bool alpha, bool * error) {
+Colour Colour::getFrom(const ByteBufferView & byteBuffer, size_t offset, bool alpha, bool * error) {
 	return getFrom(byteBuffer, offset, alpha, DEFAULT_BYTE_ORDER, error);
 }
 
-Colour Colour::getFrom(const ByteBuffer & byteBuffer, size_t offset, bool alpha, ByteOrder byteOrder, bool * error) {
+Colour Colour::getFrom(const ByteBufferView & byteBuffer, size_t offset, bool alpha, ByteOrder byteOrder, bool * error) {
 	uint8_t numberOfBytes = alpha ? 4 : 3;
 
-	if(offset + numberOfBytes > byteBuffer.getSize()) {
+	if(offset > byteBuffer.getSize() || byteBuffer.getSize() - offset < numberOfBytes) {
 		if(error != nullptr) {
 			*error = true;
 		}
@@ -285,10 +286,10 @@ Colour Colour::getFrom(const ByteBuffer & byteBuffer, size_t offset, bool alpha,
 	return Colour(colourData, byteOrder);
 }
 
-std::optional<Colour> Colour::getFrom(const ByteBuffer & byteBuffer, size_t offset, bool alpha, ByteOrder byteOrder) {
+std::optional<Colour> Colour::getFrom(const ByteBufferView & byteBuffer, size_t offset, bool alpha, ByteOrder byteOrder) {
 	bool error = false;
 
-	Colour value(getFrom(byteBuffer, offset, &error));
+	Colour value(getFrom(byteBuffer, offset, alpha, byteOrder, &error));
 
 	if(error) {
 		return {};
@@ -308,7 +309,7 @@ Colour Colour::readFrom(const ByteBuffer & byteBuffer, bool alpha, bool * error)
 Colour Colour::readFrom(const ByteBuffer & byteBuffer, bool alpha, ByteOrder byteOrder, bool * error) {
 	bool internalError = false;
 
-	Colour colour(getFrom(byteBuffer, byteBuffer.getReadOffset(), alpha, byteOrder, error));
+	Colour colour(getFrom(byteBuffer, byteBuffer.getReadOffset(), alpha, byteOrder, &internalError));
 
 	if(internalError) {
 		if(error != nullptr) {
@@ -325,7 +326,44 @@ Colour Colour::readFrom(const ByteBuffer & byteBuffer, bool alpha, ByteOrder byt
 std::optional<Colour> Colour::readFrom(const ByteBuffer & byteBuffer, bool alpha, ByteOrder byteOrder) {
 	bool error = false;
 
-	Colour value(readFrom(byteBuffer, &error));
+	Colour value(readFrom(byteBuffer, alpha, byteOrder, &error));
+
+	if(error) {
+		return {};
+	}
+
+	return value;
+}
+
+Colour Colour::readFrom(const ByteBufferView & byteBuffer, bool * error) {
+	return readFrom(byteBuffer, true, DEFAULT_BYTE_ORDER, error);
+}
+
+Colour Colour::readFrom(const ByteBufferView & byteBuffer, bool alpha, bool * error) {
+	return readFrom(byteBuffer, alpha, DEFAULT_BYTE_ORDER, error);
+}
+
+Colour Colour::readFrom(const ByteBufferView & byteBuffer, bool alpha, ByteOrder byteOrder, bool * error) {
+	bool internalError = false;
+
+	Colour colour(getFrom(byteBuffer, byteBuffer.getReadOffset(), alpha, byteOrder, &internalError));
+
+	if(internalError) {
+		if(error != nullptr) {
+			*error = true;
+		}
+	}
+	else {
+		byteBuffer.skipReadBytes(alpha ? 4 : 3);
+	}
+
+	return colour;
+}
+
+std::optional<Colour> Colour::readFrom(const ByteBufferView & byteBuffer, bool alpha, ByteOrder byteOrder) {
+	bool error = false;
+
+	Colour value(readFrom(byteBuffer, alpha, byteOrder, &error));
 
 	if(error) {
 		return {};
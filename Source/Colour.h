@@ -2,6 +2,7 @@
 #define _COLOUR_H_
 
 class ByteBuffer;
+class ByteBufferView;
 
 #include <cstdint>
 #include <limits>
@@ -46,14 +47,18 @@ public:
 
 	static Colour lerp  (const Colour & c, const Colour & d, float amount);
 
-	static Colour getFrom(const ByteBuffer & byteBuffer, size_t offset, bool * error);
-	static Colour getFrom(const ByteBuffer & byteBuffer, size_t offset, bool alpha, bool * error);
-	static Colour getFrom(const ByteBuffer & byteBuffer, size_t offset, bool alpha, ByteOrder byteOrder, bool * error);
-	static std::optional<Colour> getFrom(const ByteBuffer & byteBuffer, size_t offset, bool alpha = true, ByteOrder byteOrder = DEFAULT_BYTE_ORDER);
+	static Colour getFrom(const ByteBufferView & byteBuffer, size_t offset, bool * error);
+	static Colour getFrom(const ByteBufferView & byteBuffer, size_t offset, bool alpha, bool * error);
+	static Colour getFrom(const ByteBufferView & byteBuffer, size_t offset, bool alpha, ByteOrder byteOrder, bool * error);
+	static std::optional<Colour> getFrom(const ByteBufferView & byteBuffer, size_t offset, bool alpha = true, ByteOrder byteOrder = DEFAULT_BYTE_ORDER);
 	static Colour readFrom(const ByteBuffer & byteBuffer, bool * error);
 	static Colour readFrom(const ByteBuffer & byteBuffer, bool alpha, bool * error);
 	static Colour readFrom(const ByteBuffer & byteBuffer, bool alpha, ByteOrder byteOrder, bool * error);
 	static std::optional<Colour> readFrom(const ByteBuffer & byteBuffer, bool alpha = true, ByteOrder byteOrder = DEFAULT_BYTE_ORDER);
+	static Colour readFrom(const ByteBufferView & byteBuffer, bool * error);
+	static Colour readFrom(const ByteBufferView & byteBuffer, bool alpha, bool * error);
+	static Colour readFrom(const ByteBufferView & byteBuffer, bool alpha, ByteOrder byteOrder, bool * error);
+	static std::optional<Colour> readFrom(const ByteBufferView & byteBuffer, bool alpha = true, ByteOrder byteOrder = DEFAULT_BYTE_ORDER);
 	bool putIn(ByteBuffer & byteBuffer, size_t offset, bool alpha = true, ByteOrder byteOrder = DEFAULT_BYTE_ORDER) const;
 	bool insertIn(ByteBuffer & byteBuffer, size_t offset, bool alpha = true, ByteOrder byteOrder = DEFAULT_BYTE_ORDER) const;
 	bool writeTo(ByteBuffer & byteBuffer, bool alpha = true, ByteOrder byteOrder = DEFAULT_BYTE_ORDER) const;
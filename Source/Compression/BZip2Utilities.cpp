@@ -64,14 +64,13 @@ namespace BZip2 {
 		return true;
 	}
 
-	StreamHandle createCompressionStreamHandle() {
+	StreamHandle createCompressionStreamHandle(int blockSize, int workFactor) {
 		bz_stream * streamHandle = new bz_stream();
 		streamHandle->bzalloc = nullptr;
 		streamHandle->bzfree = nullptr;
 		streamHandle->opaque = nullptr;
 
-		// TODO: Allow BZip2 compression initialization parameters to be configurable
-		if(!isSuccess(BZ2_bzCompressInit(streamHandle, 9, 0, 30), "Failed to initialize BZip2 compression stream handle")) {
+		if(!isSuccess(BZ2_bzCompressInit(streamHandle, blockSize, 0, workFactor), "Failed to initialize BZip2 compression stream handle")) {
 			delete streamHandle;
 			return nullptr;
 		}
@@ -11,9 +11,14 @@ namespace BZip2 {
 
 	using StreamHandle = std::unique_ptr<bz_stream, std::function<void (bz_stream *)>>;
 
+	constexpr int MINIMUM_BLOCK_SIZE = 1;
+	constexpr int MAXIMUM_BLOCK_SIZE = 9;
+	constexpr int DEFAULT_BLOCK_SIZE = MAXIMUM_BLOCK_SIZE;
+	constexpr int DEFAULT_WORK_FACTOR = 30;
+
 	std::string resultToString(int result);
 	bool isSuccess(int result, const std::string & errorMessage = {});
-	StreamHandle createCompressionStreamHandle();
+	StreamHandle createCompressionStreamHandle(int blockSize = DEFAULT_BLOCK_SIZE, int workFactor = DEFAULT_WORK_FACTOR);
 	StreamHandle createDecompressionStreamHandle();
 
 }
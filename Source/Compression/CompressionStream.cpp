@@ -0,0 +1,806 @@
+#include "CompressionStream.h"
+
+#include "Utilities/FileUtilities.h"
+
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <thread>
+
+const size_t CompressionStream::DEFAULT_CHUNK_SIZE = 128 * 1024;
+const size_t CompressionStream::MINIMUM_CHUNK_SIZE = 4096;
+
+CompressionStream::CompressionStream(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize)
+	: m_compressionMethod(compressionMethod)
+	, m_mode(mode)
+	, m_options(options)
+	, m_outputCallback(std::move(outputCallback))
+	, m_outputBuffer(std::clamp(chunkSize, MINIMUM_CHUNK_SIZE, static_cast<size_t>(std::numeric_limits<uint32_t>::max())))
+	, m_outputBufferOffset(0)
+	, m_totalInputSize(0)
+	, m_totalOutputSize(0)
+	, m_streamEnded(false)
+	, m_finished(false) { }
+
+CompressionStream::~CompressionStream() { }
+
+ByteBuffer::CompressionMethod CompressionStream::getCompressionMethod() const {
+	return m_compressionMethod;
+}
+
+CompressionStream::Mode CompressionStream::getMode() const {
+	return m_mode;
+}
+
+const ByteBuffer::CompressionOptions & CompressionStream::getOptions() const {
+	return m_options;
+}
+
+size_t CompressionStream::getChunkSize() const {
+	return m_outputBuffer.size();
+}
+
+uint64_t CompressionStream::getTotalInputSize() const {
+	return m_totalInputSize;
+}
+
+uint64_t CompressionStream::getTotalOutputSize() const {
+	return m_totalOutputSize + m_outputBufferOffset;
+}
+
+bool CompressionStream::isFinished() const {
+	return m_finished;
+}
+
+bool CompressionStream::setPledgedInputSize(uint64_t size) {
+	if(m_totalInputSize != 0 || m_finished) {
+		spdlog::error("Cannot set pledged {} input size after data has already been written.", magic_enum::enum_name(m_compressionMethod));
+		return false;
+	}
+
+	if(m_mode == Mode::Compress && m_compressionMethod == ByteBuffer::CompressionMethod::ZStandard) {
+		// allows the frame header to record the content size, which is required to decompress it in a single pass
+		return ZStandard::isSuccess(ZSTD_CCtx_setPledgedSrcSize(m_zStandardCompressionContext.get(), size), "Failed to set pledged Zstandard input size");
+	}
+
+	return true;
+}
+
+bool CompressionStream::write(const uint8_t * data, size_t size) {
+	if(m_finished) {
+		spdlog::error("Cannot write to {} {} stream after it has been finished.", magic_enum::enum_name(m_compressionMethod), m_mode == Mode::Compress ? "compression" : "decompression");
+		return false;
+	}
+
+	if(size == 0) {
+		return true;
+	}
+
+	if(data == nullptr) {
+		return false;
+	}
+
+	m_totalInputSize += size;
+
+	// trailing data after the end of a compressed stream is ignored, matching ByteBuffer::decompressed
+	if(m_mode == Mode::Decompress && m_streamEnded && m_compressionMethod != ByteBuffer::CompressionMethod::ZStandard) {
+		return true;
+	}
+
+	return process(data, size, false);
+}
+
+bool CompressionStream::write(const ByteBuffer & data) {
+	return write(data.getRawData(), data.getSize());
+}
+
+bool CompressionStream::flush() {
+	return emitOutput();
+}
+
+bool CompressionStream::finish() {
+	if(m_finished) {
+		return true;
+	}
+
+	if(!m_streamEnded || m_mode == Mode::Compress) {
+		if(!process(nullptr, 0, true)) {
+			return false;
+		}
+	}
+
+	if(!emitOutput()) {
+		return false;
+	}
+
+	if(!m_streamEnded) {
+		spdlog::error("{} data is truncated, reached end of input before end of compressed stream.", magic_enum::enum_name(m_compressionMethod));
+		return false;
+	}
+
+	m_finished = true;
+
+	return true;
+}
+
+bool CompressionStream::reset(OutputCallback outputCallback, size_t chunkSize) {
+	if(outputCallback == nullptr) {
+		spdlog::error("Missing {} stream output callback.", magic_enum::enum_name(m_compressionMethod));
+		return false;
+	}
+
+	m_outputCallback = std::move(outputCallback);
+	m_outputBuffer.resize(std::clamp(chunkSize, MINIMUM_CHUNK_SIZE, static_cast<size_t>(std::numeric_limits<uint32_t>::max())));
+	m_outputBufferOffset = 0;
+	m_totalInputSize = 0;
+	m_totalOutputSize = 0;
+	m_streamEnded = false;
+	m_finished = false;
+
+	// codec state is reset in place where possible so that its internal buffers are reused rather than reallocated
+	switch(m_compressionMethod) {
+		case ByteBuffer::CompressionMethod::BZip2: {
+			// BZip2 has no reset function, so the stream must be recreated
+			return initializeBZip2();
+		}
+		case ByteBuffer::CompressionMethod::LZMA:
+		case ByteBuffer::CompressionMethod::XZ: {
+			// re-initializing an existing stream with the same coder type reuses its allocated state
+			return initializeLZMA();
+		}
+		case ByteBuffer::CompressionMethod::ZLib: {
+			if(m_mode == Mode::Decompress) {
+				return ZLib::isSuccess(inflateReset(m_zLibStream.get()), "Failed to reset ZLib inflation stream");
+			}
+
+			if(!ZLib::isSuccess(deflateReset(m_zLibStream.get()), "Failed to reset ZLib deflation stream")) {
+				return false;
+			}
+
+			if(m_options.dictionary != nullptr) {
+				return ZLib::isSuccess(deflateSetDictionary(m_zLibStream.get(), m_options.dictionary->getRawData(), static_cast<uInt>(m_options.dictionary->getSize())), "Failed to set ZLib compression dictionary");
+			}
+
+			return true;
+		}
+		case ByteBuffer::CompressionMethod::ZStandard: {
+			// resetting only the session keeps the compression parameters and loaded dictionary
+			if(m_mode == Mode::Decompress) {
+				return ZStandard::isSuccess(ZSTD_DCtx_reset(m_zStandardDecompressionContext.get(), ZSTD_reset_session_only), "Failed to reset Zstandard decompression context");
+			}
+
+			return ZStandard::isSuccess(ZSTD_CCtx_reset(m_zStandardCompressionContext.get(), ZSTD_reset_session_only), "Failed to reset Zstandard compression context");
+		}
+	}
+
+	return false;
+}
+
+bool CompressionStream::initialize() {
+	if(m_outputCallback == nullptr) {
+		spdlog::error("Missing {} stream output callback.", magic_enum::enum_name(m_compressionMethod));
+		return false;
+	}
+
+	if(m_options.dictionary != nullptr && m_compressionMethod != ByteBuffer::CompressionMethod::ZLib && m_compressionMethod != ByteBuffer::CompressionMethod::ZStandard) {
+		spdlog::error("{} compression does not support preset dictionaries.", magic_enum::enum_name(m_compressionMethod));
+		return false;
+	}
+
+	switch(m_compressionMethod) {
+		case ByteBuffer::CompressionMethod::BZip2: {
+			return initializeBZip2();
+		}
+		case ByteBuffer::CompressionMethod::LZMA:
+		case ByteBuffer::CompressionMethod::XZ: {
+			return initializeLZMA();
+		}
+		case ByteBuffer::CompressionMethod::ZLib: {
+			return initializeZLib();
+		}
+		case ByteBuffer::CompressionMethod::ZStandard: {
+			return initializeZStandard();
+		}
+	}
+
+	return false;
+}
+
+bool CompressionStream::initializeBZip2() {
+	if(m_mode == Mode::Decompress) {
+		m_bZip2Stream = BZip2::createDecompressionStreamHandle();
+
+		return m_bZip2Stream != nullptr;
+	}
+
+	int blockSize = BZip2::DEFAULT_BLOCK_SIZE;
+
+	if(m_options.level.has_value()) {
+		if(m_options.level.value() < BZip2::MINIMUM_BLOCK_SIZE || m_options.level.value() > BZip2::MAXIMUM_BLOCK_SIZE) {
+			spdlog::error("Invalid BZip2 compression level {}, expected a value between {} and {}.", m_options.level.value(), BZip2::MINIMUM_BLOCK_SIZE, BZip2::MAXIMUM_BLOCK_SIZE);
+			return false;
+		}
+
+		blockSize = m_options.level.value();
+	}
+
+	m_bZip2Stream = BZip2::createCompressionStreamHandle(blockSize);
+
+	return m_bZip2Stream != nullptr;
+}
+
+bool CompressionStream::initializeLZMA() {
+	static constexpr uint32_t DEFAULT_XZ_COMPRESSION_PRESET = 4;
+	static constexpr uint32_t MAXIMUM_COMPRESSION_PRESET = 9;
+	static constexpr uint8_t MINIMUM_WINDOW_SIZE_LOG = 12;
+	static constexpr uint8_t MAXIMUM_WINDOW_SIZE_LOG = 30;
+
+	if(m_lzmaStream == nullptr) {
+		m_lzmaStream = LZMA::createStreamHandle();
+
+		if(m_lzmaStream == nullptr) {
+			spdlog::error("Failed to initialize {} stream handle.", magic_enum::enum_name(m_compressionMethod));
+			return false;
+		}
+	}
+
+	if(m_mode == Mode::Decompress) {
+		return LZMA::isSuccess(lzma_auto_decoder(m_lzmaStream.get(), std::numeric_limits<uint64_t>::max(), 0), "Failed to initialize LZMA decoder");
+	}
+
+	uint32_t preset = m_compressionMethod == ByteBuffer::CompressionMethod::XZ ? DEFAULT_XZ_COMPRESSION_PRESET : LZMA_PRESET_DEFAULT;
+
+	if(m_options.level.has_value()) {
+		if(m_options.level.value() < 0 || m_options.level.value() > static_cast<int32_t>(MAXIMUM_COMPRESSION_PRESET)) {
+			spdlog::error("Invalid {} compression level {}, expected a value between 0 and {}.", magic_enum::enum_name(m_compressionMethod), m_options.level.value(), MAXIMUM_COMPRESSION_PRESET);
+			return false;
+		}
+
+		preset = static_cast<uint32_t>(m_options.level.value());
+	}
+
+	if(m_options.extreme) {
+		preset |= LZMA_PRESET_EXTREME;
+	}
+
+	lzma_options_lzma lzmaOptions;
+
+	if(lzma_lzma_preset(&lzmaOptions, preset)) {
+		spdlog::error("Failed to initialize {} encoder options with preset {}.", magic_enum::enum_name(m_compressionMethod), preset);
+		return false;
+	}
+
+	if(m_options.windowSizeLog.has_value()) {
+		if(m_options.windowSizeLog.value() < MINIMUM_WINDOW_SIZE_LOG || m_options.windowSizeLog.value() > MAXIMUM_WINDOW_SIZE_LOG) {
+			spdlog::error("Invalid {} window size log {}, expected a value between {} and {}.", magic_enum::enum_name(m_compressionMethod), m_options.windowSizeLog.value(), MINIMUM_WINDOW_SIZE_LOG, MAXIMUM_WINDOW_SIZE_LOG);
+			return false;
+		}
+
+		lzmaOptions.dict_size = 1U << m_options.windowSizeLog.value();
+	}
+
+	uint32_t numberOfThreads = getNumberOfCompressionThreads(m_options);
+
+	if(m_compressionMethod == ByteBuffer::CompressionMethod::LZMA) {
+		if(numberOfThreads > 1) {
+			spdlog::warn("LZMA compression does not support multiple threads, compressing with a single thread instead.");
+		}
+
+		return LZMA::isSuccess(lzma_alone_encoder(m_lzmaStream.get(), &lzmaOptions), "Failed to initialize LZMA encoder");
+	}
+
+	lzma_filter filters[] = {
+		{ LZMA_FILTER_LZMA2, &lzmaOptions },
+		{ LZMA_VLI_UNKNOWN, nullptr }
+	};
+
+	if(numberOfThreads > 1) {
+		lzma_mt multithreadedOptions = {};
+		multithreadedOptions.threads = numberOfThreads;
+		multithreadedOptions.filters = filters;
+		multithreadedOptions.check = LZMA_CHECK_CRC64;
+
+		return LZMA::isSuccess(lzma_stream_encoder_mt(m_lzmaStream.get(), &multithreadedOptions), "Failed to initialize multithreaded XZ encoder");
+	}
+
+	return LZMA::isSuccess(lzma_stream_encoder(m_lzmaStream.get(), filters, LZMA_CHECK_CRC64), "Failed to initialize XZ encoder");
+}
+
+bool CompressionStream::initializeZLib() {
+	static constexpr int MINIMUM_WINDOW_BITS = 9;
+
+	if(m_mode == Mode::Decompress) {
+		m_zLibStream = ZLib::createInflationStreamHandle();
+
+		return m_zLibStream != nullptr;
+	}
+
+	int level = Z_DEFAULT_COMPRESSION;
+	int windowBits = MAX_WBITS;
+
+	if(m_options.level.has_value()) {
+		if(m_options.level.value() < Z_DEFAULT_COMPRESSION || m_options.level.value() > Z_BEST_COMPRESSION) {
+			spdlog::error("Invalid ZLib compression level {}, expected a value between {} and {}.", m_options.level.value(), Z_DEFAULT_COMPRESSION, Z_BEST_COMPRESSION);
+			return false;
+		}
+
+		level = m_options.level.value();
+	}
+
+	if(m_options.windowSizeLog.has_value()) {
+		if(m_options.windowSizeLog.value() < MINIMUM_WINDOW_BITS || m_options.windowSizeLog.value() > MAX_WBITS) {
+			spdlog::error("Invalid ZLib window size log {}, expected a value between {} and {}.", m_options.windowSizeLog.value(), MINIMUM_WINDOW_BITS, MAX_WBITS);
+			return false;
+		}
+
+		windowBits = m_options.windowSizeLog.value();
+	}
+
+	m_zLibStream = ZLib::createDeflationStreamHandle(level, windowBits);
+
+	if(m_zLibStream == nullptr) {
+		return false;
+	}
+
+	if(m_options.dictionary != nullptr) {
+		return ZLib::isSuccess(deflateSetDictionary(m_zLibStream.get(), m_options.dictionary->getRawData(), static_cast<uInt>(m_options.dictionary->getSize())), "Failed to set ZLib compression dictionary");
+	}
+
+	return true;
+}
+
+bool CompressionStream::initializeZStandard() {
+	if(m_mode == Mode::Decompress) {
+		m_zStandardDecompressionContext = ZStandard::createDecompressionContextHandle();
+
+		if(m_zStandardDecompressionContext == nullptr) {
+			return false;
+		}
+
+		if(m_options.windowSizeLog.has_value() && !ZStandard::isSuccess(ZSTD_DCtx_setParameter(m_zStandardDecompressionContext.get(), ZSTD_d_windowLogMax, m_options.windowSizeLog.value()), "Failed to set maximum Zstandard decompression window size")) {
+			return false;
+		}
+
+		if(m_options.dictionary != nullptr) {
+			return ZStandard::isSuccess(ZSTD_DCtx_loadDictionary(m_zStandardDecompressionContext.get(), m_options.dictionary->getRawData(), m_options.dictionary->getSize()), "Failed to load Zstandard decompression dictionary");
+		}
+
+		return true;
+	}
+
+	m_zStandardCompressionContext = ZStandard::createCompressionContextHandle();
+
+	if(m_zStandardCompressionContext == nullptr) {
+		return false;
+	}
+
+	int level = ZSTD_CLEVEL_DEFAULT;
+
+	if(m_options.level.has_value()) {
+		if(m_options.level.value() < ZSTD_minCLevel() || m_options.level.value() > ZSTD_maxCLevel()) {
+			spdlog::error("Invalid Zstandard compression level {}, expected a value between {} and {}.", m_options.level.value(), ZSTD_minCLevel(), ZSTD_maxCLevel());
+			return false;
+		}
+
+		level = m_options.level.value();
+	}
+
+	if(!ZStandard::isSuccess(ZSTD_CCtx_setParameter(m_zStandardCompressionContext.get(), ZSTD_c_compressionLevel, level), "Failed to set Zstandard compression level")) {
+		return false;
+	}
+
+	if(m_options.windowSizeLog.has_value() && !ZStandard::isSuccess(ZSTD_CCtx_setParameter(m_zStandardCompressionContext.get(), ZSTD_c_windowLog, m_options.windowSizeLog.value()), "Failed to set Zstandard compression window size")) {
+		return false;
+	}
+
+	uint32_t numberOfThreads = getNumberOfCompressionThreads(m_options);
+
+	if(numberOfThreads > 1 && ZSTD_isError(ZSTD_CCtx_setParameter(m_zStandardCompressionContext.get(), ZSTD_c_nbWorkers, static_cast<int>(numberOfThreads)))) {
+		spdlog::warn("Zstandard library does not support multithreaded compression, compressing with a single thread instead.");
+	}
+
+	if(m_options.dictionary != nullptr) {
+		return ZStandard::isSuccess(ZSTD_CCtx_loadDictionary(m_zStandardCompressionContext.get(), m_options.dictionary->getRawData(), m_options.dictionary->getSize()), "Failed to load Zstandard compression dictionary");
+	}
+
+	return true;
+}
+
+bool CompressionStream::process(const uint8_t * data, size_t size, bool finish) {
+	switch(m_compressionMethod) {
+		case ByteBuffer::CompressionMethod::BZip2: {
+			return processBZip2(data, size, finish);
+		}
+		case ByteBuffer::CompressionMethod::LZMA:
+		case ByteBuffer::CompressionMethod::XZ: {
+			return processLZMA(data, size, finish);
+		}
+		case ByteBuffer::CompressionMethod::ZLib: {
+			return processZLib(data, size, finish);
+		}
+		case ByteBuffer::CompressionMethod::ZStandard: {
+			return processZStandard(data, size, finish);
+		}
+	}
+
+	return false;
+}
+
+bool CompressionStream::processBZip2(const uint8_t * data, size_t size, bool finish) {
+	bz_stream * bZip2Stream = m_bZip2Stream.get();
+	size_t inputOffset = 0;
+
+	do {
+		size_t inputSliceSize = std::min(size - inputOffset, static_cast<size_t>(std::numeric_limits<unsigned int>::max()));
+		bool finishSlice = finish && inputOffset + inputSliceSize == size;
+
+		bZip2Stream->next_in = reinterpret_cast<char *>(const_cast<uint8_t *>(data)) + inputOffset;
+		bZip2Stream->avail_in = static_cast<unsigned int>(inputSliceSize);
+
+		while(true) {
+			bZip2Stream->next_out = reinterpret_cast<char *>(m_outputBuffer.data() + m_outputBufferOffset);
+			bZip2Stream->avail_out = static_cast<unsigned int>(m_outputBuffer.size() - m_outputBufferOffset);
+
+			int result = m_mode == Mode::Compress ? BZ2_bzCompress(bZip2Stream, finishSlice ? BZ_FINISH : BZ_RUN) : BZ2_bzDecompress(bZip2Stream);
+
+			m_outputBufferOffset = m_outputBuffer.size() - bZip2Stream->avail_out;
+
+			// BZip2 reports a parameter error when running the compressor without any input left to consume
+			if(result == BZ_PARAM_ERROR && m_mode == Mode::Compress && !finishSlice && bZip2Stream->avail_in == 0) {
+				break;
+			}
+
+			if(!BZip2::isSuccess(result, m_mode == Mode::Compress ? "Failed to compress BZip2 data" : "Failed to decompress BZip2 data")) {
+				return false;
+			}
+
+			bool outputFull = bZip2Stream->avail_out == 0;
+
+			if(outputFull && !emitOutput()) {
+				return false;
+			}
+
+			if(result == BZ_STREAM_END) {
+				m_streamEnded = true;
+				return true;
+			}
+
+			if(bZip2Stream->avail_in == 0 && !outputFull && !(finishSlice && m_mode == Mode::Compress)) {
+				break;
+			}
+		}
+
+		inputOffset += inputSliceSize;
+	} while(inputOffset < size);
+
+	return true;
+}
+
+bool CompressionStream::processLZMA(const uint8_t * data, size_t size, bool finish) {
+	lzma_stream * lzmaStream = m_lzmaStream.get();
+
+	lzmaStream->next_in = data;
+	lzmaStream->avail_in = size;
+
+	while(true) {
+		lzmaStream->next_out = m_outputBuffer.data() + m_outputBufferOffset;
+		lzmaStream->avail_out = m_outputBuffer.size() - m_outputBufferOffset;
+
+		lzma_ret lzmaStatus = lzma_code(lzmaStream, finish ? LZMA_FINISH : LZMA_RUN);
+
+		m_outputBufferOffset = m_outputBuffer.size() - lzmaStream->avail_out;
+
+		if(lzmaStatus == LZMA_BUF_ERROR && lzmaStream->avail_in == 0) {
+			break;
+		}
+
+		if(lzmaStatus != LZMA_STREAM_END && !LZMA::isSuccess(lzmaStatus, m_mode == Mode::Compress ? "Failed to compress LZMA data" : "Failed to decompress LZMA data")) {
+			return false;
+		}
+
+		bool outputFull = lzmaStream->avail_out == 0;
+
+		if(outputFull && !emitOutput()) {
+			return false;
+		}
+
+		if(lzmaStatus == LZMA_STREAM_END) {
+			m_streamEnded = true;
+			break;
+		}
+
+		if(lzmaStream->avail_in == 0 && !outputFull && !(finish && m_mode == Mode::Compress)) {
+			break;
+		}
+	}
+
+	return true;
+}
+
+bool CompressionStream::processZLib(const uint8_t * data, size_t size, bool finish) {
+	z_stream * zLibStream = m_zLibStream.get();
+	size_t inputOffset = 0;
+
+	do {
+		size_t inputSliceSize = std::min(size - inputOffset, static_cast<size_t>(std::numeric_limits<uInt>::max()));
+		bool finishSlice = finish && inputOffset + inputSliceSize == size;
+
+		zLibStream->next_in = reinterpret_cast<Bytef *>(const_cast<uint8_t *>(data)) + inputOffset;
+		zLibStream->avail_in = static_cast<uInt>(inputSliceSize);
+
+		while(true) {
+			zLibStream->next_out = reinterpret_cast<Bytef *>(m_outputBuffer.data() + m_outputBufferOffset);
+			zLibStream->avail_out = static_cast<uInt>(m_outputBuffer.size() - m_outputBufferOffset);
+
+			int zLibResult = m_mode == Mode::Compress ? deflate(zLibStream, finishSlice ? Z_FINISH : Z_NO_FLUSH) : inflate(zLibStream, Z_NO_FLUSH);
+
+			m_outputBufferOffset = m_outputBuffer.size() - zLibStream->avail_out;
+
+			if(zLibResult == Z_NEED_DICT) {
+				if(m_options.dictionary == nullptr) {
+					spdlog::error("Failed to decompress ZLib data: a preset dictionary is required.");
+					return false;
+				}
+
+				if(!ZLib::isSuccess(inflateSetDictionary(zLibStream, m_options.dictionary->getRawData(), static_cast<uInt>(m_options.dictionary->getSize())), "Failed to set ZLib decompression dictionary")) {
+					return false;
+				}
+
+				continue;
+			}
+
+			// a buffer error only indicates that no progress can be made until more input is provided
+			if(zLibResult == Z_BUF_ERROR && zLibStream->avail_in == 0) {
+				break;
+			}
+
+			if(!ZLib::isSuccess(zLibResult, m_mode == Mode::Compress ? "Failed to compress ZLib data" : "Failed to decompress ZLib data")) {
+				return false;
+			}
+
+			bool outputFull = zLibStream->avail_out == 0;
+
+			if(outputFull && !emitOutput()) {
+				return false;
+			}
+
+			if(zLibResult == Z_STREAM_END) {
+				m_streamEnded = true;
+				return true;
+			}
+
+			if(zLibStream->avail_in == 0 && !outputFull && !(finishSlice && m_mode == Mode::Compress)) {
+				break;
+			}
+		}
+
+		inputOffset += inputSliceSize;
+	} while(inputOffset < size);
+
+	return true;
+}
+
+bool CompressionStream::processZStandard(const uint8_t * data, size_t size, bool finish) {
+	ZSTD_inBuffer inputBuffer = { data, size, 0 };
+
+	if(m_mode == Mode::Decompress && inputBuffer.size == 0) {
+		// the decoder flushes everything it can whenever the output buffer is not filled, so there is nothing left to drain
+		return true;
+	}
+
+	while(true) {
+		ZSTD_outBuffer outputBuffer = { m_outputBuffer.data(), m_outputBuffer.size(), m_outputBufferOffset };
+		size_t result = 0;
+
+		if(m_mode == Mode::Compress) {
+			result = ZSTD_compressStream2(m_zStandardCompressionContext.get(), &outputBuffer, &inputBuffer, finish ? ZSTD_e_end : ZSTD_e_continue);
+		}
+		else {
+			result = ZSTD_decompressStream(m_zStandardDecompressionContext.get(), &outputBuffer, &inputBuffer);
+		}
+
+		m_outputBufferOffset = outputBuffer.pos;
+
+		if(!ZStandard::isSuccess(result, m_mode == Mode::Compress ? "Failed to compress Zstandard data" : "Failed to decompress Zstandard data")) {
+			return false;
+		}
+
+		bool outputFull = outputBuffer.pos == outputBuffer.size;
+
+		if(outputFull && !emitOutput()) {
+			return false;
+		}
+
+		if(m_mode == Mode::Compress) {
+			if(finish) {
+				if(result == 0) {
+					m_streamEnded = true;
+					break;
+				}
+			}
+			else if(inputBuffer.pos == inputBuffer.size && !outputFull) {
+				break;
+			}
+		}
+		else {
+			// a result of zero marks the end of a frame, although further concatenated frames may follow
+			m_streamEnded = result == 0;
+
+			if(inputBuffer.pos == inputBuffer.size && (m_streamEnded || !outputFull)) {
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool CompressionStream::emitOutput() {
+	if(m_outputBufferOffset == 0) {
+		return true;
+	}
+
+	if(!m_outputCallback(m_outputBuffer.data(), m_outputBufferOffset)) {
+		spdlog::error("Failed to write {} bytes of {} {} stream output.", m_outputBufferOffset, magic_enum::enum_name(m_compressionMethod), m_mode == Mode::Compress ? "compressed" : "decompressed");
+		return false;
+	}
+
+	m_totalOutputSize += m_outputBufferOffset;
+	m_outputBufferOffset = 0;
+
+	return true;
+}
+
+std::unique_ptr<CompressionStream> CompressionStream::createCompressionStream(ByteBuffer::CompressionMethod compressionMethod, OutputCallback outputCallback, size_t chunkSize) {
+	return createStream(compressionMethod, Mode::Compress, ByteBuffer::CompressionOptions(), std::move(outputCallback), chunkSize);
+}
+
+std::unique_ptr<CompressionStream> CompressionStream::createCompressionStream(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize) {
+	return createStream(compressionMethod, Mode::Compress, options, std::move(outputCallback), chunkSize);
+}
+
+std::unique_ptr<CompressionStream> CompressionStream::createDecompressionStream(ByteBuffer::CompressionMethod compressionMethod, OutputCallback outputCallback, size_t chunkSize) {
+	return createStream(compressionMethod, Mode::Decompress, ByteBuffer::CompressionOptions(), std::move(outputCallback), chunkSize);
+}
+
+std::unique_ptr<CompressionStream> CompressionStream::createDecompressionStream(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize) {
+	return createStream(compressionMethod, Mode::Decompress, options, std::move(outputCallback), chunkSize);
+}
+
+std::unique_ptr<CompressionStream> CompressionStream::createStream(ByteBuffer::CompressionMethod compressionMethod, Mode mode, OutputCallback outputCallback, size_t chunkSize) {
+	return createStream(compressionMethod, mode, ByteBuffer::CompressionOptions(), std::move(outputCallback), chunkSize);
+}
+
+std::unique_ptr<CompressionStream> CompressionStream::createStream(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize) {
+	std::unique_ptr<CompressionStream> compressionStream(new CompressionStream(compressionMethod, mode, options, std::move(outputCallback), chunkSize));
+
+	if(!compressionStream->initialize()) {
+		return nullptr;
+	}
+
+	return compressionStream;
+}
+
+bool CompressionStream::transform(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const InputCallback & inputCallback, OutputCallback outputCallback, size_t chunkSize) {
+	return transform(compressionMethod, mode, ByteBuffer::CompressionOptions(), inputCallback, std::move(outputCallback), chunkSize);
+}
+
+bool CompressionStream::transform(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, const InputCallback & inputCallback, OutputCallback outputCallback, size_t chunkSize) {
+	if(inputCallback == nullptr) {
+		return false;
+	}
+
+	std::unique_ptr<CompressionStream> compressionStream(createStream(compressionMethod, mode, options, std::move(outputCallback), chunkSize));
+	if(compressionStream == nullptr) {
+		return false;
+	}
+
+	std::vector<uint8_t> inputBuffer(compressionStream->getChunkSize());
+
+	while(true) {
+		std::optional<size_t> optionalNumberOfBytesRead(inputCallback(inputBuffer.data(), inputBuffer.size()));
+
+		if(!optionalNumberOfBytesRead.has_value()) {
+			spdlog::error("Failed to read {} stream input data.", magic_enum::enum_name(compressionMethod));
+			return false;
+		}
+
+		if(optionalNumberOfBytesRead.value() == 0) {
+			break;
+		}
+
+		if(!compressionStream->write(inputBuffer.data(), std::min(optionalNumberOfBytesRead.value(), inputBuffer.size()))) {
+			return false;
+		}
+	}
+
+	return compressionStream->finish();
+}
+
+bool CompressionStream::compressFile(ByteBuffer::CompressionMethod compressionMethod, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite, size_t chunkSize) {
+	return transformFile(compressionMethod, Mode::Compress, ByteBuffer::CompressionOptions(), inputFilePath, outputFilePath, overwrite, chunkSize);
+}
+
+bool CompressionStream::compressFile(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite, size_t chunkSize) {
+	return transformFile(compressionMethod, Mode::Compress, options, inputFilePath, outputFilePath, overwrite, chunkSize);
+}
+
+bool CompressionStream::decompressFile(ByteBuffer::CompressionMethod compressionMethod, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite, size_t chunkSize) {
+	return transformFile(compressionMethod, Mode::Decompress, ByteBuffer::CompressionOptions(), inputFilePath, outputFilePath, overwrite, chunkSize);
+}
+
+bool CompressionStream::decompressFile(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite, size_t chunkSize) {
+	return transformFile(compressionMethod, Mode::Decompress, options, inputFilePath, outputFilePath, overwrite, chunkSize);
+}
+
+bool CompressionStream::transformFile(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite, size_t chunkSize) {
+	return transformFile(compressionMethod, mode, ByteBuffer::CompressionOptions(), inputFilePath, outputFilePath, overwrite, chunkSize);
+}
+
+bool CompressionStream::transformFile(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite, size_t chunkSize) {
+	if(!std::filesystem::is_regular_file(std::filesystem::path(inputFilePath))) {
+		spdlog::error("Input file '{}' does not exist or is not a file.", inputFilePath);
+		return false;
+	}
+
+	if(!overwrite && std::filesystem::exists(std::filesystem::path(outputFilePath))) {
+		spdlog::error("Output file '{}' already exists, specify overwrite to replace it.", outputFilePath);
+		return false;
+	}
+
+	std::error_code errorCode;
+	Utilities::createDirectoryStructureForFilePath(outputFilePath, errorCode);
+
+	if(errorCode) {
+		spdlog::error("Failed to create file destination directory structure for file path '{}': {}", outputFilePath, errorCode.message());
+		return false;
+	}
+
+	std::ifstream inputFileStream(inputFilePath, std::ios::binary);
+
+	if(!inputFileStream.is_open()) {
+		spdlog::error("Failed to open input file '{}' for reading.", inputFilePath);
+		return false;
+	}
+
+	std::ofstream outputFileStream(outputFilePath, std::ios::binary);
+
+	if(!outputFileStream.is_open()) {
+		spdlog::error("Failed to open output file '{}' for writing.", outputFilePath);
+		return false;
+	}
+
+	bool success = transform(compressionMethod, mode, options, [&inputFileStream](uint8_t * data, size_t size) -> std::optional<size_t> {
+		inputFileStream.read(reinterpret_cast<char *>(data), size);
+
+		if(inputFileStream.bad()) {
+			return {};
+		}
+
+		return static_cast<size_t>(inputFileStream.gcount());
+	}, [&outputFileStream](const uint8_t * data, size_t size) {
+		outputFileStream.write(reinterpret_cast<const char *>(data), size);
+
+		return outputFileStream.good();
+	}, chunkSize);
+
+	outputFileStream.close();
+
+	if(!success) {
+		std::filesystem::remove(std::filesystem::path(outputFilePath), errorCode);
+	}
+
+	return success;
+}
+
+uint32_t CompressionStream::getNumberOfCompressionThreads(const ByteBuffer::CompressionOptions & options) {
+	if(options.numberOfThreads != 0) {
+		return options.numberOfThreads;
+	}
+
+	return std::max(std::thread::hardware_concurrency(), 1U);
+}
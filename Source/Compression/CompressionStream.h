@@ -0,0 +1,99 @@
+#ifndef _COMPRESSION_STREAM_H_
+#define _COMPRESSION_STREAM_H_
+
+#include "BZip2Utilities.h"
+#include "ByteBuffer.h"
+#include "LZMAUtilities.h"
+#include "ZLibUtilities.h"
+#include "ZStandardUtilities.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+class CompressionStream final {
+	friend class CompressionStreamPool;
+
+public:
+	enum class Mode {
+		Compress,
+		Decompress
+	};
+
+	using InputCallback = std::function<std::optional<size_t> (uint8_t * data, size_t size)>;
+	using OutputCallback = std::function<bool (const uint8_t * data, size_t size)>;
+
+	~CompressionStream();
+
+	ByteBuffer::CompressionMethod getCompressionMethod() const;
+	Mode getMode() const;
+	const ByteBuffer::CompressionOptions & getOptions() const;
+	size_t getChunkSize() const;
+	uint64_t getTotalInputSize() const;
+	uint64_t getTotalOutputSize() const;
+	bool isFinished() const;
+	bool setPledgedInputSize(uint64_t size);
+	bool write(const uint8_t * data, size_t size);
+	bool write(const ByteBuffer & data);
+	bool flush();
+	bool finish();
+	bool reset(OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+	static std::unique_ptr<CompressionStream> createCompressionStream(ByteBuffer::CompressionMethod compressionMethod, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static std::unique_ptr<CompressionStream> createCompressionStream(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static std::unique_ptr<CompressionStream> createDecompressionStream(ByteBuffer::CompressionMethod compressionMethod, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static std::unique_ptr<CompressionStream> createDecompressionStream(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static std::unique_ptr<CompressionStream> createStream(ByteBuffer::CompressionMethod compressionMethod, Mode mode, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static std::unique_ptr<CompressionStream> createStream(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool transform(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const InputCallback & inputCallback, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool transform(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, const InputCallback & inputCallback, OutputCallback outputCallback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool compressFile(ByteBuffer::CompressionMethod compressionMethod, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite = false, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool compressFile(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite = false, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool decompressFile(ByteBuffer::CompressionMethod compressionMethod, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite = false, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool decompressFile(ByteBuffer::CompressionMethod compressionMethod, const ByteBuffer::CompressionOptions & options, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite = false, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool transformFile(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite = false, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static bool transformFile(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, const std::string & inputFilePath, const std::string & outputFilePath, bool overwrite = false, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+	static uint32_t getNumberOfCompressionThreads(const ByteBuffer::CompressionOptions & options);
+
+	static const size_t DEFAULT_CHUNK_SIZE;
+	static const size_t MINIMUM_CHUNK_SIZE;
+
+private:
+	CompressionStream(ByteBuffer::CompressionMethod compressionMethod, Mode mode, const ByteBuffer::CompressionOptions & options, OutputCallback outputCallback, size_t chunkSize);
+
+	bool initialize();
+	bool initializeBZip2();
+	bool initializeLZMA();
+	bool initializeZLib();
+	bool initializeZStandard();
+	bool process(const uint8_t * data, size_t size, bool finish);
+	bool processBZip2(const uint8_t * data, size_t size, bool finish);
+	bool processLZMA(const uint8_t * data, size_t size, bool finish);
+	bool processZLib(const uint8_t * data, size_t size, bool finish);
+	bool processZStandard(const uint8_t * data, size_t size, bool finish);
+	bool emitOutput();
+
+	ByteBuffer::CompressionMethod m_compressionMethod;
+	Mode m_mode;
+	ByteBuffer::CompressionOptions m_options;
+	OutputCallback m_outputCallback;
+	std::vector<uint8_t> m_outputBuffer;
+	size_t m_outputBufferOffset;
+	uint64_t m_totalInputSize;
+	uint64_t m_totalOutputSize;
+	bool m_streamEnded;
+	bool m_finished;
+	BZip2::StreamHandle m_bZip2Stream;
+	LZMA::StreamHandle m_lzmaStream;
+	ZLib::StreamHandle m_zLibStream;
+	ZStandard::CompressionContextHandle m_zStandardCompressionContext;
+	ZStandard::DecompressionContextHandle m_zStandardDecompressionContext;
+
+	CompressionStream(const CompressionStream &) = delete;
+	const CompressionStream & operator = (const CompressionStream &) = delete;
+};
+
+#endif // _COMPRESSION_STREAM_H_
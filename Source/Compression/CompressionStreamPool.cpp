@@ -0,0 +1,196 @@
+#include "CompressionStreamPool.h"
+
+#include "Application/ComponentRegistry.h"
+
+#include <algorithm>
+
+static std::unique_ptr<CompressionStreamPool> s_compressionStreamPoolInstance;
+
+const size_t CompressionStreamPool::DEFAULT_MAXIMUM_IDLE_STREAMS_PER_KEY = 4;
+
+std::chrono::nanoseconds CompressionStreamPool::Statistics::getAverageDuration() const {
+	if(numberOfCalls == 0) {
+		return std::chrono::nanoseconds::zero();
+	}
+
+	return totalDuration / numberOfCalls;
+}
+
+CompressionStreamPool::CompressionStreamPool()
+	: m_maximumIdleStreamsPerKey(DEFAULT_MAXIMUM_IDLE_STREAMS_PER_KEY) { }
+
+CompressionStreamPool::~CompressionStreamPool() = default;
+
+CompressionStreamPool & CompressionStreamPool::getInstance() {
+	static std::mutex s_instanceMutex;
+
+	std::lock_guard<std::mutex> instanceLock(s_instanceMutex);
+
+	if(s_compressionStreamPoolInstance == nullptr) {
+		s_compressionStreamPoolInstance = std::unique_ptr<CompressionStreamPool>(new CompressionStreamPool());
+
+		ComponentRegistry::getInstance().addComponent(&s_compressionStreamPoolInstance);
+	}
+
+	return *s_compressionStreamPoolInstance;
+}
+
+CompressionStreamPool::StreamKey CompressionStreamPool::getStreamKey(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode, const ByteBuffer::CompressionOptions & options) {
+	// decompressors ignore the encoder settings, so they can be shared regardless of level or thread count
+	if(mode == CompressionStream::Mode::Decompress) {
+		return StreamKey(compressionMethod, mode, std::nullopt, false, options.windowSizeLog, options.dictionary.get(), 0);
+	}
+
+	return StreamKey(compressionMethod, mode, options.level, options.extreme, options.windowSizeLog, options.dictionary.get(), CompressionStream::getNumberOfCompressionThreads(options));
+}
+
+std::unique_ptr<CompressionStream> CompressionStreamPool::acquireStream(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode, const ByteBuffer::CompressionOptions & options, CompressionStream::OutputCallback outputCallback, size_t chunkSize) {
+	std::unique_ptr<CompressionStream> compressionStream;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		std::map<StreamKey, std::vector<std::unique_ptr<CompressionStream>>>::iterator idleStreams(m_idleStreams.find(getStreamKey(compressionMethod, mode, options)));
+
+		if(idleStreams != m_idleStreams.end() && !idleStreams->second.empty()) {
+			compressionStream = std::move(idleStreams->second.back());
+			idleStreams->second.pop_back();
+		}
+	}
+
+	if(compressionStream != nullptr && compressionStream->reset(outputCallback, chunkSize)) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_statistics[StatisticsKey(compressionMethod, mode)].numberOfStreamsReused++;
+
+		return compressionStream;
+	}
+
+	compressionStream = CompressionStream::createStream(compressionMethod, mode, options, std::move(outputCallback), chunkSize);
+
+	if(compressionStream == nullptr) {
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_statistics[StatisticsKey(compressionMethod, mode)].numberOfStreamsCreated++;
+
+	return compressionStream;
+}
+
+void CompressionStreamPool::releaseStream(std::unique_ptr<CompressionStream> compressionStream) {
+	// streams which failed part way through are left in an unknown state and are discarded
+	if(compressionStream == nullptr || !compressionStream->isFinished()) {
+		return;
+	}
+
+	// the output callback usually references the caller's output buffer, so it must not outlive the call
+	compressionStream->m_outputCallback = nullptr;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::vector<std::unique_ptr<CompressionStream>> & idleStreams = m_idleStreams[getStreamKey(compressionStream->getCompressionMethod(), compressionStream->getMode(), compressionStream->getOptions())];
+
+	if(idleStreams.size() >= m_maximumIdleStreamsPerKey) {
+		return;
+	}
+
+	idleStreams.push_back(std::move(compressionStream));
+}
+
+void CompressionStreamPool::recordCall(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode, std::chrono::nanoseconds duration, uint64_t inputSize, uint64_t outputSize, bool success) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	Statistics & statistics = m_statistics[StatisticsKey(compressionMethod, mode)];
+
+	statistics.numberOfCalls++;
+
+	if(!success) {
+		statistics.numberOfFailedCalls++;
+	}
+
+	statistics.totalInputSize += inputSize;
+	statistics.totalOutputSize += outputSize;
+	statistics.totalDuration += duration;
+	statistics.minimumDuration = statistics.numberOfCalls == 1 ? duration : std::min(statistics.minimumDuration, duration);
+	statistics.maximumDuration = std::max(statistics.maximumDuration, duration);
+}
+
+CompressionStreamPool::Statistics CompressionStreamPool::getStatistics(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::map<StatisticsKey, Statistics>::const_iterator statistics(m_statistics.find(StatisticsKey(compressionMethod, mode)));
+
+	if(statistics == m_statistics.end()) {
+		return {};
+	}
+
+	return statistics->second;
+}
+
+CompressionStreamPool::Statistics CompressionStreamPool::getStatistics() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	Statistics totalStatistics;
+
+	for(const std::pair<const StatisticsKey, Statistics> & statistics : m_statistics) {
+		// the minimum duration is only meaningful once at least one call has been recorded
+		if(statistics.second.numberOfCalls != 0) {
+			totalStatistics.minimumDuration = totalStatistics.numberOfCalls == 0 ? statistics.second.minimumDuration : std::min(totalStatistics.minimumDuration, statistics.second.minimumDuration);
+		}
+
+		totalStatistics.numberOfCalls += statistics.second.numberOfCalls;
+		totalStatistics.numberOfFailedCalls += statistics.second.numberOfFailedCalls;
+		totalStatistics.numberOfStreamsCreated += statistics.second.numberOfStreamsCreated;
+		totalStatistics.numberOfStreamsReused += statistics.second.numberOfStreamsReused;
+		totalStatistics.totalInputSize += statistics.second.totalInputSize;
+		totalStatistics.totalOutputSize += statistics.second.totalOutputSize;
+		totalStatistics.totalDuration += statistics.second.totalDuration;
+		totalStatistics.maximumDuration = std::max(totalStatistics.maximumDuration, statistics.second.maximumDuration);
+	}
+
+	return totalStatistics;
+}
+
+void CompressionStreamPool::resetStatistics() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_statistics.clear();
+}
+
+size_t CompressionStreamPool::numberOfIdleStreams() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	size_t numberOfIdleStreams = 0;
+
+	for(const std::pair<const StreamKey, std::vector<std::unique_ptr<CompressionStream>>> & idleStreams : m_idleStreams) {
+		numberOfIdleStreams += idleStreams.second.size();
+	}
+
+	return numberOfIdleStreams;
+}
+
+size_t CompressionStreamPool::getMaximumIdleStreamsPerKey() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_maximumIdleStreamsPerKey;
+}
+
+void CompressionStreamPool::setMaximumIdleStreamsPerKey(size_t maximumIdleStreamsPerKey) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_maximumIdleStreamsPerKey = maximumIdleStreamsPerKey;
+
+	for(std::pair<const StreamKey, std::vector<std::unique_ptr<CompressionStream>>> & idleStreams : m_idleStreams) {
+		if(idleStreams.second.size() > m_maximumIdleStreamsPerKey) {
+			idleStreams.second.resize(m_maximumIdleStreamsPerKey);
+		}
+	}
+}
+
+void CompressionStreamPool::clear() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_idleStreams.clear();
+}
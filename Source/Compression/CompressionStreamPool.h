@@ -0,0 +1,67 @@
+#ifndef _COMPRESSION_STREAM_POOL_H_
+#define _COMPRESSION_STREAM_POOL_H_
+
+#include "ByteBuffer.h"
+#include "CompressionStream.h"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+class CompressionStreamPool final {
+public:
+	struct Statistics {
+		uint64_t numberOfCalls = 0;
+		uint64_t numberOfFailedCalls = 0;
+		uint64_t numberOfStreamsCreated = 0;
+		uint64_t numberOfStreamsReused = 0;
+		uint64_t totalInputSize = 0;
+		uint64_t totalOutputSize = 0;
+		std::chrono::nanoseconds totalDuration = std::chrono::nanoseconds::zero();
+		std::chrono::nanoseconds minimumDuration = std::chrono::nanoseconds::zero();
+		std::chrono::nanoseconds maximumDuration = std::chrono::nanoseconds::zero();
+
+		std::chrono::nanoseconds getAverageDuration() const;
+	};
+
+	~CompressionStreamPool();
+
+	static CompressionStreamPool & getInstance();
+
+	std::unique_ptr<CompressionStream> acquireStream(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode, const ByteBuffer::CompressionOptions & options, CompressionStream::OutputCallback outputCallback, size_t chunkSize = CompressionStream::DEFAULT_CHUNK_SIZE);
+	void releaseStream(std::unique_ptr<CompressionStream> compressionStream);
+	void recordCall(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode, std::chrono::nanoseconds duration, uint64_t inputSize, uint64_t outputSize, bool success);
+	Statistics getStatistics(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode) const;
+	Statistics getStatistics() const;
+	void resetStatistics();
+	size_t numberOfIdleStreams() const;
+	size_t getMaximumIdleStreamsPerKey() const;
+	void setMaximumIdleStreamsPerKey(size_t maximumIdleStreamsPerKey);
+	void clear();
+
+	static const size_t DEFAULT_MAXIMUM_IDLE_STREAMS_PER_KEY;
+
+private:
+	// streams are only interchangeable when every option that affects codec initialization matches
+	using StreamKey = std::tuple<ByteBuffer::CompressionMethod, CompressionStream::Mode, std::optional<int32_t>, bool, std::optional<uint8_t>, const ByteBuffer *, uint32_t>;
+	using StatisticsKey = std::pair<ByteBuffer::CompressionMethod, CompressionStream::Mode>;
+
+	CompressionStreamPool();
+
+	static StreamKey getStreamKey(ByteBuffer::CompressionMethod compressionMethod, CompressionStream::Mode mode, const ByteBuffer::CompressionOptions & options);
+
+	std::map<StreamKey, std::vector<std::unique_ptr<CompressionStream>>> m_idleStreams;
+	std::map<StatisticsKey, Statistics> m_statistics;
+	size_t m_maximumIdleStreamsPerKey;
+	mutable std::mutex m_mutex;
+
+	CompressionStreamPool(const CompressionStreamPool &) = delete;
+	const CompressionStreamPool & operator = (const CompressionStreamPool &) = delete;
+};
+
+#endif // _COMPRESSION_STREAM_POOL_H_
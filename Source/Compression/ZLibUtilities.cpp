@@ -49,14 +49,13 @@ namespace ZLib {
 		return true;
 	}
 
-	StreamHandle createDeflationStreamHandle() {
+	StreamHandle createDeflationStreamHandle(int level, int windowBits) {
 		z_stream * streamHandle = new z_stream();
 		streamHandle->zalloc = nullptr;
 		streamHandle->zfree = nullptr;
 		streamHandle->opaque = nullptr;
 
-		// TODO: Allow ZLib compression parameters to be customizable:
-		if(!isSuccess(deflateInit(streamHandle, Z_DEFAULT_COMPRESSION), "Failed to initialize ZLib deflation stream handle")) {
+		if(!isSuccess(deflateInit2(streamHandle, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY), "Failed to initialize ZLib deflation stream handle")) {
 			delete streamHandle;
 			return nullptr;
 		}
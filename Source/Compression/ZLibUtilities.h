@@ -13,7 +13,7 @@ namespace ZLib {
 
 	std::string resultToString(int result);
 	bool isSuccess(int result, const std::string & errorMessage = {});
-	StreamHandle createDeflationStreamHandle();
+	StreamHandle createDeflationStreamHandle(int level = Z_DEFAULT_COMPRESSION, int windowBits = MAX_WBITS);
 	StreamHandle createInflationStreamHandle();
 
 }
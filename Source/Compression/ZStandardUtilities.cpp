@@ -0,0 +1,75 @@
+#include "ZStandardUtilities.h"
+
+#include <spdlog/spdlog.h>
+
+namespace ZStandard {
+
+	std::string resultToString(size_t result) {
+		if(!ZSTD_isError(result)) {
+			return "Ok";
+		}
+
+		return ZSTD_getErrorName(result);
+	}
+
+	bool isSuccess(size_t result, const std::string & errorMessage) {
+		if(ZSTD_isError(result)) {
+			if(!errorMessage.empty()) {
+				spdlog::error("{}: {}.", errorMessage, resultToString(result));
+			}
+
+			return false;
+		}
+
+		return true;
+	}
+
+	CompressionContextHandle createCompressionContextHandle() {
+		ZSTD_CCtx * contextHandle = ZSTD_createCCtx();
+
+		if(contextHandle == nullptr) {
+			spdlog::error("Failed to create Zstandard compression context handle.");
+			return nullptr;
+		}
+
+		return CompressionContextHandle(contextHandle, [](ZSTD_CCtx * contextHandle) {
+			if(contextHandle != nullptr) {
+				ZSTD_freeCCtx(contextHandle);
+			}
+		});
+	}
+
+	DecompressionContextHandle createDecompressionContextHandle() {
+		ZSTD_DCtx * contextHandle = ZSTD_createDCtx();
+
+		if(contextHandle == nullptr) {
+			spdlog::error("Failed to create Zstandard decompression context handle.");
+			return nullptr;
+		}
+
+		return DecompressionContextHandle(contextHandle, [](ZSTD_DCtx * contextHandle) {
+			if(contextHandle != nullptr) {
+				ZSTD_freeDCtx(contextHandle);
+			}
+		});
+	}
+
+	ZSTD_DCtx * getThreadLocalDecompressionContext() {
+		thread_local DecompressionContextHandle s_contextHandle;
+
+		if(s_contextHandle == nullptr) {
+			s_contextHandle = createDecompressionContextHandle();
+
+			if(s_contextHandle == nullptr) {
+				return nullptr;
+			}
+		}
+		else if(!isSuccess(ZSTD_DCtx_reset(s_contextHandle.get(), ZSTD_reset_session_and_parameters), "Failed to reset Zstandard decompression context")) {
+			s_contextHandle.reset();
+			return nullptr;
+		}
+
+		return s_contextHandle.get();
+	}
+
+} // namespace ZStandard
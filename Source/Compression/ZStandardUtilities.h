@@ -0,0 +1,23 @@
+#ifndef _ZSTANDARD_UTILITIES_H_
+#define _ZSTANDARD_UTILITIES_H_
+
+#include <zstd.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace ZStandard {
+
+	using CompressionContextHandle = std::unique_ptr<ZSTD_CCtx, std::function<void (ZSTD_CCtx *)>>;
+	using DecompressionContextHandle = std::unique_ptr<ZSTD_DCtx, std::function<void (ZSTD_DCtx *)>>;
+
+	std::string resultToString(size_t result);
+	bool isSuccess(size_t result, const std::string & errorMessage = {});
+	CompressionContextHandle createCompressionContextHandle();
+	DecompressionContextHandle createDecompressionContextHandle();
+	ZSTD_DCtx * getThreadLocalDecompressionContext();
+
+}
+
+#endif // _ZSTANDARD_UTILITIES_H_
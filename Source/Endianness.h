@@ -1,7 +1,10 @@
 #ifndef _ENDIANNESS_H_
 #define _ENDIANNESS_H_
 
+#include <bit>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 enum class Endianness {
 	BigEndian,
@@ -48,4 +51,44 @@ uint32_t toEndian(uint32_t value, Endianness endianness);
 int64_t toEndian(int64_t value, Endianness endianness);
 uint64_t toEndian(uint64_t value, Endianness endianness);
 
+template <Endianness E>
+constexpr bool isNativeEndianness() {
+	return (E == Endianness::BigEndian) == (std::endian::native == std::endian::big);
+}
+
+template <size_t N>
+using UnsignedIntegerOfSize = std::conditional_t<N == 1, uint8_t, std::conditional_t<N == 2, uint16_t, std::conditional_t<N == 4, uint32_t, uint64_t>>>;
+
+template <typename T>
+constexpr bool isEndianValueType() {
+	return std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+}
+
+template <Endianness E, typename T>
+T fromEndianBytes(const uint8_t * data) {
+	static_assert(isEndianValueType<T>(), "Only 1, 2, 4 or 8 byte arithmetic types have an endianness.");
+
+	UnsignedIntegerOfSize<sizeof(T)> value;
+	std::memcpy(&value, data, sizeof(T));
+
+	if constexpr(sizeof(T) != 1 && !isNativeEndianness<E>()) {
+		value = std::byteswap(value);
+	}
+
+	return std::bit_cast<T>(value);
+}
+
+template <Endianness E, typename T>
+void toEndianBytes(T value, uint8_t * data) {
+	static_assert(isEndianValueType<T>(), "Only 1, 2, 4 or 8 byte arithmetic types have an endianness.");
+
+	UnsignedIntegerOfSize<sizeof(T)> bytes = std::bit_cast<UnsignedIntegerOfSize<sizeof(T)>>(value);
+
+	if constexpr(sizeof(T) != 1 && !isNativeEndianness<E>()) {
+		bytes = std::byteswap(bytes);
+	}
+
+	std::memcpy(data, &bytes, sizeof(T));
+}
+
 #endif // _ENDIANNESS_H_
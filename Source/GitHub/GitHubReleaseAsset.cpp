@@ -1,5 +1,6 @@
 #include "GitHubReleaseAsset.h"
 
+#include "Network/HTTPDownloader.h"
 #include "Utilities/RapidJSONUtilities.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/TimeUtilities.h"
@@ -130,6 +131,18 @@ void GitHubReleaseAsset::setParentGitHubRelease(const GitHubRelease * release) {
 	m_parentGitHubRelease = release;
 }
 
+bool GitHubReleaseAsset::downloadTo(const std::string & filePath, bool overwrite) const {
+	if(m_downloadURL.empty()) {
+		return false;
+	}
+
+	HTTPDownloader::Options options;
+	options.overwrite = overwrite;
+	options.expectedSize = m_fileSize;
+
+	return HTTPDownloader::downloadFile(m_downloadURL, filePath, options);
+}
+
 std::unique_ptr<GitHubReleaseAsset> GitHubReleaseAsset::parseFrom(const rapidjson::Value & assetValue) {
 	if(!assetValue.IsObject()) {
 		spdlog::error("Invalid GitHub release asset type: '{}', expected 'object'.", Utilities::typeToString(assetValue.GetType()));
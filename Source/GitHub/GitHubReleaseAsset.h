@@ -32,6 +32,8 @@ public:
 
 	const GitHubRelease * getParentGitHubRelease() const;
 
+	bool downloadTo(const std::string & filePath, bool overwrite = true) const;
+
 	static std::unique_ptr<GitHubReleaseAsset> parseFrom(const rapidjson::Value & assetValue);
 
 	bool isValid() const;
@@ -0,0 +1,236 @@
+#include "Hasher.h"
+
+#include "Utilities/SIMDUtilities.h"
+
+#include <cryptopp/cryptlib.h>
+#include <cryptopp/md5.h>
+#include <cryptopp/sha.h>
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+// large inputs are fed to every digest one chunk at a time so that each chunk is still cached when the next digest reads it
+const size_t Hasher::UPDATE_CHUNK_SIZE = 64 * 1024;
+
+Hasher::Hasher(ByteBuffer::HashType hashType)
+	: m_numberOfBytesHashed(0)
+	, m_finished(false) {
+	addHashType(hashType);
+}
+
+Hasher::Hasher(const std::vector<ByteBuffer::HashType> & hashTypes)
+	: m_numberOfBytesHashed(0)
+	, m_finished(false) {
+	for(ByteBuffer::HashType hashType : hashTypes) {
+		addHashType(hashType);
+	}
+}
+
+Hasher::Hasher(Hasher && hasher) noexcept
+	: m_hashes(std::move(hasher.m_hashes))
+	, m_digests(std::move(hasher.m_digests))
+	, m_numberOfBytesHashed(hasher.m_numberOfBytesHashed)
+	, m_finished(hasher.m_finished) {
+	hasher.m_numberOfBytesHashed = 0;
+	hasher.m_finished = false;
+}
+
+Hasher & Hasher::operator = (Hasher && hasher) noexcept {
+	if(this != &hasher) {
+		m_hashes = std::move(hasher.m_hashes);
+		m_digests = std::move(hasher.m_digests);
+		m_numberOfBytesHashed = hasher.m_numberOfBytesHashed;
+		m_finished = hasher.m_finished;
+
+		hasher.m_numberOfBytesHashed = 0;
+		hasher.m_finished = false;
+	}
+
+	return *this;
+}
+
+Hasher::~Hasher() = default;
+
+std::vector<ByteBuffer::HashType> Hasher::getHashTypes() const {
+	std::vector<ByteBuffer::HashType> hashTypes;
+	hashTypes.reserve(m_hashes.size());
+
+	for(std::map<ByteBuffer::HashType, std::unique_ptr<CryptoPP::HashTransformation>>::const_iterator i = m_hashes.cbegin(); i != m_hashes.cend(); ++i) {
+		hashTypes.push_back(i->first);
+	}
+
+	return hashTypes;
+}
+
+bool Hasher::hasHashType(ByteBuffer::HashType hashType) const {
+	return m_hashes.find(hashType) != m_hashes.cend();
+}
+
+bool Hasher::hasHashTypes() const {
+	return !m_hashes.empty();
+}
+
+bool Hasher::addHashType(ByteBuffer::HashType hashType) {
+	if(hasHashType(hashType)) {
+		return true;
+	}
+
+	// a digest added part way through would not cover the data which has already been hashed
+	if(m_numberOfBytesHashed != 0 || m_finished) {
+		spdlog::error("Cannot add {} hash type after hashing has started.", magic_enum::enum_name(hashType));
+		return false;
+	}
+
+	std::unique_ptr<CryptoPP::HashTransformation> hash(createHashTransformation(hashType));
+
+	if(hash == nullptr) {
+		return false;
+	}
+
+	m_hashes.emplace(hashType, std::move(hash));
+
+	return true;
+}
+
+uint64_t Hasher::getNumberOfBytesHashed() const {
+	return m_numberOfBytesHashed;
+}
+
+bool Hasher::isFinished() const {
+	return m_finished;
+}
+
+bool Hasher::update(const uint8_t * data, size_t size) {
+	if(m_finished) {
+		return false;
+	}
+
+	if(size == 0) {
+		return true;
+	}
+
+	if(data == nullptr) {
+		return false;
+	}
+
+	for(size_t offset = 0; offset < size; offset += UPDATE_CHUNK_SIZE) {
+		size_t chunkSize = std::min(size - offset, UPDATE_CHUNK_SIZE);
+
+		for(std::map<ByteBuffer::HashType, std::unique_ptr<CryptoPP::HashTransformation>>::iterator i = m_hashes.begin(); i != m_hashes.end(); ++i) {
+			i->second->Update(data + offset, chunkSize);
+		}
+	}
+
+	m_numberOfBytesHashed += size;
+
+	return true;
+}
+
+bool Hasher::update(std::span<const uint8_t> data) {
+	return update(data.data(), data.size());
+}
+
+bool Hasher::update(std::string_view data) {
+	return update(reinterpret_cast<const uint8_t *>(data.data()), data.size());
+}
+
+bool Hasher::update(const ByteBuffer & buffer) {
+	return update(buffer.getRawData(), buffer.getSize());
+}
+
+bool Hasher::finish() {
+	if(m_finished) {
+		return true;
+	}
+
+	for(std::map<ByteBuffer::HashType, std::unique_ptr<CryptoPP::HashTransformation>>::iterator i = m_hashes.begin(); i != m_hashes.end(); ++i) {
+		std::vector<uint8_t> digest(i->second->DigestSize());
+		i->second->Final(digest.data());
+		m_digests[i->first] = std::move(digest);
+	}
+
+	m_finished = true;
+
+	return true;
+}
+
+void Hasher::reset() {
+	for(std::map<ByteBuffer::HashType, std::unique_ptr<CryptoPP::HashTransformation>>::iterator i = m_hashes.begin(); i != m_hashes.end(); ++i) {
+		i->second->Restart();
+	}
+
+	m_digests.clear();
+	m_numberOfBytesHashed = 0;
+	m_finished = false;
+}
+
+std::optional<std::vector<uint8_t>> Hasher::getDigest(ByteBuffer::HashType hashType) const {
+	std::map<ByteBuffer::HashType, std::vector<uint8_t>>::const_iterator digestIterator(m_digests.find(hashType));
+
+	if(digestIterator == m_digests.cend()) {
+		return {};
+	}
+
+	return digestIterator->second;
+}
+
+const std::map<ByteBuffer::HashType, std::vector<uint8_t>> & Hasher::getDigests() const {
+	return m_digests;
+}
+
+std::string Hasher::getHash(ByteBuffer::HashType hashType, ByteBuffer::HashFormat hashFormat) const {
+	std::map<ByteBuffer::HashType, std::vector<uint8_t>>::const_iterator digestIterator(m_digests.find(hashType));
+
+	if(digestIterator == m_digests.cend()) {
+		return {};
+	}
+
+	return formatDigest(digestIterator->second, hashFormat);
+}
+
+std::map<ByteBuffer::HashType, std::string> Hasher::getHashes(ByteBuffer::HashFormat hashFormat) const {
+	std::map<ByteBuffer::HashType, std::string> hashes;
+
+	for(std::map<ByteBuffer::HashType, std::vector<uint8_t>>::const_iterator i = m_digests.cbegin(); i != m_digests.cend(); ++i) {
+		hashes.emplace(i->first, formatDigest(i->second, hashFormat));
+	}
+
+	return hashes;
+}
+
+std::unique_ptr<CryptoPP::HashTransformation> Hasher::createHashTransformation(ByteBuffer::HashType hashType) {
+	switch(hashType) {
+		case ByteBuffer::HashType::MD5: {
+			return std::make_unique<CryptoPP::Weak::MD5>();
+		}
+		case ByteBuffer::HashType::SHA1: {
+			return std::make_unique<CryptoPP::SHA1>();
+		}
+		case ByteBuffer::HashType::SHA256: {
+			return std::make_unique<CryptoPP::SHA256>();
+		}
+		case ByteBuffer::HashType::SHA512: {
+			return std::make_unique<CryptoPP::SHA512>();
+		}
+	}
+
+	return nullptr;
+}
+
+std::string Hasher::formatDigest(std::span<const uint8_t> digest, ByteBuffer::HashFormat hashFormat) {
+	switch(hashFormat) {
+		case ByteBuffer::HashFormat::Hexadecimal: {
+			std::string hash(Utilities::getHexadecimalEncodedLength(digest.size()), '\0');
+			Utilities::encodeHexadecimal(digest, hash);
+			return hash;
+		}
+		case ByteBuffer::HashFormat::Base64: {
+			std::string hash(Utilities::getBase64EncodedLength(digest.size()), '\0');
+			Utilities::encodeBase64(digest, hash);
+			return hash;
+		}
+	}
+
+	return {};
+}
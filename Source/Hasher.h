@@ -0,0 +1,61 @@
+#ifndef _HASHER_H_
+#define _HASHER_H_
+
+#include "ByteBuffer.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CryptoPP {
+	class HashTransformation;
+}
+
+class Hasher final {
+public:
+	Hasher(ByteBuffer::HashType hashType);
+	Hasher(const std::vector<ByteBuffer::HashType> & hashTypes = {});
+	Hasher(Hasher && hasher) noexcept;
+	Hasher & operator = (Hasher && hasher) noexcept;
+	~Hasher();
+
+	std::vector<ByteBuffer::HashType> getHashTypes() const;
+	bool hasHashType(ByteBuffer::HashType hashType) const;
+	bool hasHashTypes() const;
+	bool addHashType(ByteBuffer::HashType hashType);
+	uint64_t getNumberOfBytesHashed() const;
+	bool isFinished() const;
+
+	bool update(const uint8_t * data, size_t size);
+	bool update(std::span<const uint8_t> data);
+	bool update(std::string_view data);
+	bool update(const ByteBuffer & buffer);
+	bool finish();
+	void reset();
+
+	std::optional<std::vector<uint8_t>> getDigest(ByteBuffer::HashType hashType) const;
+	const std::map<ByteBuffer::HashType, std::vector<uint8_t>> & getDigests() const;
+	std::string getHash(ByteBuffer::HashType hashType, ByteBuffer::HashFormat hashFormat = ByteBuffer::DEFAULT_HASH_FORMAT) const;
+	std::map<ByteBuffer::HashType, std::string> getHashes(ByteBuffer::HashFormat hashFormat = ByteBuffer::DEFAULT_HASH_FORMAT) const;
+
+	static std::unique_ptr<CryptoPP::HashTransformation> createHashTransformation(ByteBuffer::HashType hashType);
+	static std::string formatDigest(std::span<const uint8_t> digest, ByteBuffer::HashFormat hashFormat);
+
+	static const size_t UPDATE_CHUNK_SIZE;
+
+private:
+	std::map<ByteBuffer::HashType, std::unique_ptr<CryptoPP::HashTransformation>> m_hashes;
+	std::map<ByteBuffer::HashType, std::vector<uint8_t>> m_digests;
+	uint64_t m_numberOfBytesHashed;
+	bool m_finished;
+
+	Hasher(const Hasher &) = delete;
+	const Hasher & operator = (const Hasher &) = delete;
+};
+
+#endif // _HASHER_H_
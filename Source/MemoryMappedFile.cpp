@@ -0,0 +1,206 @@
+#include "MemoryMappedFile.h"
+
+#if defined(WINDOWS)
+
+#include "Platform/Windows/WindowsUtilities.h"
+
+#include <windows.h>
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#endif // WINDOWS
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+
+MemoryMappedFile::MemoryMappedFile(const std::string & filePath, const uint8_t * data, size_t size)
+	: m_filePath(filePath)
+	, m_data(data)
+	, m_size(size) { }
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile && file) noexcept
+	: m_filePath(std::move(file.m_filePath))
+	, m_data(file.m_data)
+	, m_size(file.m_size) {
+	file.m_filePath.clear();
+	file.m_data = nullptr;
+	file.m_size = 0;
+}
+
+MemoryMappedFile & MemoryMappedFile::operator = (MemoryMappedFile && file) noexcept {
+	if(this != &file) {
+		close();
+
+		m_filePath = std::move(file.m_filePath);
+		m_data = file.m_data;
+		m_size = file.m_size;
+
+		file.m_filePath.clear();
+		file.m_data = nullptr;
+		file.m_size = 0;
+	}
+
+	return *this;
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+	close();
+}
+
+const std::string & MemoryMappedFile::getFilePath() const {
+	return m_filePath;
+}
+
+const uint8_t * MemoryMappedFile::getData() const {
+	return m_data;
+}
+
+size_t MemoryMappedFile::getSize() const {
+	return m_size;
+}
+
+bool MemoryMappedFile::isEmpty() const {
+	return m_size == 0;
+}
+
+bool MemoryMappedFile::isOpen() const {
+	return !m_filePath.empty();
+}
+
+void MemoryMappedFile::close() {
+	if(m_data != nullptr) {
+#if defined(WINDOWS)
+		UnmapViewOfFile(m_data);
+#else
+		munmap(const_cast<uint8_t *>(m_data), m_size);
+#endif // WINDOWS
+	}
+
+	m_filePath.clear();
+	m_data = nullptr;
+	m_size = 0;
+}
+
+std::unique_ptr<MemoryMappedFile> MemoryMappedFile::open(const std::string & filePath, AccessPattern accessPattern) {
+	if(!std::filesystem::is_regular_file(std::filesystem::path(filePath))) {
+		spdlog::error("Failed to memory map non-existent file: '{}'!", filePath);
+		return nullptr;
+	}
+
+#if defined(WINDOWS)
+	DWORD fileFlags = FILE_ATTRIBUTE_NORMAL;
+
+	if(accessPattern == AccessPattern::Sequential) {
+		fileFlags |= FILE_FLAG_SEQUENTIAL_SCAN;
+	}
+	else if(accessPattern == AccessPattern::Random) {
+		fileFlags |= FILE_FLAG_RANDOM_ACCESS;
+	}
+
+	HANDLE fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, fileFlags, nullptr);
+
+	if(fileHandle == INVALID_HANDLE_VALUE) {
+		spdlog::error("Failed to open file '{}' for memory mapping: {}", filePath, WindowsUtilities::getLastErrorMessage());
+		return nullptr;
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if(!GetFileSizeEx(fileHandle, &fileSize)) {
+		spdlog::error("Failed to determine size of file '{}' for memory mapping: {}", filePath, WindowsUtilities::getLastErrorMessage());
+		CloseHandle(fileHandle);
+		return nullptr;
+	}
+
+	// empty files cannot be mapped, but are still valid
+	if(fileSize.QuadPart == 0) {
+		CloseHandle(fileHandle);
+		return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(filePath, nullptr, 0));
+	}
+
+	HANDLE fileMappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if(fileMappingHandle == nullptr) {
+		spdlog::error("Failed to create file mapping for '{}': {}", filePath, WindowsUtilities::getLastErrorMessage());
+		CloseHandle(fileHandle);
+		return nullptr;
+	}
+
+	void * data = MapViewOfFile(fileMappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+	// the mapped view keeps the file mapping alive, so the handles can be released immediately
+	CloseHandle(fileMappingHandle);
+	CloseHandle(fileHandle);
+
+	if(data == nullptr) {
+		spdlog::error("Failed to map view of file '{}': {}", filePath, WindowsUtilities::getLastErrorMessage());
+		return nullptr;
+	}
+
+	return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(filePath, static_cast<const uint8_t *>(data), static_cast<size_t>(fileSize.QuadPart)));
+#else
+	int fileDescriptor = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+
+	if(fileDescriptor == -1) {
+		spdlog::error("Failed to open file '{}' for memory mapping: {}", filePath, std::strerror(errno));
+		return nullptr;
+	}
+
+	struct stat fileStatus;
+
+	if(fstat(fileDescriptor, &fileStatus) != 0) {
+		spdlog::error("Failed to determine size of file '{}' for memory mapping: {}", filePath, std::strerror(errno));
+		::close(fileDescriptor);
+		return nullptr;
+	}
+
+	// pipes and special files cannot be mapped, callers are expected to fall back to reading them
+	if(!S_ISREG(fileStatus.st_mode)) {
+		spdlog::debug("Cannot memory map '{}', it is not a regular file.", filePath);
+		::close(fileDescriptor);
+		return nullptr;
+	}
+
+	size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+
+	// empty files cannot be mapped, but are still valid
+	if(fileSize == 0) {
+		::close(fileDescriptor);
+		return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(filePath, nullptr, 0));
+	}
+
+	void * data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+	// the mapping holds its own reference to the file, so the descriptor can be closed immediately
+	::close(fileDescriptor);
+
+	if(data == MAP_FAILED) {
+		if(errno == ENODEV) {
+			spdlog::debug("Cannot memory map file '{}', its file system does not support memory mapping.", filePath);
+		}
+		else {
+			spdlog::error("Failed to memory map file '{}': {}", filePath, std::strerror(errno));
+		}
+
+		return nullptr;
+	}
+
+	if(accessPattern == AccessPattern::Sequential) {
+		madvise(data, fileSize, MADV_SEQUENTIAL);
+	}
+	else if(accessPattern == AccessPattern::Random) {
+		madvise(data, fileSize, MADV_RANDOM);
+	}
+
+	return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(filePath, static_cast<const uint8_t *>(data), fileSize));
+#endif // WINDOWS
+}
@@ -0,0 +1,40 @@
+#ifndef _MEMORY_MAPPED_FILE_H_
+#define _MEMORY_MAPPED_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class MemoryMappedFile final {
+public:
+	enum class AccessPattern {
+		Normal,
+		Sequential,
+		Random
+	};
+
+	MemoryMappedFile(MemoryMappedFile && file) noexcept;
+	MemoryMappedFile & operator = (MemoryMappedFile && file) noexcept;
+	~MemoryMappedFile();
+
+	const std::string & getFilePath() const;
+	const uint8_t * getData() const;
+	size_t getSize() const;
+	bool isEmpty() const;
+	bool isOpen() const;
+	void close();
+
+	static std::unique_ptr<MemoryMappedFile> open(const std::string & filePath, AccessPattern accessPattern = AccessPattern::Normal);
+
+private:
+	MemoryMappedFile(const std::string & filePath, const uint8_t * data, size_t size);
+
+	std::string m_filePath;
+	const uint8_t * m_data;
+	size_t m_size;
+
+	MemoryMappedFile(const MemoryMappedFile &) = delete;
+	const MemoryMappedFile & operator = (const MemoryMappedFile &) = delete;
+};
+
+#endif // _MEMORY_MAPPED_FILE_H_
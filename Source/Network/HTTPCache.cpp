@@ -0,0 +1,507 @@
+#include "HTTPCache.h"
+
+#include "HTTPResponse.h"
+#include "Utilities/FileUtilities.h"
+#include "Utilities/RapidJSONUtilities.h"
+#include "Utilities/StringUtilities.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <vector>
+
+static constexpr const char * JSON_ENTRIES_PROPERTY_NAME = "entries";
+static constexpr const char * JSON_URL_PROPERTY_NAME = "url";
+static constexpr const char * JSON_BODY_SHA256_PROPERTY_NAME = "bodySHA256";
+static constexpr const char * JSON_BODY_SIZE_PROPERTY_NAME = "bodySize";
+static constexpr const char * JSON_HEADERS_PROPERTY_NAME = "headers";
+static constexpr const char * JSON_STORED_TIMESTAMP_PROPERTY_NAME = "stored";
+static constexpr const char * JSON_LAST_ACCESSED_TIMESTAMP_PROPERTY_NAME = "lastAccessed";
+static constexpr const char * JSON_MAXIMUM_AGE_PROPERTY_NAME = "maximumAge";
+static constexpr size_t SHA256_HEXADECIMAL_LENGTH = 64;
+
+static const std::string NO_STORE_DIRECTIVE("no-store");
+static const std::string NO_CACHE_DIRECTIVE("no-cache");
+static const std::string MAXIMUM_AGE_DIRECTIVE("max-age");
+
+const uint64_t HTTPCache::DEFAULT_MAXIMUM_SIZE = 256 * 1024 * 1024;
+const std::string HTTPCache::INDEX_FILE_NAME("index.json");
+const std::chrono::seconds HTTPCache::INDEX_SAVE_INTERVAL(5);
+
+bool HTTPCache::Entry::isFresh() const {
+	return maximumAge.has_value() && std::chrono::system_clock::now() < storedTimestamp + maximumAge.value();
+}
+
+bool HTTPCache::Entry::hasValidators() const {
+	return !getETag().empty() || !getLastModifiedDate().empty();
+}
+
+std::string HTTPCache::Entry::getETag() const {
+	HTTPHeaders::HeaderMap::const_iterator headerIterator(headers.find(HTTPHeaders::ETAG_HEADER_NAME));
+
+	return headerIterator != headers.cend() ? headerIterator->second : std::string();
+}
+
+std::string HTTPCache::Entry::getLastModifiedDate() const {
+	HTTPHeaders::HeaderMap::const_iterator headerIterator(headers.find(HTTPHeaders::LAST_MODIFIED_HEADER_NAME));
+
+	return headerIterator != headers.cend() ? headerIterator->second : std::string();
+}
+
+HTTPCache::HTTPCache(const std::string & directoryPath, uint64_t maximumSize)
+	: m_directoryPath(directoryPath)
+	, m_maximumSize(maximumSize)
+	, m_size(0)
+	, m_modified(false) { }
+
+HTTPCache::~HTTPCache() {
+	flush(true);
+}
+
+const std::string & HTTPCache::getDirectoryPath() const {
+	return m_directoryPath;
+}
+
+uint64_t HTTPCache::getMaximumSize() const {
+	return m_maximumSize;
+}
+
+uint64_t HTTPCache::getSize() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_size;
+}
+
+size_t HTTPCache::numberOfEntries() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_entries.size();
+}
+
+bool HTTPCache::hasEntry(const std::string & url) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_entries.find(url) != m_entries.cend();
+}
+
+std::optional<HTTPCache::Entry> HTTPCache::getEntry(const std::string & url) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::map<std::string, Entry>::iterator entryIterator(m_entries.find(url));
+
+	if(entryIterator == m_entries.end()) {
+		return {};
+	}
+
+	entryIterator->second.lastAccessedTimestamp = std::chrono::system_clock::now();
+
+	return entryIterator->second;
+}
+
+std::unique_ptr<ByteBuffer> HTTPCache::getBody(const Entry & entry) const {
+	std::unique_ptr<ByteBuffer> body(ByteBuffer::readFrom(getBodyFilePath(entry.bodySHA256)));
+
+	if(body == nullptr || body->getSize() != entry.bodySize) {
+		spdlog::warn("Cached response body for '{}' is missing or corrupted.", entry.url);
+		return nullptr;
+	}
+
+	return body;
+}
+
+bool HTTPCache::store(const std::string & url, const HTTPResponse & response) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	bool noStore = false;
+	std::optional<std::chrono::seconds> maximumAge(getMaximumAge(response.getHeaderValue(HTTPHeaders::CACHE_CONTROL_HEADER_NAME), &noStore));
+
+	if(noStore || (!maximumAge.has_value() && !response.hasETag() && !response.hasLastModifiedDate())) {
+		removeEntry(url);
+		return false;
+	}
+
+	// entries are only keyed by URL, so responses which vary on other request headers cannot be shared
+	if(!isVaryCacheable(response.getHeaderValue(HTTPHeaders::VARY_HEADER_NAME))) {
+		removeEntry(url);
+		return false;
+	}
+
+	const ByteBuffer * body = response.getBody();
+
+	if(body == nullptr || body->getSize() > m_maximumSize) {
+		removeEntry(url);
+		return false;
+	}
+
+	Entry entry;
+	entry.url = url;
+	entry.bodySHA256 = body->getSHA256();
+	entry.bodySize = body->getSize();
+	entry.headers = response.getHeaders();
+	entry.storedTimestamp = std::chrono::system_clock::now();
+	entry.lastAccessedTimestamp = entry.storedTimestamp;
+	entry.maximumAge = maximumAge;
+
+	// the previous entry is removed first so that a body it shares with the new entry is counted and written again
+	removeEntry(url);
+
+	// bodies are stored by content hash, so identical responses from different URLs share a single file
+	std::string bodyFilePath(getBodyFilePath(entry.bodySHA256));
+	bool bodyReferenced = isBodyReferenced(entry.bodySHA256);
+
+	if(!bodyReferenced || !std::filesystem::is_regular_file(std::filesystem::path(bodyFilePath))) {
+		if(!body->writeTo(bodyFilePath, true)) {
+			spdlog::error("Failed to write cached response body to file: '{}'.", bodyFilePath);
+			return false;
+		}
+	}
+
+	if(!bodyReferenced) {
+		m_size += entry.bodySize;
+	}
+
+	m_entries[url] = std::move(entry);
+	m_modified = true;
+
+	evict();
+
+	return true;
+}
+
+bool HTTPCache::refresh(const std::string & url, const HTTPResponse & notModifiedResponse) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::map<std::string, Entry>::iterator entryIterator(m_entries.find(url));
+
+	if(entryIterator == m_entries.end()) {
+		return false;
+	}
+
+	bool noStore = false;
+	std::optional<std::chrono::seconds> maximumAge(getMaximumAge(notModifiedResponse.getHeaderValue(HTTPHeaders::CACHE_CONTROL_HEADER_NAME), &noStore));
+
+	if(noStore) {
+		removeEntry(entryIterator);
+		return true;
+	}
+
+	// a not modified response carries updated metadata for the stored response
+	const HTTPHeaders::HeaderMap & updatedHeaders = notModifiedResponse.getHeaders();
+
+	for(HTTPHeaders::HeaderMap::const_iterator i = updatedHeaders.cbegin(); i != updatedHeaders.cend(); ++i) {
+		if(Utilities::areStringsEqualIgnoreCase(i->first, HTTPHeaders::CONTENT_LENGTH_HEADER_NAME)) {
+			continue;
+		}
+
+		entryIterator->second.headers[i->first] = i->second;
+	}
+
+	entryIterator->second.storedTimestamp = std::chrono::system_clock::now();
+	entryIterator->second.lastAccessedTimestamp = entryIterator->second.storedTimestamp;
+	entryIterator->second.maximumAge = maximumAge;
+	m_modified = true;
+
+	return true;
+}
+
+bool HTTPCache::removeEntry(const std::string & url) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::map<std::string, Entry>::iterator entryIterator(m_entries.find(url));
+
+	if(entryIterator == m_entries.end()) {
+		return false;
+	}
+
+	removeEntry(entryIterator);
+
+	return true;
+}
+
+void HTTPCache::removeEntry(std::map<std::string, Entry>::iterator entryIterator) {
+	std::string bodySHA256(entryIterator->second.bodySHA256);
+	uint64_t bodySize = entryIterator->second.bodySize;
+
+	m_entries.erase(entryIterator);
+	m_modified = true;
+
+	if(isBodyReferenced(bodySHA256)) {
+		return;
+	}
+
+	std::error_code errorCode;
+	std::filesystem::remove(std::filesystem::path(getBodyFilePath(bodySHA256)), errorCode);
+
+	m_size -= std::min(m_size, bodySize);
+}
+
+void HTTPCache::clear() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	while(!m_entries.empty()) {
+		removeEntry(m_entries.begin());
+	}
+
+	m_size = 0;
+
+	save();
+}
+
+bool HTTPCache::load() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	m_entries.clear();
+	m_size = 0;
+	m_modified = false;
+
+	std::string indexFilePath(Utilities::joinPaths(m_directoryPath, INDEX_FILE_NAME));
+
+	if(!std::filesystem::is_regular_file(std::filesystem::path(indexFilePath))) {
+		return true;
+	}
+
+	std::optional<rapidjson::Document> optionalIndexDocument(Utilities::loadJSONDocumentFrom(indexFilePath));
+
+	if(!optionalIndexDocument.has_value() || !optionalIndexDocument->IsObject() || !optionalIndexDocument->HasMember(JSON_ENTRIES_PROPERTY_NAME) || !(*optionalIndexDocument)[JSON_ENTRIES_PROPERTY_NAME].IsArray()) {
+		spdlog::warn("HTTP cache index file '{}' is invalid, discarding cached responses.", indexFilePath);
+		return false;
+	}
+
+	const rapidjson::Value & entriesValue = (*optionalIndexDocument)[JSON_ENTRIES_PROPERTY_NAME];
+
+	for(rapidjson::Value::ConstValueIterator i = entriesValue.Begin(); i != entriesValue.End(); ++i) {
+		std::optional<Entry> optionalEntry(parseEntryFrom(*i));
+
+		if(!optionalEntry.has_value() || !std::filesystem::is_regular_file(std::filesystem::path(getBodyFilePath(optionalEntry->bodySHA256)))) {
+			continue;
+		}
+
+		if(m_entries.find(optionalEntry->url) != m_entries.cend()) {
+			spdlog::warn("Skipping duplicate HTTP cache entry for '{}'.", optionalEntry->url);
+			continue;
+		}
+
+		// bodies shared between entries are only stored once, so they are only counted once
+		if(!isBodyReferenced(optionalEntry->bodySHA256)) {
+			m_size += optionalEntry->bodySize;
+		}
+
+		std::string url(optionalEntry->url);
+		m_entries[url] = std::move(optionalEntry.value());
+	}
+
+	evict();
+
+	return true;
+}
+
+bool HTTPCache::save() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	rapidjson::Document indexDocument(rapidjson::kObjectType);
+	rapidjson::Document::AllocatorType & allocator = indexDocument.GetAllocator();
+	rapidjson::Value entriesValue(rapidjson::kArrayType);
+
+	for(std::map<std::string, Entry>::const_iterator i = m_entries.cbegin(); i != m_entries.cend(); ++i) {
+		entriesValue.PushBack(entryToJSON(i->second, allocator), allocator);
+	}
+
+	indexDocument.AddMember(rapidjson::StringRef(JSON_ENTRIES_PROPERTY_NAME), entriesValue, allocator);
+
+	std::string indexFilePath(Utilities::joinPaths(m_directoryPath, INDEX_FILE_NAME));
+
+	if(!Utilities::saveJSONValueTo(indexDocument, indexFilePath)) {
+		spdlog::error("Failed to save HTTP cache index file: '{}'.", indexFilePath);
+		return false;
+	}
+
+	m_modified = false;
+	m_lastSavedSteadyTimePoint = std::chrono::steady_clock::now();
+
+	return true;
+}
+
+bool HTTPCache::flush(bool force) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_modified) {
+		return true;
+	}
+
+	// index changes are batched so that storing responses does not rewrite the whole index every time
+	if(!force && std::chrono::steady_clock::now() - m_lastSavedSteadyTimePoint < INDEX_SAVE_INTERVAL) {
+		return true;
+	}
+
+	return save();
+}
+
+std::optional<std::chrono::seconds> HTTPCache::getMaximumAge(const std::string & cacheControl, bool * noStore) {
+	std::optional<std::chrono::seconds> maximumAge;
+	std::string_view remainingDirectives(cacheControl);
+
+	if(noStore != nullptr) {
+		*noStore = false;
+	}
+
+	while(!remainingDirectives.empty()) {
+		size_t directiveSeparatorIndex = remainingDirectives.find_first_of(",");
+		std::string directive(Utilities::trimString(std::string(remainingDirectives.substr(0, directiveSeparatorIndex))));
+		remainingDirectives = directiveSeparatorIndex == std::string_view::npos ? std::string_view() : remainingDirectives.substr(directiveSeparatorIndex + 1);
+
+		if(Utilities::areStringsEqualIgnoreCase(directive, NO_STORE_DIRECTIVE)) {
+			if(noStore != nullptr) {
+				*noStore = true;
+			}
+		}
+		// responses which must always be revalidated are treated as immediately stale
+		else if(Utilities::areStringsEqualIgnoreCase(directive, NO_CACHE_DIRECTIVE)) {
+			return std::chrono::seconds::zero();
+		}
+		else if(Utilities::startsWith(directive, MAXIMUM_AGE_DIRECTIVE + "=", false)) {
+			std::optional<uint64_t> optionalMaximumAge(Utilities::parseUnsignedLong(directive.substr(MAXIMUM_AGE_DIRECTIVE.length() + 1)));
+
+			if(optionalMaximumAge.has_value()) {
+				maximumAge = std::chrono::seconds(optionalMaximumAge.value());
+			}
+		}
+	}
+
+	return maximumAge;
+}
+
+bool HTTPCache::isVaryCacheable(std::string_view vary) {
+	std::string_view remainingHeaderNames(vary);
+
+	while(!remainingHeaderNames.empty()) {
+		size_t headerNameSeparatorIndex = remainingHeaderNames.find_first_of(",");
+		std::string headerName(Utilities::trimString(remainingHeaderNames.substr(0, headerNameSeparatorIndex)));
+		remainingHeaderNames = headerNameSeparatorIndex == std::string_view::npos ? std::string_view() : remainingHeaderNames.substr(headerNameSeparatorIndex + 1);
+
+		// bodies are always stored decoded, so they do not depend on the accepted encodings
+		if(!headerName.empty() && !Utilities::areStringsEqualIgnoreCase(headerName, HTTPHeaders::ACCEPT_ENCODING_HEADER_NAME)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::string HTTPCache::getBodyFilePath(const std::string & bodySHA256) const {
+	return Utilities::joinPaths(m_directoryPath, bodySHA256);
+}
+
+bool HTTPCache::isBodyReferenced(const std::string & bodySHA256) const {
+	return std::find_if(m_entries.cbegin(), m_entries.cend(), [&bodySHA256](const std::pair<const std::string, Entry> & entry) {
+		return entry.second.bodySHA256 == bodySHA256;
+	}) != m_entries.cend();
+}
+
+void HTTPCache::evict() {
+	if(m_size <= m_maximumSize) {
+		return;
+	}
+
+	std::vector<std::map<std::string, Entry>::iterator> entryIterators;
+
+	for(std::map<std::string, Entry>::iterator i = m_entries.begin(); i != m_entries.end(); ++i) {
+		entryIterators.push_back(i);
+	}
+
+	std::sort(entryIterators.begin(), entryIterators.end(), [](const std::map<std::string, Entry>::iterator & entryIteratorA, const std::map<std::string, Entry>::iterator & entryIteratorB) {
+		return entryIteratorA->second.lastAccessedTimestamp < entryIteratorB->second.lastAccessedTimestamp;
+	});
+
+	// remove the least recently used entries until the cache fits within its size limit again
+	for(std::map<std::string, Entry>::iterator entryIterator : entryIterators) {
+		if(m_size <= m_maximumSize) {
+			break;
+		}
+
+		spdlog::debug("Evicting cached response for '{}'.", entryIterator->second.url);
+
+		removeEntry(entryIterator);
+	}
+}
+
+rapidjson::Value HTTPCache::entryToJSON(const Entry & entry, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) {
+	rapidjson::Value entryValue(rapidjson::kObjectType);
+
+	rapidjson::Value urlValue(entry.url.c_str(), allocator);
+	entryValue.AddMember(rapidjson::StringRef(JSON_URL_PROPERTY_NAME), urlValue, allocator);
+
+	rapidjson::Value bodySHA256Value(entry.bodySHA256.c_str(), allocator);
+	entryValue.AddMember(rapidjson::StringRef(JSON_BODY_SHA256_PROPERTY_NAME), bodySHA256Value, allocator);
+
+	entryValue.AddMember(rapidjson::StringRef(JSON_BODY_SIZE_PROPERTY_NAME), rapidjson::Value(entry.bodySize), allocator);
+
+	rapidjson::Value headersValue(rapidjson::kObjectType);
+
+	for(HTTPHeaders::HeaderMap::const_iterator i = entry.headers.cbegin(); i != entry.headers.cend(); ++i) {
+		rapidjson::Value headerNameValue(i->first.c_str(), allocator);
+		rapidjson::Value headerValue(i->second.c_str(), allocator);
+		headersValue.AddMember(headerNameValue, headerValue, allocator);
+	}
+
+	entryValue.AddMember(rapidjson::StringRef(JSON_HEADERS_PROPERTY_NAME), headersValue, allocator);
+
+	entryValue.AddMember(rapidjson::StringRef(JSON_STORED_TIMESTAMP_PROPERTY_NAME), rapidjson::Value(static_cast<uint64_t>(std::chrono::time_point_cast<std::chrono::milliseconds>(entry.storedTimestamp).time_since_epoch().count())), allocator);
+	entryValue.AddMember(rapidjson::StringRef(JSON_LAST_ACCESSED_TIMESTAMP_PROPERTY_NAME), rapidjson::Value(static_cast<uint64_t>(std::chrono::time_point_cast<std::chrono::milliseconds>(entry.lastAccessedTimestamp).time_since_epoch().count())), allocator);
+
+	if(entry.maximumAge.has_value()) {
+		entryValue.AddMember(rapidjson::StringRef(JSON_MAXIMUM_AGE_PROPERTY_NAME), rapidjson::Value(static_cast<uint64_t>(entry.maximumAge.value().count())), allocator);
+	}
+
+	return entryValue;
+}
+
+std::optional<HTTPCache::Entry> HTTPCache::parseEntryFrom(const rapidjson::Value & entryValue) {
+	if(!entryValue.IsObject() ||
+	   !entryValue.HasMember(JSON_URL_PROPERTY_NAME) || !entryValue[JSON_URL_PROPERTY_NAME].IsString() ||
+	   !entryValue.HasMember(JSON_BODY_SHA256_PROPERTY_NAME) || !entryValue[JSON_BODY_SHA256_PROPERTY_NAME].IsString() ||
+	   !entryValue.HasMember(JSON_BODY_SIZE_PROPERTY_NAME) || !entryValue[JSON_BODY_SIZE_PROPERTY_NAME].IsUint64() ||
+	   !entryValue.HasMember(JSON_HEADERS_PROPERTY_NAME) || !entryValue[JSON_HEADERS_PROPERTY_NAME].IsObject() ||
+	   !entryValue.HasMember(JSON_STORED_TIMESTAMP_PROPERTY_NAME) || !entryValue[JSON_STORED_TIMESTAMP_PROPERTY_NAME].IsUint64() ||
+	   !entryValue.HasMember(JSON_LAST_ACCESSED_TIMESTAMP_PROPERTY_NAME) || !entryValue[JSON_LAST_ACCESSED_TIMESTAMP_PROPERTY_NAME].IsUint64()) {
+		spdlog::warn("Skipping invalid HTTP cache entry.");
+		return {};
+	}
+
+	Entry entry;
+	entry.url = entryValue[JSON_URL_PROPERTY_NAME].GetString();
+	entry.bodySHA256 = entryValue[JSON_BODY_SHA256_PROPERTY_NAME].GetString();
+	entry.bodySize = entryValue[JSON_BODY_SIZE_PROPERTY_NAME].GetUint64();
+	entry.storedTimestamp = std::chrono::system_clock::from_time_t(time_t{0}) + std::chrono::milliseconds(entryValue[JSON_STORED_TIMESTAMP_PROPERTY_NAME].GetUint64());
+	entry.lastAccessedTimestamp = std::chrono::system_clock::from_time_t(time_t{0}) + std::chrono::milliseconds(entryValue[JSON_LAST_ACCESSED_TIMESTAMP_PROPERTY_NAME].GetUint64());
+
+	const rapidjson::Value & headersValue = entryValue[JSON_HEADERS_PROPERTY_NAME];
+
+	for(rapidjson::Value::ConstMemberIterator i = headersValue.MemberBegin(); i != headersValue.MemberEnd(); ++i) {
+		if(!i->value.IsString()) {
+			continue;
+		}
+
+		entry.headers[i->name.GetString()] = i->value.GetString();
+	}
+
+	if(entryValue.HasMember(JSON_MAXIMUM_AGE_PROPERTY_NAME) && entryValue[JSON_MAXIMUM_AGE_PROPERTY_NAME].IsUint64()) {
+		entry.maximumAge = std::chrono::seconds(entryValue[JSON_MAXIMUM_AGE_PROPERTY_NAME].GetUint64());
+	}
+
+	if(entry.url.empty()) {
+		spdlog::warn("Skipping invalid HTTP cache entry.");
+		return {};
+	}
+
+	// the body hash is used as a file name inside the cache directory, so anything other than a hash could reference files outside of it
+	if(entry.bodySHA256.length() != SHA256_HEXADECIMAL_LENGTH || !std::all_of(entry.bodySHA256.cbegin(), entry.bodySHA256.cend(), [](char character) {
+		return std::isxdigit(static_cast<unsigned char>(character)) != 0;
+	})) {
+		spdlog::warn("Skipping HTTP cache entry for '{}' with invalid body hash.", entry.url);
+		return {};
+	}
+
+	return entry;
+}
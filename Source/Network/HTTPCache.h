@@ -0,0 +1,82 @@
+#ifndef _HTTP_CACHE_H_
+#define _HTTP_CACHE_H_
+
+#include "ByteBuffer.h"
+#include "HTTPHeaders.h"
+
+#include <rapidjson/document.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+class HTTPResponse;
+
+class HTTPCache final {
+public:
+	struct Entry {
+		std::string url;
+		std::string bodySHA256;
+		uint64_t bodySize = 0;
+		HTTPHeaders::HeaderMap headers;
+		std::chrono::time_point<std::chrono::system_clock> storedTimestamp;
+		std::chrono::time_point<std::chrono::system_clock> lastAccessedTimestamp;
+		std::optional<std::chrono::seconds> maximumAge;
+
+		bool isFresh() const;
+		bool hasValidators() const;
+		std::string getETag() const;
+		std::string getLastModifiedDate() const;
+	};
+
+	HTTPCache(const std::string & directoryPath, uint64_t maximumSize = DEFAULT_MAXIMUM_SIZE);
+	~HTTPCache();
+
+	const std::string & getDirectoryPath() const;
+	uint64_t getMaximumSize() const;
+	uint64_t getSize() const;
+	size_t numberOfEntries() const;
+	bool hasEntry(const std::string & url) const;
+	std::optional<Entry> getEntry(const std::string & url);
+	std::unique_ptr<ByteBuffer> getBody(const Entry & entry) const;
+	bool store(const std::string & url, const HTTPResponse & response);
+	bool refresh(const std::string & url, const HTTPResponse & notModifiedResponse);
+	bool removeEntry(const std::string & url);
+	void clear();
+	bool load();
+	bool save();
+	bool flush(bool force = false);
+
+	static std::optional<std::chrono::seconds> getMaximumAge(const std::string & cacheControl, bool * noStore = nullptr);
+	static bool isVaryCacheable(std::string_view vary);
+
+	static const uint64_t DEFAULT_MAXIMUM_SIZE;
+	static const std::string INDEX_FILE_NAME;
+	static const std::chrono::seconds INDEX_SAVE_INTERVAL;
+
+private:
+	std::string getBodyFilePath(const std::string & bodySHA256) const;
+	bool isBodyReferenced(const std::string & bodySHA256) const;
+	void removeEntry(std::map<std::string, Entry>::iterator entryIterator);
+	void evict();
+	static rapidjson::Value entryToJSON(const Entry & entry, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator);
+	static std::optional<Entry> parseEntryFrom(const rapidjson::Value & entryValue);
+
+	std::string m_directoryPath;
+	uint64_t m_maximumSize;
+	uint64_t m_size;
+	std::map<std::string, Entry> m_entries;
+	bool m_modified;
+	std::chrono::time_point<std::chrono::steady_clock> m_lastSavedSteadyTimePoint;
+	mutable std::recursive_mutex m_mutex;
+
+	HTTPCache(const HTTPCache &) = delete;
+	const HTTPCache & operator = (const HTTPCache &) = delete;
+};
+
+#endif // _HTTP_CACHE_H_
@@ -1,9 +1,14 @@
 #ifndef _HTTP_CONFIGURATION_H_
 #define _HTTP_CONFIGURATION_H_
 
+#include "HTTPRequestSettings.h"
+
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <vector>
 
 struct HTTPConfiguration {
 	std::string certificateAuthorityCertificateStoreDirectoryPath;
@@ -12,8 +17,20 @@ struct HTTPConfiguration {
 	std::optional<std::chrono::seconds> networkTimeout;
 	std::optional<std::chrono::seconds> transferTimeout;
 	std::optional<int64_t> maximumRedirects;
+	std::optional<size_t> maximumActiveRequests;
+	std::optional<size_t> maximumActiveRequestsPerHost;
+	std::optional<HTTPRequestSettings::HTTPVersion> httpVersion;
+	bool multiplexingEnabled = true;
+	std::optional<size_t> maximumConcurrentStreams;
+	std::optional<uint8_t> maximumRetries;
+	std::optional<std::chrono::milliseconds> retryBaseDelay;
+	std::optional<std::chrono::milliseconds> retryMaximumDelay;
+	std::optional<std::vector<uint16_t>> retryableStatusCodes;
+	std::optional<bool> retryNonIdempotentRequests;
 	std::optional<std::chrono::seconds> internetConnectivityCheckInterval;
 	std::optional<std::chrono::seconds> internetConnectivityCheckTimeout;
+	std::string cacheDirectoryPath;
+	std::optional<uint64_t> maximumCacheSize;
 };
 
 #endif // _HTTP_CONFIGURATION_H_
@@ -0,0 +1,404 @@
+#include "HTTPDownloader.h"
+
+#include "HTTPService.h"
+#include "HTTPStatusCode.h"
+#include "Utilities/FileUtilities.h"
+#include "Utilities/StringUtilities.h"
+
+#include <fmt/core.h>
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <future>
+
+static const std::string BYTES_RANGE_UNIT("bytes");
+static const std::string WEAK_ETAG_PREFIX("W/");
+static const std::string EMPTY_ETAG_PLACEHOLDER("-");
+
+const std::string HTTPDownloader::PARTIAL_FILE_EXTENSION("part");
+const std::string HTTPDownloader::STATE_FILE_EXTENSION("state");
+
+bool HTTPDownloader::Segment::isCompleted() const {
+	return end.has_value() && offset >= end.value();
+}
+
+bool HTTPDownloader::downloadFile(const std::string & url, const std::string & filePath) {
+	return downloadFile(url, filePath, Options());
+}
+
+bool HTTPDownloader::downloadFile(const std::string & url, const std::string & filePath, const Options & options) {
+	if(url.empty() || filePath.empty() || options.maximumNumberOfSegments == 0 || options.maximumNumberOfAttempts == 0) {
+		return false;
+	}
+
+	if(!options.overwrite && std::filesystem::exists(std::filesystem::path(filePath))) {
+		spdlog::error("Cannot download '{}' to existing file: '{}'.", url, filePath);
+		return false;
+	}
+
+	std::optional<RemoteFileInformation> optionalRemoteFileInformation(probe(url));
+	RemoteFileInformation remoteFileInformation(optionalRemoteFileInformation.has_value() ? optionalRemoteFileInformation.value() : RemoteFileInformation());
+
+	if(options.expectedSize.has_value()) {
+		if(remoteFileInformation.size.has_value() && remoteFileInformation.size.value() != options.expectedSize.value()) {
+			spdlog::error("Remote file '{}' size {} does not match expected size: {}.", url, remoteFileInformation.size.value(), options.expectedSize.value());
+			return false;
+		}
+	}
+
+	// a known size is required to split the file into byte ranges, otherwise the file is downloaded as a single stream
+	bool segmented = remoteFileInformation.rangesSupported && remoteFileInformation.size.has_value();
+	std::string partialFilePath(fmt::format("{}.{}", filePath, PARTIAL_FILE_EXTENSION));
+	std::string stateFilePath(fmt::format("{}.{}", partialFilePath, STATE_FILE_EXTENSION));
+	std::vector<Segment> segments;
+	std::error_code errorCode;
+
+	if(segmented && options.resume && std::filesystem::is_regular_file(std::filesystem::path(partialFilePath)) && std::filesystem::file_size(std::filesystem::path(partialFilePath), errorCode) == remoteFileInformation.size.value()) {
+		if(loadState(stateFilePath, remoteFileInformation, segments)) {
+			spdlog::debug("Resuming download of '{}' to: '{}'.", url, filePath);
+		}
+	}
+
+	if(segments.empty()) {
+		segments = createSegments(remoteFileInformation, options);
+
+		Utilities::createDirectoryStructureForFilePath(partialFilePath, errorCode);
+
+		if(errorCode) {
+			spdlog::error("Failed to create download destination directory structure for file path '{}': {}", partialFilePath, errorCode.message());
+			return false;
+		}
+
+		std::ofstream partialFileStream(partialFilePath, std::ios::binary | std::ios::trunc);
+
+		if(!partialFileStream.is_open()) {
+			spdlog::error("Failed to create partial download file: '{}'.", partialFilePath);
+			return false;
+		}
+
+		partialFileStream.close();
+
+		// pre-allocate the file so that every segment can be written in place
+		if(segmented) {
+			std::filesystem::resize_file(std::filesystem::path(partialFilePath), remoteFileInformation.size.value(), errorCode);
+
+			if(errorCode) {
+				spdlog::error("Failed to allocate {} bytes for partial download file '{}': {}", remoteFileInformation.size.value(), partialFilePath, errorCode.message());
+				return false;
+			}
+		}
+	}
+
+	bool downloaded = false;
+
+	for(uint8_t attempt = 1; attempt <= options.maximumNumberOfAttempts; attempt++) {
+		if(downloadSegments(url, partialFilePath, remoteFileInformation, segments)) {
+			downloaded = true;
+			break;
+		}
+
+		if(segmented && options.resume) {
+			saveState(stateFilePath, remoteFileInformation, segments);
+		}
+
+		spdlog::warn("Download attempt #{} of '{}' failed.", attempt, url);
+	}
+
+	if(!downloaded) {
+		spdlog::error("Failed to download '{}' after {} attempt{}.", url, options.maximumNumberOfAttempts, options.maximumNumberOfAttempts == 1 ? "" : "s");
+
+		if(!segmented || !options.resume) {
+			std::filesystem::remove(std::filesystem::path(partialFilePath), errorCode);
+		}
+
+		return false;
+	}
+
+	std::filesystem::remove(std::filesystem::path(stateFilePath), errorCode);
+
+	std::optional<uint64_t> expectedSize(remoteFileInformation.size.has_value() ? remoteFileInformation.size : options.expectedSize);
+
+	if(expectedSize.has_value()) {
+		uint64_t actualSize = std::filesystem::file_size(std::filesystem::path(partialFilePath), errorCode);
+
+		if(errorCode || actualSize != expectedSize.value()) {
+			spdlog::error("Downloaded file '{}' size {} does not match expected size: {}.", partialFilePath, actualSize, expectedSize.value());
+			std::filesystem::remove(std::filesystem::path(partialFilePath), errorCode);
+			return false;
+		}
+	}
+
+	if(options.expectedHashType.has_value() && !options.expectedHash.empty()) {
+		std::string actualHash(Utilities::getFileHash(partialFilePath, options.expectedHashType.value(), options.expectedHashFormat));
+		bool hashMatches = options.expectedHashFormat == ByteBuffer::HashFormat::Hexadecimal ? Utilities::areStringsEqualIgnoreCase(actualHash, options.expectedHash) : Utilities::areStringsEqual(actualHash, options.expectedHash);
+
+		if(!hashMatches) {
+			spdlog::error("Downloaded file '{}' {} verification failed. Calculated '{}', but expected: '{}'.", url, magic_enum::enum_name(options.expectedHashType.value()), actualHash, options.expectedHash);
+			std::filesystem::remove(std::filesystem::path(partialFilePath), errorCode);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(std::filesystem::path(partialFilePath), std::filesystem::path(filePath), errorCode);
+
+	if(errorCode) {
+		spdlog::error("Failed to move downloaded file '{}' to '{}': {}", partialFilePath, filePath, errorCode.message());
+		return false;
+	}
+
+	return true;
+}
+
+std::optional<HTTPDownloader::RemoteFileInformation> HTTPDownloader::probe(const std::string & url) {
+	HTTPService * httpService = HTTPService::getInstance();
+
+	if(!httpService->isInitialized()) {
+		spdlog::error("Failed to probe '{}', HTTP service is not initialized!", url);
+		return {};
+	}
+
+	std::shared_ptr<HTTPResponse> response(httpService->sendRequestAndWait(httpService->createRequest(HTTPRequest::Method::Head, url)));
+
+	if(response == nullptr || response->isFailure() || response->isFailureStatusCode()) {
+		spdlog::warn("Failed to probe '{}', downloading without byte ranges.", url);
+		return {};
+	}
+
+	RemoteFileInformation remoteFileInformation;
+	remoteFileInformation.size = response->getContentLength();
+	remoteFileInformation.rangesSupported = Utilities::areStringsEqualIgnoreCase(Utilities::trimString(response->getHeaderValue(HTTPHeaders::ACCEPT_RANGES_HEADER_NAME)), BYTES_RANGE_UNIT);
+	remoteFileInformation.eTag = Utilities::trimString(response->getHeaderValue(HTTPHeaders::ETAG_HEADER_NAME));
+
+	return remoteFileInformation;
+}
+
+std::vector<HTTPDownloader::Segment> HTTPDownloader::createSegments(const RemoteFileInformation & remoteFileInformation, const Options & options) {
+	std::vector<Segment> segments;
+
+	if(!remoteFileInformation.rangesSupported || !remoteFileInformation.size.has_value()) {
+		segments.emplace_back();
+		segments.back().end = remoteFileInformation.size;
+
+		return segments;
+	}
+
+	uint64_t size = remoteFileInformation.size.value();
+	uint64_t numberOfSegments = std::clamp<uint64_t>(size / std::max<uint64_t>(options.minimumSegmentSize, 1), 1, options.maximumNumberOfSegments);
+	uint64_t segmentSize = size / numberOfSegments;
+
+	for(uint64_t i = 0; i < numberOfSegments; i++) {
+		segments.emplace_back();
+		segments.back().start = i * segmentSize;
+		segments.back().offset = segments.back().start;
+		segments.back().end = i == numberOfSegments - 1 ? size : (i + 1) * segmentSize;
+	}
+
+	return segments;
+}
+
+bool HTTPDownloader::loadState(const std::string & stateFilePath, const RemoteFileInformation & remoteFileInformation, std::vector<Segment> & segments) {
+	std::ifstream stateFileStream(stateFilePath);
+
+	if(!stateFileStream.is_open()) {
+		return false;
+	}
+
+	uint64_t size = 0;
+	std::string eTag;
+
+	if(!(stateFileStream >> size >> eTag) ||
+	   size != remoteFileInformation.size ||
+	   eTag != (remoteFileInformation.eTag.empty() ? EMPTY_ETAG_PLACEHOLDER : remoteFileInformation.eTag)) {
+		return false;
+	}
+
+	std::vector<Segment> loadedSegments;
+	uint64_t expectedStart = 0;
+	uint64_t start = 0;
+	uint64_t end = 0;
+	uint64_t offset = 0;
+
+	while(stateFileStream >> start >> end >> offset) {
+		if(start != expectedStart || end <= start || end > size || offset < start || offset > end) {
+			return false;
+		}
+
+		loadedSegments.emplace_back();
+		loadedSegments.back().start = start;
+		loadedSegments.back().end = end;
+		loadedSegments.back().offset = offset;
+
+		expectedStart = end;
+	}
+
+	if(loadedSegments.empty() || expectedStart != size) {
+		return false;
+	}
+
+	segments = std::move(loadedSegments);
+
+	return true;
+}
+
+bool HTTPDownloader::saveState(const std::string & stateFilePath, const RemoteFileInformation & remoteFileInformation, const std::vector<Segment> & segments) {
+	if(!remoteFileInformation.size.has_value()) {
+		return false;
+	}
+
+	std::ofstream stateFileStream(stateFilePath, std::ios::trunc);
+
+	if(!stateFileStream.is_open()) {
+		spdlog::error("Failed to open download state file for writing: '{}'.", stateFilePath);
+		return false;
+	}
+
+	// entity tags are quoted strings which cannot contain whitespace
+	stateFileStream << remoteFileInformation.size.value() << ' ' << (remoteFileInformation.eTag.empty() ? EMPTY_ETAG_PLACEHOLDER : remoteFileInformation.eTag) << '\n';
+
+	for(const Segment & segment : segments) {
+		stateFileStream << segment.start << ' ' << segment.end.value_or(segment.start) << ' ' << segment.offset << '\n';
+	}
+
+	return !stateFileStream.fail();
+}
+
+bool HTTPDownloader::downloadSegments(const std::string & url, const std::string & partialFilePath, const RemoteFileInformation & remoteFileInformation, std::vector<Segment> & segments) {
+	HTTPService * httpService = HTTPService::getInstance();
+
+	if(!httpService->isInitialized()) {
+		spdlog::error("Failed to download '{}', HTTP service is not initialized!", url);
+		return false;
+	}
+
+	std::vector<std::shared_ptr<HTTPRequest>> requests;
+	std::vector<std::future<std::shared_ptr<HTTPResponse>>> futureResponses;
+
+	for(Segment & segment : segments) {
+		if(segment.isCompleted()) {
+			continue;
+		}
+
+		// without byte range support a failed transfer has to start over from the beginning
+		bool ranged = remoteFileInformation.rangesSupported && (segment.end.has_value() || segment.offset != 0);
+
+		if(!ranged) {
+			segment.offset = segment.start;
+		}
+
+		segment.fileStream = std::make_unique<std::fstream>(partialFilePath, std::ios::binary | std::ios::in | std::ios::out | (ranged ? std::ios::openmode() : std::ios::trunc));
+
+		if(!segment.fileStream->is_open()) {
+			spdlog::error("Failed to open partial download file for writing: '{}'.", partialFilePath);
+			return false;
+		}
+
+		segment.fileStream->seekp(segment.offset);
+
+		std::shared_ptr<HTTPRequest> request(httpService->createRequest(HTTPRequest::Method::Get, url));
+
+		// bulk segment transfers should not delay interactive requests
+		request->setPriority(HTTPRequest::Priority::Low);
+
+		if(ranged) {
+			request->setHeader(HTTPHeaders::RANGE_HEADER_NAME, segment.end.has_value() ? fmt::format("{}={}-{}", BYTES_RANGE_UNIT, segment.offset, segment.end.value() - 1) : fmt::format("{}={}-", BYTES_RANGE_UNIT, segment.offset));
+
+			// the server replies with the complete file instead of the range if the file changed since it was probed
+			if(!remoteFileInformation.eTag.empty() && !Utilities::startsWith(remoteFileInformation.eTag, WEAK_ETAG_PREFIX)) {
+				request->setHeader(HTTPHeaders::IF_RANGE_HEADER_NAME, remoteFileInformation.eTag);
+			}
+		}
+
+		std::weak_ptr<HTTPRequest> weakRequest(request);
+		Segment * currentSegment = &segment;
+		uint16_t expectedStatusCode = magic_enum::enum_integer(ranged ? HTTPStatusCode::PartialContent : HTTPStatusCode::Ok);
+		std::string expectedContentRangePrefix(fmt::format("{} {}-", BYTES_RANGE_UNIT, segment.offset));
+		bool statusVerified = false;
+
+		request->setResponseBodyCallback([weakRequest, currentSegment, ranged, expectedStatusCode, expectedContentRangePrefix, statusVerified](const uint8_t * data, size_t size) mutable {
+			if(!statusVerified) {
+				std::shared_ptr<HTTPRequest> request(weakRequest.lock());
+
+				if(request == nullptr) {
+					return false;
+				}
+
+				std::shared_ptr<HTTPResponse> response(request->getResponse());
+
+				if(response->getStatusCode() != expectedStatusCode ||
+				   (ranged && !Utilities::startsWith(response->getHeaderValue(HTTPHeaders::CONTENT_RANGE_HEADER_NAME), expectedContentRangePrefix, false))) {
+					spdlog::error("Unexpected response to download of byte range starting at offset {} with status code {}.", currentSegment->offset, response->getStatusCode());
+					return false;
+				}
+
+				statusVerified = true;
+			}
+
+			if(currentSegment->end.has_value() && currentSegment->offset + size > currentSegment->end.value()) {
+				return false;
+			}
+
+			if(!currentSegment->fileStream->write(reinterpret_cast<const char *>(data), size)) {
+				return false;
+			}
+
+			currentSegment->offset += size;
+
+			return true;
+		});
+
+		std::future<std::shared_ptr<HTTPResponse>> futureResponse(httpService->sendRequest(request));
+
+		if(!futureResponse.valid()) {
+			spdlog::error("Failed to send download request for '{}'.", url);
+			segment.fileStream.reset();
+			continue;
+		}
+
+		requests.push_back(request);
+		futureResponses.push_back(std::move(futureResponse));
+	}
+
+	bool success = true;
+
+	for(size_t i = 0; i < futureResponses.size(); i++) {
+		futureResponses[i].wait();
+
+		std::shared_ptr<HTTPResponse> response(futureResponses[i].get());
+
+		if(response->isFailure()) {
+			spdlog::warn("Download request for '{}' failed with error: {}", url, response->getErrorMessage());
+			success = false;
+		}
+		else if(response->isFailureStatusCode()) {
+			std::string statusCodeName(HTTPUtilities::getStatusCodeName(response->getStatusCode()));
+			spdlog::warn("Download request for '{}' failed ({}{})!", url, response->getStatusCode(), statusCodeName.empty() ? "" : " " + statusCodeName);
+			success = false;
+		}
+	}
+
+	for(Segment & segment : segments) {
+		if(segment.fileStream == nullptr) {
+			continue;
+		}
+
+		segment.fileStream->close();
+
+		if(segment.fileStream->fail()) {
+			spdlog::error("Failed to write partial download file: '{}'.", partialFilePath);
+			success = false;
+		}
+
+		segment.fileStream.reset();
+
+		// streams of unknown length are complete once their transfer succeeds
+		if(success && !segment.end.has_value()) {
+			segment.end = segment.offset;
+		}
+	}
+
+	return success && std::all_of(segments.cbegin(), segments.cend(), [](const Segment & segment) {
+		return segment.isCompleted();
+	});
+}
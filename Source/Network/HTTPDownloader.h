@@ -0,0 +1,60 @@
+#ifndef _HTTP_DOWNLOADER_H_
+#define _HTTP_DOWNLOADER_H_
+
+#include "ByteBuffer.h"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+class HTTPDownloader final {
+public:
+	struct Options {
+		size_t maximumNumberOfSegments = 4;
+		uint64_t minimumSegmentSize = 4 * 1024 * 1024;
+		uint8_t maximumNumberOfAttempts = 3;
+		bool resume = true;
+		bool overwrite = true;
+		std::optional<uint64_t> expectedSize;
+		std::optional<ByteBuffer::HashType> expectedHashType;
+		std::string expectedHash;
+		ByteBuffer::HashFormat expectedHashFormat = ByteBuffer::DEFAULT_HASH_FORMAT;
+	};
+
+	static bool downloadFile(const std::string & url, const std::string & filePath);
+	static bool downloadFile(const std::string & url, const std::string & filePath, const Options & options);
+
+	static const std::string PARTIAL_FILE_EXTENSION;
+	static const std::string STATE_FILE_EXTENSION;
+
+private:
+	struct Segment {
+		uint64_t start = 0;
+		std::optional<uint64_t> end;
+		uint64_t offset = 0;
+		std::unique_ptr<std::fstream> fileStream;
+
+		bool isCompleted() const;
+	};
+
+	struct RemoteFileInformation {
+		std::optional<uint64_t> size;
+		bool rangesSupported = false;
+		std::string eTag;
+	};
+
+	static std::optional<RemoteFileInformation> probe(const std::string & url);
+	static std::vector<Segment> createSegments(const RemoteFileInformation & remoteFileInformation, const Options & options);
+	static bool loadState(const std::string & stateFilePath, const RemoteFileInformation & remoteFileInformation, std::vector<Segment> & segments);
+	static bool saveState(const std::string & stateFilePath, const RemoteFileInformation & remoteFileInformation, const std::vector<Segment> & segments);
+	static bool downloadSegments(const std::string & url, const std::string & partialFilePath, const RemoteFileInformation & remoteFileInformation, std::vector<Segment> & segments);
+
+	HTTPDownloader() = delete;
+	HTTPDownloader(const HTTPDownloader &) = delete;
+	const HTTPDownloader & operator = (const HTTPDownloader &) = delete;
+};
+
+#endif // _HTTP_DOWNLOADER_H_
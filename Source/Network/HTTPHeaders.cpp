@@ -1,5 +1,6 @@
 #include "HTTPHeaders.h"
 
+#include "Utilities/SIMDUtilities.h"
 #include "Utilities/StringUtilities.h"
 
 #include <fmt/core.h>
@@ -8,6 +9,7 @@ const HTTPHeaders::HeaderCase HTTPHeaders::DEFAULT_HEADER_CASE = HeaderCase::Ori
 const std::string HTTPHeaders::CONTENT_TYPE_HEADER_NAME("Content-Type");
 const std::string HTTPHeaders::CONTENT_LENGTH_HEADER_NAME("Content-Length");
 const std::string HTTPHeaders::CONTENT_ENCODING_HEADER_NAME("Content-Encoding");
+const std::string HTTPHeaders::TRANSFER_ENCODING_HEADER_NAME("Transfer-Encoding");
 const std::string HTTPHeaders::DATE_HEADER_NAME("Date");
 const std::string HTTPHeaders::LAST_MODIFIED_HEADER_NAME("Last-Modified");
 const std::string HTTPHeaders::AGE_HEADER_NAME("Age");
@@ -17,6 +19,15 @@ const std::string HTTPHeaders::AUTHORIZATION_HEADER_NAME("Authorization");
 const std::string HTTPHeaders::ETAG_HEADER_NAME("ETag");
 const std::string HTTPHeaders::IF_NONE_MATCH_HEADER_NAME("If-None-Match");
 const std::string HTTPHeaders::IF_MATCH_HEADER_NAME("If-Match");
+const std::string HTTPHeaders::IF_RANGE_HEADER_NAME("If-Range");
+const std::string HTTPHeaders::IF_MODIFIED_SINCE_HEADER_NAME("If-Modified-Since");
+const std::string HTTPHeaders::CACHE_CONTROL_HEADER_NAME("Cache-Control");
+const std::string HTTPHeaders::RETRY_AFTER_HEADER_NAME("Retry-After");
+const std::string HTTPHeaders::RANGE_HEADER_NAME("Range");
+const std::string HTTPHeaders::CONTENT_RANGE_HEADER_NAME("Content-Range");
+const std::string HTTPHeaders::ACCEPT_RANGES_HEADER_NAME("Accept-Ranges");
+const std::string HTTPHeaders::ACCEPT_ENCODING_HEADER_NAME("Accept-Encoding");
+const std::string HTTPHeaders::VARY_HEADER_NAME("Vary");
 const std::string HTTPHeaders::APPLICATION_JSON_CONTENT_TYPE("application/json");
 const std::string HTTPHeaders::APPLICATION_XML_CONTENT_TYPE("application/xml");
 const std::string HTTPHeaders::TEXT_XML_CONTENT_TYPE("application/xml");
@@ -354,7 +365,14 @@ std::string HTTPHeaders::extractETagValue(const std::string & rawETag) {
 std::string HTTPHeaders::createBasicAuthenticationToken(const std::string & userName, const std::string & password) {
 	static constexpr const char * BASIC_AUTHORIZATION_PREFIX = "Basic ";
 
-	return BASIC_AUTHORIZATION_PREFIX + ByteBuffer(userName + ": " + password).toBase64();
+	std::string credentials(userName + ":" + password);
+	std::string token(BASIC_AUTHORIZATION_PREFIX);
+	size_t prefixLength = token.length();
+
+	token.resize(prefixLength + Utilities::getBase64EncodedLength(credentials.length()));
+	Utilities::encodeBase64(std::span<const uint8_t>(reinterpret_cast<const uint8_t *>(credentials.data()), credentials.length()), std::span<char>(token).subspan(prefixLength));
+
+	return token;
 }
 
 bool HTTPHeaders::operator == (const HTTPHeaders & headers) const {
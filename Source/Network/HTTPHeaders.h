@@ -73,6 +73,7 @@ public:
 	static const std::string CONTENT_TYPE_HEADER_NAME;
 	static const std::string CONTENT_LENGTH_HEADER_NAME;
 	static const std::string CONTENT_ENCODING_HEADER_NAME;
+	static const std::string TRANSFER_ENCODING_HEADER_NAME;
 	static const std::string DATE_HEADER_NAME;
 	static const std::string LAST_MODIFIED_HEADER_NAME;
 	static const std::string AGE_HEADER_NAME;
@@ -82,6 +83,15 @@ public:
 	static const std::string ETAG_HEADER_NAME;
 	static const std::string IF_NONE_MATCH_HEADER_NAME;
 	static const std::string IF_MATCH_HEADER_NAME;
+	static const std::string IF_RANGE_HEADER_NAME;
+	static const std::string IF_MODIFIED_SINCE_HEADER_NAME;
+	static const std::string CACHE_CONTROL_HEADER_NAME;
+	static const std::string RETRY_AFTER_HEADER_NAME;
+	static const std::string RANGE_HEADER_NAME;
+	static const std::string CONTENT_RANGE_HEADER_NAME;
+	static const std::string ACCEPT_RANGES_HEADER_NAME;
+	static const std::string ACCEPT_ENCODING_HEADER_NAME;
+	static const std::string VARY_HEADER_NAME;
 	static const std::string APPLICATION_JSON_CONTENT_TYPE;
 	static const std::string APPLICATION_XML_CONTENT_TYPE;
 	static const std::string TEXT_XML_CONTENT_TYPE;
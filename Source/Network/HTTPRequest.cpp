@@ -10,7 +10,10 @@
 #include <magic_enum/magic_enum.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <filesystem>
 #include <optional>
 #include <sstream>
 
@@ -23,14 +26,38 @@ HTTPRequest::HTTPRequest(HTTPRequest::Method method, const std::string & url, HT
 	, HTTPRequestSettings()
 	, m_method(method)
 	, m_url(Utilities::trimString(url))
-	, m_acceptedEncodingTypes(DEFAULT_ACCEPTED_ENCODING_TYPES) { }
+	, m_priority(DEFAULT_PRIORITY)
+	, m_acceptedEncodingTypes(DEFAULT_ACCEPTED_ENCODING_TYPES)
+	, m_bodyViewData(nullptr)
+	, m_bodyViewSize(0)
+	, m_bodyOffset(0)
+	, m_compressedBodyDataOffset(0)
+	, m_numberOfAttempts(0) { }
 
 HTTPRequest::HTTPRequest(HTTPRequest && request) noexcept
 	: HTTPTransfer(std::move(request))
 	, HTTPRequestSettings(std::move(request))
 	, m_method(request.m_method)
 	, m_url(std::move(request.m_url))
+	, m_priority(request.m_priority)
 	, m_acceptedEncodingTypes(request.m_acceptedEncodingTypes)
+	, m_bodyFilePath(std::move(request.m_bodyFilePath))
+	, m_bodyCallback(std::move(request.m_bodyCallback))
+	, m_bodyCallbackSize(request.m_bodyCallbackSize)
+	, m_bodyViewData(request.m_bodyViewData)
+	, m_bodyViewSize(request.m_bodyViewSize)
+	, m_bodyCompressionMethod(request.m_bodyCompressionMethod)
+	, m_bodyFileStream(std::move(request.m_bodyFileStream))
+	, m_bodyOffset(request.m_bodyOffset)
+	, m_bodyCompressionStream(std::move(request.m_bodyCompressionStream))
+	, m_bodyReadBuffer(std::move(request.m_bodyReadBuffer))
+	, m_compressedBodyData(std::move(request.m_compressedBodyData))
+	, m_compressedBodyDataOffset(request.m_compressedBodyDataOffset)
+	, m_responseBodyFilePath(std::move(request.m_responseBodyFilePath))
+	, m_responseBodyCallback(std::move(request.m_responseBodyCallback))
+	, m_responseBodyHashTypes(std::move(request.m_responseBodyHashTypes))
+	, m_cacheKey(std::move(request.m_cacheKey))
+	, m_numberOfAttempts(request.m_numberOfAttempts)
 	, m_requestInitiatedSystemTimePoint(request.m_requestInitiatedSystemTimePoint)
 	, m_requestInitiatedSteadyTimePoint(request.m_requestInitiatedSteadyTimePoint)
 	, m_transferStartedSystemTimePoint(request.m_transferStartedSystemTimePoint)
@@ -44,7 +71,21 @@ HTTPRequest::HTTPRequest(const HTTPRequest & request)
 	, HTTPRequestSettings(request)
 	, m_method(request.m_method)
 	, m_url(request.m_url)
+	, m_priority(request.m_priority)
 	, m_acceptedEncodingTypes(request.m_acceptedEncodingTypes)
+	, m_bodyFilePath(request.m_bodyFilePath)
+	, m_bodyCallback(request.m_bodyCallback)
+	, m_bodyCallbackSize(request.m_bodyCallbackSize)
+	, m_bodyViewData(request.m_bodyViewData)
+	, m_bodyViewSize(request.m_bodyViewSize)
+	, m_bodyCompressionMethod(request.m_bodyCompressionMethod)
+	, m_bodyOffset(0)
+	, m_compressedBodyDataOffset(0)
+	, m_responseBodyFilePath(request.m_responseBodyFilePath)
+	, m_responseBodyCallback(request.m_responseBodyCallback)
+	, m_responseBodyHashTypes(request.m_responseBodyHashTypes)
+	, m_cacheKey(request.m_cacheKey)
+	, m_numberOfAttempts(request.m_numberOfAttempts)
 	, m_requestInitiatedSystemTimePoint(request.m_requestInitiatedSystemTimePoint)
 	, m_requestInitiatedSteadyTimePoint(request.m_requestInitiatedSteadyTimePoint)
 	, m_transferStartedSystemTimePoint(request.m_transferStartedSystemTimePoint)
@@ -62,7 +103,25 @@ HTTPRequest & HTTPRequest::operator = (HTTPRequest && request) noexcept {
 
 		m_method = request.m_method;
 		m_url = std::move(request.m_url);
+		m_priority = request.m_priority;
 		m_acceptedEncodingTypes = request.m_acceptedEncodingTypes;
+		m_bodyFilePath = std::move(request.m_bodyFilePath);
+		m_bodyCallback = std::move(request.m_bodyCallback);
+		m_bodyCallbackSize = request.m_bodyCallbackSize;
+		m_bodyViewData = request.m_bodyViewData;
+		m_bodyViewSize = request.m_bodyViewSize;
+		m_bodyCompressionMethod = request.m_bodyCompressionMethod;
+		m_bodyFileStream = std::move(request.m_bodyFileStream);
+		m_bodyOffset = request.m_bodyOffset;
+		m_bodyCompressionStream = std::move(request.m_bodyCompressionStream);
+		m_bodyReadBuffer = std::move(request.m_bodyReadBuffer);
+		m_compressedBodyData = std::move(request.m_compressedBodyData);
+		m_compressedBodyDataOffset = request.m_compressedBodyDataOffset;
+		m_responseBodyFilePath = std::move(request.m_responseBodyFilePath);
+		m_responseBodyCallback = std::move(request.m_responseBodyCallback);
+		m_responseBodyHashTypes = std::move(request.m_responseBodyHashTypes);
+		m_cacheKey = std::move(request.m_cacheKey);
+		m_numberOfAttempts = request.m_numberOfAttempts;
 		m_requestInitiatedSystemTimePoint = request.m_requestInitiatedSystemTimePoint;
 		m_requestInitiatedSteadyTimePoint = request.m_requestInitiatedSteadyTimePoint;
 		m_transferStartedSystemTimePoint = request.m_transferStartedSystemTimePoint;
@@ -84,7 +143,20 @@ HTTPRequest & HTTPRequest::operator = (const HTTPRequest & request) {
 
 	m_method = request.m_method;
 	m_url = request.m_url;
+	m_priority = request.m_priority;
 	m_acceptedEncodingTypes = request.m_acceptedEncodingTypes;
+	m_bodyFilePath = request.m_bodyFilePath;
+	m_bodyCallback = request.m_bodyCallback;
+	m_bodyCallbackSize = request.m_bodyCallbackSize;
+	m_bodyViewData = request.m_bodyViewData;
+	m_bodyViewSize = request.m_bodyViewSize;
+	m_bodyCompressionMethod = request.m_bodyCompressionMethod;
+	closeBody();
+	m_responseBodyFilePath = request.m_responseBodyFilePath;
+	m_responseBodyCallback = request.m_responseBodyCallback;
+	m_responseBodyHashTypes = request.m_responseBodyHashTypes;
+	m_cacheKey = request.m_cacheKey;
+	m_numberOfAttempts = request.m_numberOfAttempts;
 	m_requestInitiatedSystemTimePoint = request.m_requestInitiatedSystemTimePoint;
 	m_requestInitiatedSteadyTimePoint = request.m_requestInitiatedSteadyTimePoint;
 	m_transferStartedSystemTimePoint = request.m_transferStartedSystemTimePoint;
@@ -129,6 +201,36 @@ void HTTPRequest::setUrl(const std::string & url) {
 	m_url = Utilities::trimString(url);
 }
 
+HTTPRequest::Priority HTTPRequest::getPriority() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_priority;
+}
+
+bool HTTPRequest::setPriority(Priority priority) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	m_priority = priority;
+
+	return true;
+}
+
+bool HTTPRequest::isIdempotent() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_method != Method::Post && m_method != Method::Patch;
+}
+
+uint8_t HTTPRequest::getNumberOfAttempts() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_numberOfAttempts;
+}
+
 bool HTTPRequest::hasAnyAcceptedEncodingTypes() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -257,6 +359,245 @@ bool HTTPRequest::clearIfMatchETag() {
 	return removeHeader(HTTPHeaders::IF_MATCH_HEADER_NAME);
 }
 
+bool HTTPRequest::isBodyStreamed() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return !m_bodyFilePath.empty() || m_bodyCallback != nullptr || m_bodyViewData != nullptr || m_bodyCompressionMethod.has_value();
+}
+
+bool HTTPRequest::isBodyReplayable() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_bodyCallback == nullptr;
+}
+
+bool HTTPRequest::hasBodyFilePath() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return !m_bodyFilePath.empty();
+}
+
+const std::string & HTTPRequest::getBodyFilePath() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_bodyFilePath;
+}
+
+bool HTTPRequest::setBodyFilePath(const std::string & filePath) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!clearBodySource()) {
+		return false;
+	}
+
+	m_bodyFilePath = Utilities::trimString(filePath);
+
+	return true;
+}
+
+bool HTTPRequest::hasBodyCallback() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_bodyCallback != nullptr;
+}
+
+bool HTTPRequest::setBodyCallback(BodyCallback callback, std::optional<uint64_t> size) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!clearBodySource()) {
+		return false;
+	}
+
+	m_bodyCallback = callback;
+	m_bodyCallbackSize = size;
+
+	return true;
+}
+
+bool HTTPRequest::hasBodyView() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_bodyViewData != nullptr;
+}
+
+bool HTTPRequest::setBodyView(const uint8_t * data, size_t size) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(data == nullptr && size != 0) {
+		return false;
+	}
+
+	if(!clearBodySource()) {
+		return false;
+	}
+
+	m_bodyViewData = data;
+	m_bodyViewSize = data == nullptr ? 0 : size;
+
+	return true;
+}
+
+bool HTTPRequest::clearBodySource() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	m_bodyFilePath.clear();
+	m_bodyCallback = nullptr;
+	m_bodyCallbackSize.reset();
+	m_bodyViewData = nullptr;
+	m_bodyViewSize = 0;
+
+	return true;
+}
+
+bool HTTPRequest::hasBodyCompressionMethod() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_bodyCompressionMethod.has_value();
+}
+
+std::optional<ByteBuffer::CompressionMethod> HTTPRequest::getBodyCompressionMethod() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_bodyCompressionMethod;
+}
+
+bool HTTPRequest::setBodyCompressionMethod(ByteBuffer::CompressionMethod compressionMethod) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	if(getContentEncodingName(compressionMethod).empty()) {
+		spdlog::error("Unsupported HTTP request #{} body compression method '{}'.", m_id, magic_enum::enum_name(compressionMethod));
+		return false;
+	}
+
+	m_bodyCompressionMethod = compressionMethod;
+
+	return true;
+}
+
+bool HTTPRequest::clearBodyCompressionMethod() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	m_bodyCompressionMethod.reset();
+
+	return true;
+}
+
+bool HTTPRequest::isResponseBodyBuffered() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_responseBodyFilePath.empty() && !m_responseBodyCallback;
+}
+
+bool HTTPRequest::hasResponseBodyFilePath() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return !m_responseBodyFilePath.empty();
+}
+
+const std::string & HTTPRequest::getResponseBodyFilePath() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_responseBodyFilePath;
+}
+
+bool HTTPRequest::setResponseBodyFilePath(const std::string & filePath) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	m_responseBodyFilePath = Utilities::trimString(filePath);
+
+	return true;
+}
+
+bool HTTPRequest::clearResponseBodyFilePath() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return setResponseBodyFilePath({});
+}
+
+bool HTTPRequest::hasResponseBodyCallback() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_responseBodyCallback != nullptr;
+}
+
+const HTTPRequest::ResponseBodyCallback & HTTPRequest::getResponseBodyCallback() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_responseBodyCallback;
+}
+
+bool HTTPRequest::setResponseBodyCallback(ResponseBodyCallback callback) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	m_responseBodyCallback = std::move(callback);
+
+	return true;
+}
+
+bool HTTPRequest::clearResponseBodyCallback() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return setResponseBodyCallback(nullptr);
+}
+
+bool HTTPRequest::hasResponseBodyHashTypes() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return !m_responseBodyHashTypes.empty();
+}
+
+const std::vector<ByteBuffer::HashType> & HTTPRequest::getResponseBodyHashTypes() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_responseBodyHashTypes;
+}
+
+bool HTTPRequest::addResponseBodyHashType(ByteBuffer::HashType hashType) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	if(std::find(m_responseBodyHashTypes.cbegin(), m_responseBodyHashTypes.cend(), hashType) == m_responseBodyHashTypes.cend()) {
+		m_responseBodyHashTypes.push_back(hashType);
+	}
+
+	return true;
+}
+
+bool HTTPRequest::clearResponseBodyHashTypes() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly) {
+		return false;
+	}
+
+	m_responseBodyHashTypes.clear();
+
+	return true;
+}
+
 bool HTTPRequest::isRequestInitiated() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -316,6 +657,24 @@ bool HTTPRequest::setResponse(std::shared_ptr<HTTPResponse> response) {
 	return true;
 }
 
+std::string HTTPRequest::getFormattedURL(const HTTPConfiguration & configuration) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::string formattedURL;
+
+	if(!configuration.baseURL.empty() &&
+	   !(m_url.find("http://") == 0 || m_url.find("https://") == 0)) {
+		formattedURL = Utilities::joinPaths(configuration.baseURL, m_url);
+	}
+	else {
+		formattedURL = m_url;
+	}
+
+	formattedURL += m_queryParameters.toString();
+
+	return Utilities::replaceAll(formattedURL, " ", "%20");
+}
+
 bool HTTPRequest::hasQueryParameters() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -464,6 +823,16 @@ bool HTTPRequest::isCompleted() const {
 	return m_response->isCompleted();
 }
 
+bool HTTPRequest::isRetrying() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_response == nullptr) {
+		return false;
+	}
+
+	return m_response->isRetrying();
+}
+
 bool HTTPRequest::isAborted() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -654,7 +1023,7 @@ const std::string & HTTPRequest::getErrorMessage() const {
 	return m_response->getErrorMessage();
 }
 
-bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUtilities::CURLMultiHandle & curlMultiHandle) {
+bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUtilities::CURLEasyHandle curlEasyHandle, HTTPUtilities::CURLSharedHandle & curlSharedHandle, HTTPUtilities::CURLMultiHandle & curlMultiHandle) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
 	static const std::array<std::string, 1> IGNORED_HEADERS = {
@@ -665,7 +1034,14 @@ bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUti
 		return false;
 	}
 
-	m_curlEasyHandle = HTTPUtilities::createCURLEasyHandle();
+	m_curlEasyHandle = curlEasyHandle != nullptr ? std::move(curlEasyHandle) : HTTPUtilities::createCURLEasyHandle();
+
+	// attach the shared DNS, SSL session and connection caches
+	if(curlSharedHandle != nullptr) {
+		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_SHARE, curlSharedHandle.get()), fmt::format("Failed to set cURL share handle on request #{}.", m_id))) {
+			return false;
+		}
+	}
 
 	HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_DEBUGDATA, this), fmt::format("Failed to set cURL debug data on request #{}.", m_id));
 
@@ -738,21 +1114,50 @@ bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUti
 	}
 
 	// set request URL
-	std::string formattedURL;
+	std::string formattedURL(getFormattedURL(configuration));
 
-	if(!configuration.baseURL.empty() &&
-	   !(m_url.find("http://") == 0 || m_url.find("https://") == 0)) {
-		formattedURL = Utilities::joinPaths(configuration.baseURL, m_url);
+	if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_URL, formattedURL.c_str()), fmt::format("Failed to set cURL request #{} URL to '{}'.", m_id, m_url))) {
+		return false;
 	}
-	else {
-		formattedURL = m_url;
+
+	// set request protocol version, cURL falls back to HTTP/1.1 when the server does not negotiate HTTP/2
+	std::optional<long> curlHTTPVersion;
+
+	switch(m_httpVersion) {
+		case HTTPVersion::Default: {
+			break;
+		}
+
+		case HTTPVersion::HTTP1_1: {
+			curlHTTPVersion = CURL_HTTP_VERSION_1_1;
+			break;
+		}
+
+		case HTTPVersion::HTTP2: {
+			curlHTTPVersion = CURL_HTTP_VERSION_2_0;
+			break;
+		}
+
+		case HTTPVersion::HTTP2TLS: {
+			curlHTTPVersion = CURL_HTTP_VERSION_2TLS;
+			break;
+		}
+
+		case HTTPVersion::HTTP2PriorKnowledge: {
+			curlHTTPVersion = CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE;
+			break;
+		}
 	}
 
-	formattedURL += m_queryParameters.toString();
-	formattedURL = Utilities::replaceAll(formattedURL, " ", "%20");
+	if(curlHTTPVersion.has_value()) {
+		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_HTTP_VERSION, curlHTTPVersion.value()), fmt::format("Failed to set cURL request #{} HTTP version to '{}'.", m_id, magic_enum::enum_name(m_httpVersion)))) {
+			return false;
+		}
+	}
 
-	if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_URL, formattedURL.c_str()), fmt::format("Failed to set cURL request #{} URL to '{}'.", m_id, m_url))) {
-		return false;
+	// wait for a connection which can be multiplexed instead of opening a new one while it is still being established
+	if(configuration.multiplexingEnabled && m_httpVersion != HTTPVersion::HTTP1_1) {
+		HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_PIPEWAIT, 1L), fmt::format("Failed to enable cURL pipe wait on request #{}.", m_id));
 	}
 
 	// set request user agent
@@ -763,7 +1168,65 @@ bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUti
 	}
 
 	// set request body
-	if(hasBody) {
+	std::vector<std::string> additionalHeaders;
+
+	if(hasBody && isBodyStreamed()) {
+		if(!openBody()) {
+			return false;
+		}
+
+		// the compressed size is not known until the body has been fully read
+		std::optional<uint64_t> optionalBodySize;
+
+		if(!m_bodyCompressionMethod.has_value()) {
+			optionalBodySize = getBodySourceSize();
+		}
+
+		if(m_method == Method::Post) {
+			if(optionalBodySize.has_value()) {
+				if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(optionalBodySize.value())), fmt::format("Failed to set cURL request #{} body size to {}.", m_id, optionalBodySize.value()))) {
+					return false;
+				}
+			}
+			else {
+				additionalHeaders.push_back(fmt::format("{}: chunked", HTTPHeaders::TRANSFER_ENCODING_HEADER_NAME));
+			}
+		}
+		else {
+			// custom request methods take precedence over the upload method
+			if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_UPLOAD, 1L), fmt::format("Failed to enable cURL upload mode on request #{}.", m_id))) {
+				return false;
+			}
+
+			if(optionalBodySize.has_value()) {
+				if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_INFILESIZE_LARGE, static_cast<curl_off_t>(optionalBodySize.value())), fmt::format("Failed to set cURL request #{} body size to {}.", m_id, optionalBodySize.value()))) {
+					return false;
+				}
+			}
+		}
+
+		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_READFUNCTION, HTTPRequest::readData), fmt::format("Failed to set read function for cURL request #{}.", m_id))) {
+			return false;
+		}
+
+		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_READDATA, static_cast<void *>(this)), fmt::format("Failed to set read function context for cURL request #{}.", m_id))) {
+			return false;
+		}
+
+		// allows cURL to rewind the body when it needs to re-send it, for example after a re-direct or authentication challenge
+		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_SEEKFUNCTION, HTTPRequest::seekData), fmt::format("Failed to set seek function for cURL request #{}.", m_id))) {
+			return false;
+		}
+
+		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_SEEKDATA, static_cast<void *>(this)), fmt::format("Failed to set seek function context for cURL request #{}.", m_id))) {
+			return false;
+		}
+
+		if(m_bodyCompressionMethod.has_value() && !hasHeader(HTTPHeaders::CONTENT_ENCODING_HEADER_NAME)) {
+			additionalHeaders.push_back(fmt::format("{}: {}", HTTPHeaders::CONTENT_ENCODING_HEADER_NAME, getContentEncodingName(m_bodyCompressionMethod.value())));
+		}
+	}
+	else if(hasBody) {
 		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_POSTFIELDSIZE, m_body->getSize()), fmt::format("Failed to set cURL request #{} body size to {}.", m_id, m_body->getSize()))) {
 			return false;
 		}
@@ -774,7 +1237,7 @@ bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUti
 	}
 
 	// set request headers
-	if(hasHeaders()) {
+	if(hasHeaders() || !additionalHeaders.empty()) {
 		m_rawHTTPHeaderList = HTTPUtilities::createCURLStringList();
 
 		for(HTTPHeaders::HeaderMap::const_iterator i = m_headers.begin(); i != m_headers.end(); ++i) {
@@ -799,6 +1262,13 @@ bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUti
 			}
 		}
 
+		for(const std::string & additionalHeader : additionalHeaders) {
+			if(!HTTPUtilities::appendToCURLStringList(m_rawHTTPHeaderList, additionalHeader)) {
+				spdlog::error("Failed to append header '{}' to cURL string list for cURL request #{}.", additionalHeader, m_id);
+				return false;
+			}
+		}
+
 		if(!HTTPUtilities::isSuccess(curl_easy_setopt(m_curlEasyHandle.get(), CURLOPT_HTTPHEADER, m_rawHTTPHeaderList.get()), fmt::format("Failed to set cURL request #{} headers.", m_id))) {
 			return false;
 		}
@@ -876,10 +1346,245 @@ bool HTTPRequest::startTransfer(const HTTPConfiguration & configuration, HTTPUti
 
 	m_transferStartedSystemTimePoint = std::chrono::system_clock::now();
 	m_transferStartedSteadyTimePoint = std::chrono::steady_clock::now();
+	m_numberOfAttempts++;
+
+	return true;
+}
+
+bool HTTPRequest::resetTransfer() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_transferStartedSystemTimePoint.has_value()) {
+		return false;
+	}
+
+	m_transferStartedSystemTimePoint.reset();
+	m_transferStartedSteadyTimePoint.reset();
+	m_rawHTTPHeaderList.reset();
+	closeBody();
 
 	return true;
 }
 
+bool HTTPRequest::openBody() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	closeBody();
+
+	if(!m_bodyFilePath.empty()) {
+		m_bodyFileStream = std::make_unique<std::ifstream>(m_bodyFilePath, std::ios::binary);
+
+		if(!m_bodyFileStream->is_open()) {
+			spdlog::error("Failed to open request #{} body file: '{}'.", m_id, m_bodyFilePath);
+			m_bodyFileStream.reset();
+			return false;
+		}
+	}
+
+	if(m_bodyCompressionMethod.has_value()) {
+		m_bodyCompressionStream = CompressionStream::createCompressionStream(m_bodyCompressionMethod.value(), [this](const uint8_t * data, size_t size) {
+			m_compressedBodyData.insert(m_compressedBodyData.end(), data, data + size);
+
+			return true;
+		});
+
+		if(m_bodyCompressionStream == nullptr) {
+			spdlog::error("Failed to create request #{} body '{}' compression stream.", m_id, magic_enum::enum_name(m_bodyCompressionMethod.value()));
+			closeBody();
+			return false;
+		}
+
+		m_bodyReadBuffer.resize(CompressionStream::DEFAULT_CHUNK_SIZE);
+	}
+
+	return true;
+}
+
+void HTTPRequest::closeBody() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	m_bodyFileStream.reset();
+	m_bodyOffset = 0;
+	m_bodyCompressionStream.reset();
+	m_bodyReadBuffer.clear();
+	m_bodyReadBuffer.shrink_to_fit();
+	m_compressedBodyData.clear();
+	m_compressedBodyData.shrink_to_fit();
+	m_compressedBodyDataOffset = 0;
+}
+
+std::optional<uint64_t> HTTPRequest::getBodySourceSize() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_bodyFilePath.empty()) {
+		std::error_code errorCode;
+		uint64_t fileSize = std::filesystem::file_size(std::filesystem::path(m_bodyFilePath), errorCode);
+
+		if(errorCode) {
+			return {};
+		}
+
+		return fileSize;
+	}
+
+	if(m_bodyCallback != nullptr) {
+		return m_bodyCallbackSize;
+	}
+
+	if(m_bodyViewData != nullptr) {
+		return m_bodyViewSize;
+	}
+
+	return m_body->getSize();
+}
+
+std::optional<size_t> HTTPRequest::readBodySource(uint8_t * data, size_t size) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	size_t numberOfBytesRead = 0;
+
+	if(m_bodyFileStream != nullptr) {
+		m_bodyFileStream->read(reinterpret_cast<char *>(data), size);
+
+		if(m_bodyFileStream->bad()) {
+			spdlog::error("Failed to read request #{} body file: '{}'.", m_id, m_bodyFilePath);
+			return {};
+		}
+
+		numberOfBytesRead = static_cast<size_t>(m_bodyFileStream->gcount());
+	}
+	else if(m_bodyCallback != nullptr) {
+		std::optional<size_t> optionalNumberOfBytesRead(m_bodyCallback(data, size));
+
+		if(!optionalNumberOfBytesRead.has_value() || optionalNumberOfBytesRead.value() > size) {
+			spdlog::error("Request #{} body callback failed to provide data.", m_id);
+			return {};
+		}
+
+		numberOfBytesRead = optionalNumberOfBytesRead.value();
+	}
+	else {
+		const uint8_t * sourceData = m_bodyViewData != nullptr ? m_bodyViewData : m_body->getRawData();
+		size_t sourceSize = m_bodyViewData != nullptr ? m_bodyViewSize : m_body->getSize();
+
+		numberOfBytesRead = std::min(size, static_cast<size_t>(sourceSize - m_bodyOffset));
+
+		if(numberOfBytesRead != 0) {
+			std::memcpy(data, sourceData + m_bodyOffset, numberOfBytesRead);
+		}
+	}
+
+	m_bodyOffset += numberOfBytesRead;
+
+	return numberOfBytesRead;
+}
+
+std::optional<size_t> HTTPRequest::readBody(uint8_t * data, size_t size) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_bodyCompressionStream == nullptr) {
+		return readBodySource(data, size);
+	}
+
+	// pull from the source until the compressor produces output or the stream ends
+	while(m_compressedBodyDataOffset == m_compressedBodyData.size()) {
+		m_compressedBodyData.clear();
+		m_compressedBodyDataOffset = 0;
+
+		if(m_bodyCompressionStream->isFinished()) {
+			return 0;
+		}
+
+		std::optional<size_t> optionalNumberOfBytesRead(readBodySource(m_bodyReadBuffer.data(), m_bodyReadBuffer.size()));
+
+		if(!optionalNumberOfBytesRead.has_value()) {
+			return {};
+		}
+
+		if(optionalNumberOfBytesRead.value() == 0) {
+			if(!m_bodyCompressionStream->finish()) {
+				return {};
+			}
+		}
+		else if(!m_bodyCompressionStream->write(m_bodyReadBuffer.data(), optionalNumberOfBytesRead.value())) {
+			return {};
+		}
+	}
+
+	size_t numberOfBytesRead = std::min(size, m_compressedBodyData.size() - m_compressedBodyDataOffset);
+
+	std::memcpy(data, m_compressedBodyData.data() + m_compressedBodyDataOffset, numberOfBytesRead);
+	m_compressedBodyDataOffset += numberOfBytesRead;
+
+	return numberOfBytesRead;
+}
+
+bool HTTPRequest::seekBody(uint64_t offset) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	// compressed and generated bodies can only be read forwards
+	if(m_bodyCompressionStream != nullptr || m_bodyCallback != nullptr) {
+		return false;
+	}
+
+	if(m_bodyFileStream != nullptr) {
+		m_bodyFileStream->clear();
+		m_bodyFileStream->seekg(static_cast<std::streamoff>(offset));
+
+		if(m_bodyFileStream->fail()) {
+			return false;
+		}
+	}
+	else if(offset > (m_bodyViewData != nullptr ? m_bodyViewSize : m_body->getSize())) {
+		return false;
+	}
+
+	m_bodyOffset = offset;
+
+	return true;
+}
+
+std::string HTTPRequest::getContentEncodingName(ByteBuffer::CompressionMethod compressionMethod) {
+	switch(compressionMethod) {
+		case ByteBuffer::CompressionMethod::ZLib:
+			return "deflate";
+
+		case ByteBuffer::CompressionMethod::ZStandard:
+			return "zstd";
+
+		default:
+			break;
+	}
+
+	return {};
+}
+
+size_t HTTPRequest::readData(char * data, size_t size, size_t numberOfItems, void * context) {
+	if(context == nullptr) {
+		return CURL_READFUNC_ABORT;
+	}
+
+	HTTPRequest * request = reinterpret_cast<HTTPRequest *>(context);
+
+	std::optional<size_t> optionalNumberOfBytesRead(request->readBody(reinterpret_cast<uint8_t *>(data), size * numberOfItems));
+
+	if(!optionalNumberOfBytesRead.has_value()) {
+		return CURL_READFUNC_ABORT;
+	}
+
+	return optionalNumberOfBytesRead.value();
+}
+
+int HTTPRequest::seekData(void * context, curl_off_t offset, int origin) {
+	if(context == nullptr || origin != SEEK_SET || offset < 0) {
+		return CURL_SEEKFUNC_CANTSEEK;
+	}
+
+	HTTPRequest * request = reinterpret_cast<HTTPRequest *>(context);
+
+	return request->seekBody(static_cast<uint64_t>(offset)) ? CURL_SEEKFUNC_OK : CURL_SEEKFUNC_CANTSEEK;
+}
+
 int HTTPRequest::debugCallback(CURL * handle, curl_infotype type, char * data, size_t size, void * userData) {
 	if(userData == nullptr) {
 		return 0;
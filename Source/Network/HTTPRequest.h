@@ -2,6 +2,7 @@
 #define _HTTP_REQUEST_H_
 
 #include "BitmaskOperators.h"
+#include "Compression/CompressionStream.h"
 #include "HTTPConfiguration.h"
 #include "HTTPQueryParameters.h"
 #include "HTTPResponse.h"
@@ -10,9 +11,12 @@
 #include "HTTPUtilities.h"
 
 #include <chrono>
+#include <fstream>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 class HTTPService;
 
@@ -32,6 +36,15 @@ public:
 		Delete
 	};
 
+	enum class Priority : uint8_t {
+		Low,
+		Normal,
+		High
+	};
+
+	using BodyCallback = std::function<std::optional<size_t> (uint8_t * /* data */, size_t /* size */)>;
+	using ResponseBodyCallback = std::function<bool (const uint8_t * /* data */, size_t /* size */)>;
+
 	enum class EncodingTypes : uint8_t {
 		Disabled = 0,
 		Identity = 1,
@@ -52,6 +65,10 @@ public:
 	void setMethod(Method method);
 	const std::string & getUrl() const;
 	void setUrl(const std::string & url);
+	Priority getPriority() const;
+	bool setPriority(Priority priority);
+	bool isIdempotent() const;
+	uint8_t getNumberOfAttempts() const;
 	bool hasAnyAcceptedEncodingTypes() const;
 	EncodingTypes getAcceptedEncodingTypes() const;
 	std::string getAcceptedEncodingTypesAsString() const;
@@ -66,6 +83,33 @@ public:
 	std::string getIfMatchETag() const;
 	bool setIfMatchETag(const std::string & eTag);
 	bool clearIfMatchETag();
+	bool isBodyStreamed() const;
+	bool isBodyReplayable() const;
+	bool hasBodyFilePath() const;
+	const std::string & getBodyFilePath() const;
+	bool setBodyFilePath(const std::string & filePath);
+	bool hasBodyCallback() const;
+	bool setBodyCallback(BodyCallback callback, std::optional<uint64_t> size = {});
+	bool hasBodyView() const;
+	bool setBodyView(const uint8_t * data, size_t size);
+	bool clearBodySource();
+	bool hasBodyCompressionMethod() const;
+	std::optional<ByteBuffer::CompressionMethod> getBodyCompressionMethod() const;
+	bool setBodyCompressionMethod(ByteBuffer::CompressionMethod compressionMethod);
+	bool clearBodyCompressionMethod();
+	bool isResponseBodyBuffered() const;
+	bool hasResponseBodyFilePath() const;
+	const std::string & getResponseBodyFilePath() const;
+	bool setResponseBodyFilePath(const std::string & filePath);
+	bool clearResponseBodyFilePath();
+	bool hasResponseBodyCallback() const;
+	const ResponseBodyCallback & getResponseBodyCallback() const;
+	bool setResponseBodyCallback(ResponseBodyCallback callback);
+	bool clearResponseBodyCallback();
+	bool hasResponseBodyHashTypes() const;
+	const std::vector<ByteBuffer::HashType> & getResponseBodyHashTypes() const;
+	bool addResponseBodyHashType(ByteBuffer::HashType hashType);
+	bool clearResponseBodyHashTypes();
 	bool isRequestInitiated() const;
 	std::optional<std::chrono::time_point<std::chrono::system_clock>> getRequestInitiatedSystemTimePoint() const;
 	std::optional<std::chrono::time_point<std::chrono::steady_clock>> getRequestInitiatedSteadyTimePoint() const;
@@ -74,6 +118,10 @@ public:
 	std::optional<std::chrono::time_point<std::chrono::steady_clock>> getTransferStartedSteadyTimePoint() const;
 	std::shared_ptr<HTTPResponse> getResponse() const;
 
+	// cURL callbacks
+	static size_t readData(char * data, size_t size, size_t numberOfItems, void * context);
+	static int seekData(void * context, curl_off_t offset, int origin);
+
 	// HTTPQueryParameters Aliases
 	bool hasQueryParameters() const;
 	size_t numberOfQueryParameters() const;
@@ -95,6 +143,7 @@ public:
 	bool isConnecting() const;
 	bool isReceiving() const;
 	bool isCompleted() const;
+	bool isRetrying() const;
 	bool isAborted() const;
 	bool canAbort() const;
 	bool isTimedOut() const;
@@ -119,6 +168,7 @@ public:
 	bool operator != (const HTTPRequest & request) const;
 
 	static const EncodingTypes DEFAULT_ACCEPTED_ENCODING_TYPES;
+	static constexpr Priority DEFAULT_PRIORITY = Priority::Normal;
 
 	boost::signals2::signal<void (HTTPRequest & /* request */, size_t /* numberOfBytesReceived */, size_t /* totalNumberOfBytes */)> progress;
 	boost::signals2::signal<void (HTTPRequest & /* request */)> completed;
@@ -128,15 +178,42 @@ private:
 	HTTPRequest(Method method, const std::string & url, HTTPService * service);
 
 	bool setResponse(std::shared_ptr<HTTPResponse> response);
-	bool startTransfer(const HTTPConfiguration & configuration, HTTPUtilities::CURLMultiHandle & curlMultiHandle);
+	std::string getFormattedURL(const HTTPConfiguration & configuration) const;
+	bool startTransfer(const HTTPConfiguration & configuration, HTTPUtilities::CURLEasyHandle curlEasyHandle, HTTPUtilities::CURLSharedHandle & curlSharedHandle, HTTPUtilities::CURLMultiHandle & curlMultiHandle);
+	bool resetTransfer();
+	bool openBody();
+	void closeBody();
+	std::optional<uint64_t> getBodySourceSize() const;
+	std::optional<size_t> readBodySource(uint8_t * data, size_t size);
+	std::optional<size_t> readBody(uint8_t * data, size_t size);
+	bool seekBody(uint64_t offset);
+	static std::string getContentEncodingName(ByteBuffer::CompressionMethod compressionMethod);
 	static int debugCallback(CURL * handle, curl_infotype type, char * data, size_t size, void * userData);
 	int debugCallbackHelper(CURL * handle, curl_infotype type, char * data, size_t size);
 	HTTPUtilities::CURLEasyHandle & getCURLEasyHandle();
 
 	Method m_method;
 	std::string m_url;
+	Priority m_priority;
 	HTTPQueryParameters m_queryParameters;
 	EncodingTypes m_acceptedEncodingTypes;
+	std::string m_bodyFilePath;
+	BodyCallback m_bodyCallback;
+	std::optional<uint64_t> m_bodyCallbackSize;
+	const uint8_t * m_bodyViewData;
+	size_t m_bodyViewSize;
+	std::optional<ByteBuffer::CompressionMethod> m_bodyCompressionMethod;
+	std::unique_ptr<std::ifstream> m_bodyFileStream;
+	uint64_t m_bodyOffset;
+	std::unique_ptr<CompressionStream> m_bodyCompressionStream;
+	std::vector<uint8_t> m_bodyReadBuffer;
+	std::vector<uint8_t> m_compressedBodyData;
+	size_t m_compressedBodyDataOffset;
+	std::string m_responseBodyFilePath;
+	ResponseBodyCallback m_responseBodyCallback;
+	std::vector<ByteBuffer::HashType> m_responseBodyHashTypes;
+	std::string m_cacheKey;
+	uint8_t m_numberOfAttempts;
 	std::optional<std::chrono::time_point<std::chrono::system_clock>> m_requestInitiatedSystemTimePoint;
 	std::optional<std::chrono::time_point<std::chrono::steady_clock>> m_requestInitiatedSteadyTimePoint;
 	std::optional<std::chrono::time_point<std::chrono::system_clock>> m_transferStartedSystemTimePoint;
@@ -1,29 +1,60 @@
 #include "HTTPRequestSettings.h"
 
+#include <algorithm>
+
 using namespace std::chrono_literals;
 
 const int64_t HTTPRequestSettings::DEFAULT_MAXIMUM_REDIRECTS = 10L;
+const uint8_t HTTPRequestSettings::DEFAULT_MAXIMUM_RETRIES = 2u;
+const std::chrono::milliseconds HTTPRequestSettings::DEFAULT_RETRY_BASE_DELAY(500ms);
+const std::chrono::milliseconds HTTPRequestSettings::DEFAULT_RETRY_MAXIMUM_DELAY(30s);
+const std::vector<uint16_t> HTTPRequestSettings::DEFAULT_RETRYABLE_STATUS_CODES = {
+	408, // Request Timeout
+	429, // Too Many Requests
+	500, // Internal Server Error
+	502, // Bad Gateway
+	503, // Service Unavailable
+	504  // Gateway Timeout
+};
 
 HTTPRequestSettings::HTTPRequestSettings(std::chrono::seconds connectionTimeout, std::chrono::seconds networkTimeout, std::chrono::seconds transferTimeout, int64_t maximumRedirects, bool verboseLoggingEnabled)
 	: m_connectionTimeout(connectionTimeout)
 	, m_networkTimeout(networkTimeout)
 	, m_transferTimeout(transferTimeout)
 	, m_maximumRedirects(DEFAULT_MAXIMUM_REDIRECTS)
-	, m_verboseLoggingEnabled(verboseLoggingEnabled) { }
+	, m_verboseLoggingEnabled(verboseLoggingEnabled)
+	, m_httpVersion(DEFAULT_HTTP_VERSION)
+	, m_maximumRetries(DEFAULT_MAXIMUM_RETRIES)
+	, m_retryBaseDelay(DEFAULT_RETRY_BASE_DELAY)
+	, m_retryMaximumDelay(DEFAULT_RETRY_MAXIMUM_DELAY)
+	, m_retryableStatusCodes(DEFAULT_RETRYABLE_STATUS_CODES)
+	, m_retryNonIdempotentRequests(false) { }
 
 HTTPRequestSettings::HTTPRequestSettings(HTTPRequestSettings && requestSettings) noexcept
 	: m_connectionTimeout(requestSettings.m_connectionTimeout)
 	, m_networkTimeout(requestSettings.m_networkTimeout)
 	, m_transferTimeout(requestSettings.m_transferTimeout)
 	, m_maximumRedirects(requestSettings.m_maximumRedirects)
-	, m_verboseLoggingEnabled(requestSettings.m_verboseLoggingEnabled) { }
+	, m_verboseLoggingEnabled(requestSettings.m_verboseLoggingEnabled)
+	, m_httpVersion(requestSettings.m_httpVersion)
+	, m_maximumRetries(requestSettings.m_maximumRetries)
+	, m_retryBaseDelay(requestSettings.m_retryBaseDelay)
+	, m_retryMaximumDelay(requestSettings.m_retryMaximumDelay)
+	, m_retryableStatusCodes(std::move(requestSettings.m_retryableStatusCodes))
+	, m_retryNonIdempotentRequests(requestSettings.m_retryNonIdempotentRequests) { }
 
 HTTPRequestSettings::HTTPRequestSettings(const HTTPRequestSettings & requestSettings)
 	: m_connectionTimeout(requestSettings.m_connectionTimeout)
 	, m_networkTimeout(requestSettings.m_networkTimeout)
 	, m_transferTimeout(requestSettings.m_transferTimeout)
 	, m_maximumRedirects(requestSettings.m_maximumRedirects)
-	, m_verboseLoggingEnabled(requestSettings.m_verboseLoggingEnabled) { }
+	, m_verboseLoggingEnabled(requestSettings.m_verboseLoggingEnabled)
+	, m_httpVersion(requestSettings.m_httpVersion)
+	, m_maximumRetries(requestSettings.m_maximumRetries)
+	, m_retryBaseDelay(requestSettings.m_retryBaseDelay)
+	, m_retryMaximumDelay(requestSettings.m_retryMaximumDelay)
+	, m_retryableStatusCodes(requestSettings.m_retryableStatusCodes)
+	, m_retryNonIdempotentRequests(requestSettings.m_retryNonIdempotentRequests) { }
 
 HTTPRequestSettings & HTTPRequestSettings::operator = (HTTPRequestSettings && requestSettings) noexcept {
 	if(this != &requestSettings) {
@@ -35,6 +66,12 @@ HTTPRequestSettings & HTTPRequestSettings::operator = (HTTPRequestSettings && re
 		m_transferTimeout = requestSettings.m_transferTimeout;
 		m_maximumRedirects = requestSettings.m_maximumRedirects;
 		m_verboseLoggingEnabled = requestSettings.m_verboseLoggingEnabled;
+		m_httpVersion = requestSettings.m_httpVersion;
+		m_maximumRetries = requestSettings.m_maximumRetries;
+		m_retryBaseDelay = requestSettings.m_retryBaseDelay;
+		m_retryMaximumDelay = requestSettings.m_retryMaximumDelay;
+		m_retryableStatusCodes = std::move(requestSettings.m_retryableStatusCodes);
+		m_retryNonIdempotentRequests = requestSettings.m_retryNonIdempotentRequests;
 	}
 
 	return *this;
@@ -49,6 +86,12 @@ HTTPRequestSettings & HTTPRequestSettings::operator = (const HTTPRequestSettings
 	m_transferTimeout = requestSettings.m_transferTimeout;
 	m_maximumRedirects = requestSettings.m_maximumRedirects;
 	m_verboseLoggingEnabled = requestSettings.m_verboseLoggingEnabled;
+	m_httpVersion = requestSettings.m_httpVersion;
+	m_maximumRetries = requestSettings.m_maximumRetries;
+	m_retryBaseDelay = requestSettings.m_retryBaseDelay;
+	m_retryMaximumDelay = requestSettings.m_retryMaximumDelay;
+	m_retryableStatusCodes = requestSettings.m_retryableStatusCodes;
+	m_retryNonIdempotentRequests = requestSettings.m_retryNonIdempotentRequests;
 
 	return *this;
 }
@@ -133,13 +176,97 @@ void HTTPRequestSettings::setVerboseLoggingEnabled(bool enabled) {
 	m_verboseLoggingEnabled = enabled;
 }
 
+HTTPRequestSettings::HTTPVersion HTTPRequestSettings::getHTTPVersion() const {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	return m_httpVersion;
+}
+
+void HTTPRequestSettings::setHTTPVersion(HTTPVersion httpVersion) {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	m_httpVersion = httpVersion;
+}
+
+uint8_t HTTPRequestSettings::getMaximumRetries() const {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	return m_maximumRetries;
+}
+
+void HTTPRequestSettings::setMaximumRetries(uint8_t maximumRetries) {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	m_maximumRetries = maximumRetries;
+}
+
+std::chrono::milliseconds HTTPRequestSettings::getRetryBaseDelay() const {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	return m_retryBaseDelay;
+}
+
+void HTTPRequestSettings::setRetryBaseDelay(std::chrono::milliseconds delay) {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	m_retryBaseDelay = std::max(delay, 0ms);
+}
+
+std::chrono::milliseconds HTTPRequestSettings::getRetryMaximumDelay() const {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	return m_retryMaximumDelay;
+}
+
+void HTTPRequestSettings::setRetryMaximumDelay(std::chrono::milliseconds delay) {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	m_retryMaximumDelay = std::max(delay, 0ms);
+}
+
+bool HTTPRequestSettings::isRetryableStatusCode(uint16_t statusCode) const {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	return std::find(m_retryableStatusCodes.cbegin(), m_retryableStatusCodes.cend(), statusCode) != m_retryableStatusCodes.cend();
+}
+
+const std::vector<uint16_t> & HTTPRequestSettings::getRetryableStatusCodes() const {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	return m_retryableStatusCodes;
+}
+
+void HTTPRequestSettings::setRetryableStatusCodes(const std::vector<uint16_t> & statusCodes) {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	m_retryableStatusCodes = statusCodes;
+}
+
+bool HTTPRequestSettings::isRetryingNonIdempotentRequestsEnabled() const {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	return m_retryNonIdempotentRequests;
+}
+
+void HTTPRequestSettings::setRetryingNonIdempotentRequestsEnabled(bool enabled) {
+	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
+
+	m_retryNonIdempotentRequests = enabled;
+}
+
 bool HTTPRequestSettings::operator == (const HTTPRequestSettings & requestSettings) const {
 	std::lock_guard<std::recursive_mutex> lock(m_requestSettingsMutex);
 
 	return m_connectionTimeout == requestSettings.m_connectionTimeout &&
 		   m_networkTimeout == requestSettings.m_networkTimeout &&
 		   m_transferTimeout == requestSettings.m_transferTimeout &&
-		   m_verboseLoggingEnabled == requestSettings.m_verboseLoggingEnabled;
+		   m_verboseLoggingEnabled == requestSettings.m_verboseLoggingEnabled &&
+		   m_httpVersion == requestSettings.m_httpVersion &&
+		   m_maximumRetries == requestSettings.m_maximumRetries &&
+		   m_retryBaseDelay == requestSettings.m_retryBaseDelay &&
+		   m_retryMaximumDelay == requestSettings.m_retryMaximumDelay &&
+		   m_retryableStatusCodes == requestSettings.m_retryableStatusCodes &&
+		   m_retryNonIdempotentRequests == requestSettings.m_retryNonIdempotentRequests;
 }
 
 bool HTTPRequestSettings::operator != (const HTTPRequestSettings & requestSettings) const {
@@ -2,10 +2,20 @@
 #define _HTTP_REQUEST_SETTINGS_H_
 
 #include <chrono>
+#include <cstdint>
 #include <mutex>
+#include <vector>
 
 class HTTPRequestSettings {
 public:
+	enum class HTTPVersion : uint8_t {
+		Default,
+		HTTP1_1,
+		HTTP2,
+		HTTP2TLS,
+		HTTP2PriorKnowledge
+	};
+
 	HTTPRequestSettings(std::chrono::seconds connectionTimeout = std::chrono::seconds(0), std::chrono::seconds networkTimeout = std::chrono::seconds(0), std::chrono::seconds transferTimeout = std::chrono::seconds(0), int64_t maximumRedirects = DEFAULT_MAXIMUM_REDIRECTS, bool verboseLoggingEnabled = false);
 	HTTPRequestSettings(HTTPRequestSettings && timeout) noexcept;
 	HTTPRequestSettings(const HTTPRequestSettings & timeout);
@@ -26,11 +36,29 @@ public:
 	void setMaximumRedirects(int64_t maximumRedirects);
 	bool isVerboseLoggingEnabled() const;
 	void setVerboseLoggingEnabled(bool enabled);
+	HTTPVersion getHTTPVersion() const;
+	void setHTTPVersion(HTTPVersion httpVersion);
+	uint8_t getMaximumRetries() const;
+	void setMaximumRetries(uint8_t maximumRetries);
+	std::chrono::milliseconds getRetryBaseDelay() const;
+	void setRetryBaseDelay(std::chrono::milliseconds delay);
+	std::chrono::milliseconds getRetryMaximumDelay() const;
+	void setRetryMaximumDelay(std::chrono::milliseconds delay);
+	bool isRetryableStatusCode(uint16_t statusCode) const;
+	const std::vector<uint16_t> & getRetryableStatusCodes() const;
+	void setRetryableStatusCodes(const std::vector<uint16_t> & statusCodes);
+	bool isRetryingNonIdempotentRequestsEnabled() const;
+	void setRetryingNonIdempotentRequestsEnabled(bool enabled);
 
 	bool operator == (const HTTPRequestSettings & timeout) const;
 	bool operator != (const HTTPRequestSettings & timeout) const;
 
 	static const int64_t DEFAULT_MAXIMUM_REDIRECTS;
+	static constexpr HTTPVersion DEFAULT_HTTP_VERSION = HTTPVersion::HTTP2TLS;
+	static const uint8_t DEFAULT_MAXIMUM_RETRIES;
+	static const std::chrono::milliseconds DEFAULT_RETRY_BASE_DELAY;
+	static const std::chrono::milliseconds DEFAULT_RETRY_MAXIMUM_DELAY;
+	static const std::vector<uint16_t> DEFAULT_RETRYABLE_STATUS_CODES;
 
 protected:
 	std::chrono::seconds m_connectionTimeout;
@@ -38,6 +66,12 @@ protected:
 	std::chrono::seconds m_transferTimeout;
 	int64_t m_maximumRedirects;
 	bool m_verboseLoggingEnabled;
+	HTTPVersion m_httpVersion;
+	uint8_t m_maximumRetries;
+	std::chrono::milliseconds m_retryBaseDelay;
+	std::chrono::milliseconds m_retryMaximumDelay;
+	std::vector<uint16_t> m_retryableStatusCodes;
+	bool m_retryNonIdempotentRequests;
 	mutable std::recursive_mutex m_requestSettingsMutex;
 };
 
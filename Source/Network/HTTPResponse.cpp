@@ -1,21 +1,30 @@
 #include "HTTPResponse.h"
 
 #include "HTTPRequest.h"
+#include "HTTPService.h"
 #include "HTTPStatusCode.h"
+#include "Utilities/FileUtilities.h"
 #include "Utilities/StringUtilities.h"
 
 #include <fmt/core.h>
 #include <magic_enum/magic_enum.hpp>
 #include <spdlog/spdlog.h>
 
+#include <filesystem>
+
 using namespace std::chrono_literals;
 
+static const std::string TEMPORARY_BODY_FILE_EXTENSION("part");
+
 HTTPResponse::HTTPResponse(HTTPService * service, std::shared_ptr<HTTPRequest> request)
 	: HTTPTransfer(service)
 	, m_statusCode(static_cast<uint16_t>(magic_enum::enum_integer(HTTPStatusCode::None)))
 	, m_state(State::None)
 	, m_totalRawHeadersSize(0u)
 	, m_expectedSize(0u)
+	, m_bodySize(0u)
+	, m_bodyInitialized(false)
+	, m_bodyBuffered(true)
 	, m_request(request) { }
 
 HTTPResponse::HTTPResponse(HTTPResponse && response) noexcept
@@ -33,6 +42,15 @@ HTTPResponse::HTTPResponse(HTTPResponse && response) noexcept
 	, m_lastReceivedHeaderName(std::move(response.m_lastReceivedHeaderName))
 	, m_totalRawHeadersSize(response.m_totalRawHeadersSize)
 	, m_expectedSize(response.m_expectedSize)
+	, m_bodySize(response.m_bodySize)
+	, m_bodyInitialized(response.m_bodyInitialized)
+	, m_bodyBuffered(response.m_bodyBuffered)
+	, m_bodyFilePath(std::move(response.m_bodyFilePath))
+	, m_bodyTemporaryFilePath(std::move(response.m_bodyTemporaryFilePath))
+	, m_bodyFileStream(std::move(response.m_bodyFileStream))
+	, m_bodyCallback(std::move(response.m_bodyCallback))
+	, m_bodyHasher(std::move(response.m_bodyHasher))
+	, m_bodyDigests(std::move(response.m_bodyDigests))
 	, m_errorMessage(std::move(response.m_errorMessage))
 	, m_request(response.m_request) { }
 
@@ -51,6 +69,12 @@ HTTPResponse::HTTPResponse(const HTTPResponse & response)
 	, m_lastReceivedHeaderName(response.m_lastReceivedHeaderName)
 	, m_totalRawHeadersSize(response.m_totalRawHeadersSize)
 	, m_expectedSize(response.m_expectedSize)
+	, m_bodySize(response.m_bodySize)
+	, m_bodyInitialized(response.m_bodyInitialized)
+	, m_bodyBuffered(response.m_bodyBuffered)
+	, m_bodyFilePath(response.m_bodyFilePath)
+	, m_bodyCallback(response.m_bodyCallback)
+	, m_bodyDigests(response.m_bodyDigests)
 	, m_errorMessage(response.m_errorMessage)
 	, m_request(response.m_request)  { }
 
@@ -74,6 +98,15 @@ HTTPResponse & HTTPResponse::operator = (HTTPResponse && response) noexcept {
 		m_lastReceivedHeaderName = std::move(response.m_lastReceivedHeaderName);
 		m_totalRawHeadersSize = response.m_totalRawHeadersSize;
 		m_expectedSize = response.m_expectedSize;
+		m_bodySize = response.m_bodySize;
+		m_bodyInitialized = response.m_bodyInitialized;
+		m_bodyBuffered = response.m_bodyBuffered;
+		m_bodyFilePath = std::move(response.m_bodyFilePath);
+		m_bodyTemporaryFilePath = std::move(response.m_bodyTemporaryFilePath);
+		m_bodyFileStream = std::move(response.m_bodyFileStream);
+		m_bodyCallback = std::move(response.m_bodyCallback);
+		m_bodyHasher = std::move(response.m_bodyHasher);
+		m_bodyDigests = std::move(response.m_bodyDigests);
 		m_errorMessage = std::move(response.m_errorMessage);
 		m_request = response.m_request;
 	}
@@ -100,6 +133,15 @@ HTTPResponse & HTTPResponse::operator = (const HTTPResponse & response) {
 	m_lastReceivedHeaderName = response.m_lastReceivedHeaderName;
 	m_totalRawHeadersSize = response.m_totalRawHeadersSize;
 	m_expectedSize = response.m_expectedSize;
+	m_bodySize = response.m_bodySize;
+	m_bodyInitialized = response.m_bodyInitialized;
+	m_bodyBuffered = response.m_bodyBuffered;
+	m_bodyFilePath = response.m_bodyFilePath;
+	m_bodyTemporaryFilePath.clear();
+	m_bodyFileStream.reset();
+	m_bodyCallback = response.m_bodyCallback;
+	m_bodyHasher = Hasher();
+	m_bodyDigests = response.m_bodyDigests;
 	m_errorMessage = response.m_errorMessage;
 	m_request = response.m_request;
 
@@ -108,12 +150,22 @@ HTTPResponse & HTTPResponse::operator = (const HTTPResponse & response) {
 
 HTTPResponse::~HTTPResponse() {
 	m_service = nullptr;
+
+	if(m_bodyFileStream != nullptr) {
+		finishBody(false);
+	}
 }
 
 size_t HTTPResponse::getSize() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_totalRawHeadersSize + m_body->getSize();
+	return m_totalRawHeadersSize + m_bodySize;
+}
+
+size_t HTTPResponse::getBodySize() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_bodySize;
 }
 
 size_t HTTPResponse::getExpectedSize() const {
@@ -174,6 +226,12 @@ bool HTTPResponse::isCompleted() const {
 	return m_state == State::Completed;
 }
 
+bool HTTPResponse::isRetrying() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_state == State::Retrying;
+}
+
 bool HTTPResponse::isAborted() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -385,6 +443,18 @@ std::string HTTPResponse::getETag() const {
 	return HTTPHeaders::extractETagValue(getHeaderValue(HTTPHeaders::ETAG_HEADER_NAME));
 }
 
+std::string HTTPResponse::getBodyHash(ByteBuffer::HashType hashType, ByteBuffer::HashFormat hashFormat) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::map<ByteBuffer::HashType, std::vector<uint8_t>>::const_iterator bodyDigestIterator(m_bodyDigests.find(hashType));
+
+	if(bodyDigestIterator == m_bodyDigests.cend() || m_bodySize == 0u) {
+		return HTTPTransfer::getBodyHash(hashType, hashFormat);
+	}
+
+	return Hasher::formatDigest(bodyDigestIterator->second, hashFormat);
+}
+
 std::future<std::shared_ptr<HTTPResponse>> HTTPResponse::getFuture() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -452,7 +522,7 @@ bool HTTPResponse::setState(State state) {
 		}
 
 		case State::Connecting: {
-			if(m_state != State::None) {
+			if(m_state != State::None && m_state != State::Retrying) {
 				return false;
 			}
 
@@ -499,6 +569,17 @@ bool HTTPResponse::setState(State state) {
 			return true;
 		}
 
+		case State::Retrying: {
+			if(m_state == State::None ||
+			   Any(m_state & State::Done)) {
+				return false;
+			}
+
+			m_state = State::Retrying;
+
+			return true;
+		}
+
 		case State::Aborted: {
 			if(m_state == State::None ||
 			   Any(m_state & State::Done)) {
@@ -608,14 +689,14 @@ bool HTTPResponse::appendHeader(const char * data, size_t size) {
 			return false;
 		}
 
-		size_t statusNameSeparatorIndex = header.find(" ", statusCodeSeparatorIndex + 1);
+		// the reason phrase is optional and is never sent over HTTP/2 or HTTP/3
+		size_t statusCodeEndIndex = header.find_first_of(" \r\n", statusCodeSeparatorIndex + 1);
 
-		if(statusNameSeparatorIndex == std::string::npos) {
-			onTransferError("Malformed HTTP response header received, missing status name!");
-			return false;
+		if(statusCodeEndIndex == std::string::npos) {
+			statusCodeEndIndex = header.length();
 		}
 
-		std::string statusCodeData(std::string(header.data() + statusCodeSeparatorIndex + 1, statusNameSeparatorIndex - statusCodeSeparatorIndex - 1));
+		std::string statusCodeData(std::string(header.data() + statusCodeSeparatorIndex + 1, statusCodeEndIndex - statusCodeSeparatorIndex - 1));
 		std::optional<uint16_t> optionalStatusCode(Utilities::parseUnsignedShort(statusCodeData));
 
 		if(!optionalStatusCode.has_value()) {
@@ -704,13 +785,139 @@ bool HTTPResponse::appendData(const char * data, size_t size) {
 		return false;
 	}
 
-	m_body->writeBytes(reinterpret_cast<const uint8_t *>(data), size);
+	if(!initializeBody()) {
+		return false;
+	}
+
+	const uint8_t * bodyData = reinterpret_cast<const uint8_t *>(data);
+
+	m_bodyHasher.update(bodyData, size);
+
+	if(m_bodyFileStream != nullptr) {
+		if(!m_bodyFileStream->write(data, size)) {
+			spdlog::error("Failed to write {} response bytes to temporary file: '{}'.", size, m_bodyTemporaryFilePath);
+			return false;
+		}
+	}
+
+	if(m_bodyCallback) {
+		if(!m_bodyCallback(bodyData, size)) {
+			return false;
+		}
+	}
+
+	if(m_bodyBuffered) {
+		m_body->writeBytes(bodyData, size);
+	}
+
+	m_bodySize += size;
 
 	notifyProgress();
 
 	return true;
 }
 
+bool HTTPResponse::initializeBody() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_bodyInitialized) {
+		return true;
+	}
+
+	std::shared_ptr<HTTPRequest> request(m_request.lock());
+
+	if(request == nullptr) {
+		return false;
+	}
+
+	m_bodyInitialized = true;
+	m_bodyBuffered = request->isResponseBodyBuffered();
+	m_bodyFilePath = request->getResponseBodyFilePath();
+	m_bodyCallback = request->getResponseBodyCallback();
+
+	m_bodyHasher = Hasher(request->getResponseBodyHashTypes());
+
+	if(!m_bodyFilePath.empty()) {
+		return openBodyFile();
+	}
+
+	return true;
+}
+
+bool HTTPResponse::openBodyFile() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_bodyFilePath.empty()) {
+		return false;
+	}
+
+	if(m_bodyFileStream != nullptr) {
+		return true;
+	}
+
+	// data is written to a temporary file which only replaces the destination file once the transfer succeeds
+	m_bodyTemporaryFilePath = fmt::format("{}.{}", m_bodyFilePath, TEMPORARY_BODY_FILE_EXTENSION);
+
+	std::error_code errorCode;
+	Utilities::createDirectoryStructureForFilePath(m_bodyTemporaryFilePath, errorCode);
+
+	if(errorCode) {
+		spdlog::error("Failed to create response file destination directory structure for file path '{}': {}", m_bodyTemporaryFilePath, errorCode.message());
+		return false;
+	}
+
+	m_bodyFileStream = std::make_unique<std::ofstream>(m_bodyTemporaryFilePath, std::ios::binary | std::ios::trunc);
+
+	if(!m_bodyFileStream->is_open()) {
+		spdlog::error("Failed to open temporary response file for writing: '{}'.", m_bodyTemporaryFilePath);
+		m_bodyFileStream.reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool HTTPResponse::finishBody(bool keep) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(keep) {
+		if(!initializeBody()) {
+			return false;
+		}
+
+		m_bodyHasher.finish();
+		m_bodyDigests = m_bodyHasher.getDigests();
+	}
+
+	m_bodyHasher = Hasher();
+
+	if(m_bodyFileStream == nullptr) {
+		return true;
+	}
+
+	m_bodyFileStream->close();
+	bool fileWritten = !m_bodyFileStream->fail();
+	m_bodyFileStream.reset();
+
+	std::error_code errorCode;
+
+	if(keep && fileWritten) {
+		std::filesystem::rename(std::filesystem::path(m_bodyTemporaryFilePath), std::filesystem::path(m_bodyFilePath), errorCode);
+
+		if(!errorCode) {
+			m_bodyTemporaryFilePath.clear();
+			return true;
+		}
+
+		spdlog::error("Failed to move temporary response file '{}' to '{}': {}", m_bodyTemporaryFilePath, m_bodyFilePath, errorCode.message());
+	}
+
+	std::filesystem::remove(std::filesystem::path(m_bodyTemporaryFilePath), errorCode);
+	m_bodyTemporaryFilePath.clear();
+
+	return !keep;
+}
+
 void HTTPResponse::incrementTotalRawHeaderSizeBy(size_t size) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -740,7 +947,7 @@ void HTTPResponse::notifyProgress() {
 		return;
 	}
 	
-	request->progress(*request, m_body->getSize(), m_expectedSize);
+	request->progress(*request, m_bodySize, m_expectedSize);
 }
 
 void HTTPResponse::notifyCompleted() {
@@ -806,17 +1013,75 @@ bool HTTPResponse::onTransferCompleted(bool success, std::string_view errorMessa
 
 	if(request->getMethod() != HTTPRequest::Method::Head &&
 	   contentLength.has_value() &&
-	   m_body->getSize() != contentLength.value()) {
-		onTransferError(fmt::format("Response size {} does not match '{}' header value of: {}.", m_body->getSize(), HTTPHeaders::CONTENT_LENGTH_HEADER_NAME, contentLength.value()));
+	   m_bodySize != contentLength.value()) {
+		onTransferError(fmt::format("Response size {} does not match '{}' header value of: {}.", m_bodySize, HTTPHeaders::CONTENT_LENGTH_HEADER_NAME, contentLength.value()));
+		return false;
+	}
+
+	// the response file is only written when the server answered with a successful status code
+	if(!finishBody(isSuccessStatusCode() && m_statusCode != magic_enum::enum_integer(HTTPStatusCode::NotModified))) {
+		onTransferError(fmt::format("Failed to write response body to file: '{}'.", m_bodyFilePath));
+		return false;
+	}
+
+	// the service updates its cache before completing the transfer, so that it never has to be called while the response is locked
+	return true;
+}
+
+bool HTTPResponse::onTransferFinished() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::shared_ptr<HTTPRequest> request(m_request.lock());
+
+	if(request == nullptr) {
+		return false;
+	}
+
+	// the request may have been aborted while the cache was being updated
+	if(!setState(State::Completed)) {
+		return false;
+	}
+
+	m_promise.set_value(request->getResponse());
+
+	notifyCompleted();
+
+	return true;
+}
+
+bool HTTPResponse::onTransferRetrying() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	// data which was already handed to a response body callback cannot be taken back
+	if(m_bodyCallback && m_bodySize != 0u) {
+		return false;
+	}
+
+	if(!setState(State::Retrying)) {
+		return false;
 	}
-	else {
-		setState(State::Completed);
 
-		m_promise.set_value(request->getResponse());
+	finishBody(false);
+	clearHeaders();
 
-		notifyCompleted();
+	if(m_body != nullptr) {
+		m_body->clear();
 	}
 
+	m_statusCode = magic_enum::enum_integer(HTTPStatusCode::None);
+	m_connectionInitiatedSystemTimePoint.reset();
+	m_connectionInitiatedSteadyTimePoint.reset();
+	m_connectionEstablishedSystemTimePoint.reset();
+	m_connectionEstablishedSteadyTimePoint.reset();
+	m_lastDataReceivedSteadyTimePoint.reset();
+	m_lastReceivedHeaderName.clear();
+	m_totalRawHeadersSize = 0u;
+	m_expectedSize = 0u;
+	m_bodySize = 0u;
+	m_bodyInitialized = false;
+	m_bodyDigests.clear();
+	m_errorMessage.clear();
+
 	return true;
 }
 
@@ -840,6 +1105,8 @@ bool HTTPResponse::onConnectionTimedOut() {
 		m_errorMessage = fmt::format("Request connection timed out.");
 	}
 
+	finishBody(false);
+
 	setState(State::ConnectionTimedOut);
 
 	m_promise.set_value(request->getResponse());
@@ -864,6 +1131,8 @@ bool HTTPResponse::onNetworkTimedOut() {
 
 	m_errorMessage = fmt::format("Request timed out with no data received for {} seconds.", request->getNetworkTimeout().count());
 
+	finishBody(false);
+
 	setState(State::NetworkTimedOut);
 
 	m_promise.set_value(request->getResponse());
@@ -893,6 +1162,8 @@ bool HTTPResponse::onTransferTimedOut() {
 		m_errorMessage = fmt::format("Request data transfer timed out.");
 	}
 
+	finishBody(false);
+
 	setState(State::TransferTimedOut);
 
 	m_promise.set_value(request->getResponse());
@@ -915,6 +1186,8 @@ bool HTTPResponse::onTransferAborted() {
 		return false;
 	}
 
+	finishBody(false);
+
 	m_promise.set_value(request->getResponse());
 
 	notifyFailed();
@@ -935,9 +1208,14 @@ bool HTTPResponse::onTransferError(const std::string & errorMessage) {
 		return false;
 	}
 
+	// the request may already have been aborted or timed out, in which case its promise has been fulfilled
+	if(!setState(State::Error)) {
+		return false;
+	}
+
 	m_errorMessage = Utilities::trimString(errorMessage);
 
-	setState(State::Error);
+	finishBody(false);
 
 	m_promise.set_value(request->getResponse());
 
@@ -957,3 +1235,54 @@ bool HTTPResponse::operator != (const HTTPResponse & response) const {
 
 	return !operator == (response);
 }
+
+bool HTTPResponse::onCacheHit(const HTTPHeaders::HeaderMap & headers, std::unique_ptr<ByteBuffer> body) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_state != State::None || body == nullptr) {
+		return false;
+	}
+
+	std::shared_ptr<HTTPRequest> request(m_request.lock());
+
+	if(request == nullptr) {
+		return false;
+	}
+
+	m_headers = headers;
+	m_statusCode = magic_enum::enum_integer(HTTPStatusCode::Ok);
+	m_bodySize = body->getSize();
+	m_body = std::move(body);
+	m_state = State::Completed;
+	m_transferCompletedSystemTimePoint = std::chrono::system_clock::now();
+	m_transferCompletedSteadyTimePoint = std::chrono::steady_clock::now();
+	m_readOnly = true;
+
+	m_promise.set_value(request->getResponse());
+
+	notifyCompleted();
+
+	return true;
+}
+
+bool HTTPResponse::onCacheRevalidated(const HTTPHeaders::HeaderMap & headers, std::unique_ptr<ByteBuffer> body) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_readOnly || body == nullptr || m_statusCode != magic_enum::enum_integer(HTTPStatusCode::NotModified)) {
+		return false;
+	}
+
+	// headers received with the not modified response take precedence over the cached ones
+	for(HTTPHeaders::HeaderMap::const_iterator i = headers.cbegin(); i != headers.cend(); ++i) {
+		if(!hasHeader(i->first) || Utilities::areStringsEqualIgnoreCase(i->first, CONTENT_LENGTH_HEADER_NAME)) {
+			m_headers[i->first] = i->second;
+		}
+	}
+
+	m_statusCode = magic_enum::enum_integer(HTTPStatusCode::Ok);
+	m_bodySize = body->getSize();
+	m_body = std::move(body);
+	m_bodyDigests.clear();
+
+	return true;
+}
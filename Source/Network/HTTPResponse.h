@@ -2,12 +2,17 @@
 #define _HTTP_RESPONSE_H_
 
 #include "BitmaskOperators.h"
+#include "Hasher.h"
 #include "HTTPTransfer.h"
 
 #include <chrono>
+#include <fstream>
+#include <functional>
 #include <future>
+#include <map>
 #include <memory>
 #include <optional>
+#include <vector>
 
 class HTTPRequest;
 
@@ -30,6 +35,7 @@ public:
 		NetworkTimedOut = 1 << 6,
 		TransferTimedOut = 1 << 7,
 		Error = 1 << 8,
+		Retrying = 1 << 9,
 		Receiving = ReceivingData | ReceivingHeaders,
 		TimedOut = ConnectionTimedOut | NetworkTimedOut | TransferTimedOut,
 		Failed = Aborted | TimedOut | Error,
@@ -43,6 +49,7 @@ public:
 	~HTTPResponse() override;
 
 	size_t getSize() const;
+	size_t getBodySize() const;
 	size_t getExpectedSize() const;
 	bool isSuccessStatusCode() const;
 	bool isFailureStatusCode() const;
@@ -52,6 +59,7 @@ public:
 	bool isConnecting() const;
 	bool isReceiving() const;
 	bool isCompleted() const;
+	bool isRetrying() const;
 	bool isAborted() const;
 	bool canAbort() const;
 	bool isTimedOut() const;
@@ -81,6 +89,7 @@ public:
 	std::string getLastModifiedDate() const;
 	bool hasETag() const;
 	std::string getETag() const;
+	std::string getBodyHash(ByteBuffer::HashType hashType, ByteBuffer::HashFormat hashFormat = ByteBuffer::DEFAULT_HASH_FORMAT) const override;
 	std::shared_ptr<HTTPRequest> getRequest() const;
 	std::future<std::shared_ptr<HTTPResponse>> getFuture() const;
 
@@ -98,6 +107,9 @@ private:
 	bool checkTimeouts();
 	bool appendHeader(const char * data, size_t size);
 	bool appendData(const char * data, size_t size);
+	bool initializeBody();
+	bool openBodyFile();
+	bool finishBody(bool keep);
 	void incrementTotalRawHeaderSizeBy(size_t size);
 	void setTotalRawHeaderSize(size_t size);
 	void resetTotalRawHeaderSize();
@@ -105,11 +117,15 @@ private:
 	void notifyCompleted();
 	void notifyFailed();
 	bool onTransferCompleted(bool success, std::string_view errorMessage);
+	bool onTransferFinished();
+	bool onTransferRetrying();
 	bool onConnectionTimedOut();
 	bool onNetworkTimedOut();
 	bool onTransferTimedOut();
 	bool onTransferAborted();
 	bool onTransferError(const std::string & errorMessage);
+	bool onCacheHit(const HTTPHeaders::HeaderMap & headers, std::unique_ptr<ByteBuffer> body);
+	bool onCacheRevalidated(const HTTPHeaders::HeaderMap & headers, std::unique_ptr<ByteBuffer> body);
 
 	uint16_t m_statusCode;
 	State m_state;
@@ -125,6 +141,15 @@ private:
 	std::string m_lastReceivedHeaderName;
 	size_t m_totalRawHeadersSize;
 	size_t m_expectedSize;
+	size_t m_bodySize;
+	bool m_bodyInitialized;
+	bool m_bodyBuffered;
+	std::string m_bodyFilePath;
+	std::string m_bodyTemporaryFilePath;
+	std::unique_ptr<std::ofstream> m_bodyFileStream;
+	std::function<bool (const uint8_t *, size_t)> m_bodyCallback;
+	Hasher m_bodyHasher;
+	std::map<ByteBuffer::HashType, std::vector<uint8_t>> m_bodyDigests;
 	std::string m_errorMessage;
 	std::weak_ptr<HTTPRequest> m_request;
 	mutable std::promise<std::shared_ptr<HTTPResponse>> m_promise;
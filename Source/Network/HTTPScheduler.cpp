@@ -0,0 +1,298 @@
+#include "HTTPScheduler.h"
+
+#include "HTTPUtilities.h"
+
+#include <algorithm>
+
+HTTPScheduler::HTTPScheduler(size_t maximumActiveRequests, size_t maximumActiveRequestsPerHost)
+	: m_maximumActiveRequests(std::max(maximumActiveRequests, static_cast<size_t>(1u)))
+	, m_maximumActiveRequestsPerHost(std::max(maximumActiveRequestsPerHost, static_cast<size_t>(1u)))
+	, m_numberOfScheduledRequests(0)
+	, m_totalWaitDuration(std::chrono::milliseconds::zero())
+	, m_maximumWaitDuration(std::chrono::milliseconds::zero()) { }
+
+HTTPScheduler::~HTTPScheduler() { }
+
+size_t HTTPScheduler::getMaximumActiveRequests() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_maximumActiveRequests;
+}
+
+bool HTTPScheduler::setMaximumActiveRequests(size_t maximumActiveRequests) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(maximumActiveRequests < 1) {
+		return false;
+	}
+
+	m_maximumActiveRequests = maximumActiveRequests;
+
+	return true;
+}
+
+size_t HTTPScheduler::getMaximumActiveRequestsPerHost() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_maximumActiveRequestsPerHost;
+}
+
+bool HTTPScheduler::setMaximumActiveRequestsPerHost(size_t maximumActiveRequestsPerHost) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(maximumActiveRequestsPerHost < 1) {
+		return false;
+	}
+
+	m_maximumActiveRequestsPerHost = maximumActiveRequestsPerHost;
+
+	return true;
+}
+
+bool HTTPScheduler::hasPendingRequests() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	for(PriorityQueueMap::const_iterator i = m_pendingRequests.cbegin(); i != m_pendingRequests.cend(); ++i) {
+		if(!i->second.hostOrder.empty()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t HTTPScheduler::numberOfPendingRequests() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	size_t numberOfPendingRequests = 0;
+
+	for(PriorityQueueMap::const_iterator i = m_pendingRequests.cbegin(); i != m_pendingRequests.cend(); ++i) {
+		for(std::map<std::string, std::deque<PendingRequest>>::const_iterator j = i->second.requestsByHost.cbegin(); j != i->second.requestsByHost.cend(); ++j) {
+			numberOfPendingRequests += j->second.size();
+		}
+	}
+
+	return numberOfPendingRequests;
+}
+
+size_t HTTPScheduler::numberOfActiveRequests() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_activeRequestHostNames.size();
+}
+
+bool HTTPScheduler::hasMaximumActiveRequests() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_activeRequestHostNames.size() >= m_maximumActiveRequests;
+}
+
+bool HTTPScheduler::hasSchedulableRequest() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(hasMaximumActiveRequests()) {
+		return false;
+	}
+
+	for(PriorityQueueMap::const_iterator i = m_pendingRequests.cbegin(); i != m_pendingRequests.cend(); ++i) {
+		for(const std::string & hostName : i->second.hostOrder) {
+			if(canStartRequestFor(hostName)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool HTTPScheduler::enqueue(std::shared_ptr<HTTPRequest> request, const std::string & url) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(request == nullptr) {
+		return false;
+	}
+
+	std::string hostName(HTTPUtilities::getHostName(url, true));
+	PriorityQueue & priorityQueue = m_pendingRequests[request->getPriority()];
+	std::deque<PendingRequest> & hostRequests = priorityQueue.requestsByHost[hostName];
+
+	if(hostRequests.empty()) {
+		priorityQueue.hostOrder.push_back(hostName);
+	}
+
+	hostRequests.push_back({ request, std::chrono::steady_clock::now() });
+
+	return true;
+}
+
+std::shared_ptr<HTTPRequest> HTTPScheduler::dequeue() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(hasMaximumActiveRequests()) {
+		return nullptr;
+	}
+
+	// higher priority levels are always drained first, hosts within the same priority level take turns so that one busy host cannot starve the others
+	for(PriorityQueueMap::iterator i = m_pendingRequests.begin(); i != m_pendingRequests.end(); ++i) {
+		PriorityQueue & priorityQueue = i->second;
+		size_t numberOfHosts = priorityQueue.hostOrder.size();
+
+		for(size_t j = 0; j < numberOfHosts; j++) {
+			std::string hostName(std::move(priorityQueue.hostOrder.front()));
+			priorityQueue.hostOrder.pop_front();
+
+			if(!canStartRequestFor(hostName)) {
+				priorityQueue.hostOrder.push_back(std::move(hostName));
+				continue;
+			}
+
+			std::map<std::string, std::deque<PendingRequest>>::iterator hostRequestsIterator(priorityQueue.requestsByHost.find(hostName));
+			PendingRequest pendingRequest(std::move(hostRequestsIterator->second.front()));
+			hostRequestsIterator->second.pop_front();
+
+			if(hostRequestsIterator->second.empty()) {
+				priorityQueue.requestsByHost.erase(hostRequestsIterator);
+			}
+			else {
+				priorityQueue.hostOrder.push_back(hostName);
+			}
+
+			std::chrono::milliseconds waitDuration(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - pendingRequest.enqueuedTimePoint));
+
+			m_numberOfScheduledRequests++;
+			m_totalWaitDuration += waitDuration;
+			m_maximumWaitDuration = std::max(m_maximumWaitDuration, waitDuration);
+
+			m_activeRequestHostNames[pendingRequest.request->getID()] = hostName;
+			m_numberOfActiveRequestsByHost[hostName]++;
+
+			return pendingRequest.request;
+		}
+	}
+
+	return nullptr;
+}
+
+std::shared_ptr<HTTPRequest> HTTPScheduler::getPendingRequest(const HTTPRequest & request) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	for(PriorityQueueMap::const_iterator i = m_pendingRequests.cbegin(); i != m_pendingRequests.cend(); ++i) {
+		for(std::map<std::string, std::deque<PendingRequest>>::const_iterator j = i->second.requestsByHost.cbegin(); j != i->second.requestsByHost.cend(); ++j) {
+			std::deque<PendingRequest>::const_iterator pendingRequestIterator(std::find_if(j->second.cbegin(), j->second.cend(), [&request](const PendingRequest & pendingRequest) {
+				return pendingRequest.request.get() == &request;
+			}));
+
+			if(pendingRequestIterator != j->second.cend()) {
+				return pendingRequestIterator->request;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool HTTPScheduler::removePendingRequest(const HTTPRequest & request) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	for(PriorityQueueMap::iterator i = m_pendingRequests.begin(); i != m_pendingRequests.end(); ++i) {
+		for(std::map<std::string, std::deque<PendingRequest>>::iterator j = i->second.requestsByHost.begin(); j != i->second.requestsByHost.end(); ++j) {
+			std::deque<PendingRequest>::iterator pendingRequestIterator(std::find_if(j->second.begin(), j->second.end(), [&request](const PendingRequest & pendingRequest) {
+				return pendingRequest.request.get() == &request;
+			}));
+
+			if(pendingRequestIterator == j->second.end()) {
+				continue;
+			}
+
+			j->second.erase(pendingRequestIterator);
+
+			if(j->second.empty()) {
+				i->second.hostOrder.erase(std::remove(i->second.hostOrder.begin(), i->second.hostOrder.end(), j->first), i->second.hostOrder.end());
+				i->second.requestsByHost.erase(j);
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool HTTPScheduler::onRequestFinished(const HTTPRequest & request) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::map<uint64_t, std::string>::iterator activeRequestIterator(m_activeRequestHostNames.find(request.getID()));
+
+	if(activeRequestIterator == m_activeRequestHostNames.end()) {
+		return false;
+	}
+
+	std::map<std::string, size_t>::iterator numberOfActiveRequestsIterator(m_numberOfActiveRequestsByHost.find(activeRequestIterator->second));
+
+	if(numberOfActiveRequestsIterator != m_numberOfActiveRequestsByHost.end() && --numberOfActiveRequestsIterator->second == 0) {
+		m_numberOfActiveRequestsByHost.erase(numberOfActiveRequestsIterator);
+	}
+
+	m_activeRequestHostNames.erase(activeRequestIterator);
+
+	return true;
+}
+
+std::vector<std::shared_ptr<HTTPRequest>> HTTPScheduler::clear() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::vector<std::shared_ptr<HTTPRequest>> pendingRequests;
+
+	for(PriorityQueueMap::iterator i = m_pendingRequests.begin(); i != m_pendingRequests.end(); ++i) {
+		for(std::map<std::string, std::deque<PendingRequest>>::iterator j = i->second.requestsByHost.begin(); j != i->second.requestsByHost.end(); ++j) {
+			for(PendingRequest & pendingRequest : j->second) {
+				pendingRequests.push_back(std::move(pendingRequest.request));
+			}
+		}
+	}
+
+	m_pendingRequests.clear();
+	m_activeRequestHostNames.clear();
+	m_numberOfActiveRequestsByHost.clear();
+
+	return pendingRequests;
+}
+
+HTTPScheduler::Statistics HTTPScheduler::getStatistics() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	Statistics statistics;
+	std::chrono::time_point<std::chrono::steady_clock> now(std::chrono::steady_clock::now());
+
+	for(PriorityQueueMap::const_iterator i = m_pendingRequests.cbegin(); i != m_pendingRequests.cend(); ++i) {
+		size_t numberOfPendingRequests = 0;
+
+		for(std::map<std::string, std::deque<PendingRequest>>::const_iterator j = i->second.requestsByHost.cbegin(); j != i->second.requestsByHost.cend(); ++j) {
+			numberOfPendingRequests += j->second.size();
+
+			if(!j->second.empty()) {
+				statistics.oldestPendingRequestWaitDuration = std::max(statistics.oldestPendingRequestWaitDuration, std::chrono::duration_cast<std::chrono::milliseconds>(now - j->second.front().enqueuedTimePoint));
+			}
+		}
+
+		statistics.numberOfPendingRequestsByPriority[i->first] = numberOfPendingRequests;
+		statistics.numberOfPendingRequests += numberOfPendingRequests;
+	}
+
+	statistics.numberOfActiveRequests = m_activeRequestHostNames.size();
+	statistics.numberOfActiveRequestsByHost = m_numberOfActiveRequestsByHost;
+	statistics.numberOfScheduledRequests = m_numberOfScheduledRequests;
+	statistics.maximumWaitDuration = m_maximumWaitDuration;
+
+	if(m_numberOfScheduledRequests != 0) {
+		statistics.averageWaitDuration = m_totalWaitDuration / m_numberOfScheduledRequests;
+	}
+
+	return statistics;
+}
+
+bool HTTPScheduler::canStartRequestFor(const std::string & hostName) const {
+	std::map<std::string, size_t>::const_iterator numberOfActiveRequestsIterator(m_numberOfActiveRequestsByHost.find(hostName));
+
+	return numberOfActiveRequestsIterator == m_numberOfActiveRequestsByHost.cend() || numberOfActiveRequestsIterator->second < m_maximumActiveRequestsPerHost;
+}
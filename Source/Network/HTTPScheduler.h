@@ -0,0 +1,79 @@
+#ifndef _HTTP_SCHEDULER_H_
+#define _HTTP_SCHEDULER_H_
+
+#include "HTTPRequest.h"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class HTTPScheduler final {
+public:
+	struct Statistics {
+		size_t numberOfPendingRequests = 0;
+		size_t numberOfActiveRequests = 0;
+		std::map<HTTPRequest::Priority, size_t> numberOfPendingRequestsByPriority;
+		std::map<std::string, size_t> numberOfActiveRequestsByHost;
+		uint64_t numberOfScheduledRequests = 0;
+		std::chrono::milliseconds averageWaitDuration = std::chrono::milliseconds::zero();
+		std::chrono::milliseconds maximumWaitDuration = std::chrono::milliseconds::zero();
+		std::chrono::milliseconds oldestPendingRequestWaitDuration = std::chrono::milliseconds::zero();
+	};
+
+	HTTPScheduler(size_t maximumActiveRequests, size_t maximumActiveRequestsPerHost);
+	~HTTPScheduler();
+
+	size_t getMaximumActiveRequests() const;
+	bool setMaximumActiveRequests(size_t maximumActiveRequests);
+	size_t getMaximumActiveRequestsPerHost() const;
+	bool setMaximumActiveRequestsPerHost(size_t maximumActiveRequestsPerHost);
+	bool hasPendingRequests() const;
+	size_t numberOfPendingRequests() const;
+	size_t numberOfActiveRequests() const;
+	bool hasMaximumActiveRequests() const;
+	bool hasSchedulableRequest() const;
+	bool enqueue(std::shared_ptr<HTTPRequest> request, const std::string & url);
+	std::shared_ptr<HTTPRequest> dequeue();
+	std::shared_ptr<HTTPRequest> getPendingRequest(const HTTPRequest & request) const;
+	bool removePendingRequest(const HTTPRequest & request);
+	bool onRequestFinished(const HTTPRequest & request);
+	std::vector<std::shared_ptr<HTTPRequest>> clear();
+	Statistics getStatistics() const;
+
+private:
+	struct PendingRequest {
+		std::shared_ptr<HTTPRequest> request;
+		std::chrono::time_point<std::chrono::steady_clock> enqueuedTimePoint;
+	};
+
+	struct PriorityQueue {
+		std::map<std::string, std::deque<PendingRequest>> requestsByHost;
+		std::deque<std::string> hostOrder;
+	};
+
+	// ordered from the highest to the lowest priority
+	using PriorityQueueMap = std::map<HTTPRequest::Priority, PriorityQueue, std::greater<HTTPRequest::Priority>>;
+
+	bool canStartRequestFor(const std::string & hostName) const;
+
+	size_t m_maximumActiveRequests;
+	size_t m_maximumActiveRequestsPerHost;
+	PriorityQueueMap m_pendingRequests;
+	std::map<uint64_t, std::string> m_activeRequestHostNames;
+	std::map<std::string, size_t> m_numberOfActiveRequestsByHost;
+	uint64_t m_numberOfScheduledRequests;
+	std::chrono::milliseconds m_totalWaitDuration;
+	std::chrono::milliseconds m_maximumWaitDuration;
+	mutable std::recursive_mutex m_mutex;
+
+	HTTPScheduler(const HTTPScheduler &) = delete;
+	const HTTPScheduler & operator = (const HTTPScheduler &) = delete;
+};
+
+#endif // _HTTP_SCHEDULER_H_
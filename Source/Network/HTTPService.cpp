@@ -4,30 +4,41 @@
 #include "Utilities/FileUtilities.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/ThreadUtilities.h"
+#include "Utilities/Utilities.h"
 
+#include <fmt/core.h>
+#include <magic_enum/magic_enum.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <array>
 #include <filesystem>
 
 using namespace std::chrono_literals;
 
 const size_t HTTPService::DEFAULT_MAXIMUM_ACTIVE_REQUESTS = 8u;
+const size_t HTTPService::DEFAULT_MAXIMUM_ACTIVE_REQUESTS_PER_HOST = 6u;
 const std::string HTTPService::CERTIFICATE_AUTHORITY_CERTIFICATE_PAGE_BASE_URL("https://curl.se/ca");
 const std::string HTTPService::CERTIFICATE_AUTHORITY_CERTIFICATE_STORE_FILE_NAME("cacert.pem");
 const std::string HTTPService::CERTIFICATE_AUTHORITY_CERTIFICATE_STORE_SHA256_FILE_NAME_SUFFIX(".sha256");
 const std::string HTTPService::INTERNET_CONNECTIVITY_CHECK_URL("http://connectivitycheck.gstatic.com/generate_204");
 const std::chrono::seconds HTTPService::DEFAULT_INTERNET_CONNECTIVITY_CHECK_INTERVAL(15s);
 const std::chrono::seconds HTTPService::DEFAULT_INTERNET_CONNECTIVITY_CHECK_TIMEOUT(1s);
+const std::chrono::milliseconds HTTPService::MAXIMUM_POLL_DURATION(100ms);
+const std::chrono::milliseconds HTTPService::IDLE_POLL_DURATION(1s);
 
 HTTPService::HTTPService()
 	: HTTPRequestSettings()
 	, m_initialized(false)
 	, m_running(false)
 	, m_stopRequested(false)
-	, m_maximumActiveRequests(DEFAULT_MAXIMUM_ACTIVE_REQUESTS)
+	, m_cacheEnabled(false)
 	, m_internetConnectivityCheckInterval(DEFAULT_INTERNET_CONNECTIVITY_CHECK_INTERVAL)
 	, m_internetConnectivityCheckTimeout(DEFAULT_INTERNET_CONNECTIVITY_CHECK_TIMEOUT)
-	, m_updatingCertificateAuthorityCertificateStoreFile(false) { }
+	, m_updatingCertificateAuthorityCertificateStoreFile(false)
+	, m_numberOfSubmissionsInProgress(0)
+	, m_scheduler(DEFAULT_MAXIMUM_ACTIVE_REQUESTS, DEFAULT_MAXIMUM_ACTIVE_REQUESTS_PER_HOST)
+	, m_numberOfActiveRequests(0) { }
 
 HTTPService::~HTTPService() {
 	stop();
@@ -99,6 +110,51 @@ void HTTPService::setConfiguration(const HTTPConfiguration & configuration) {
 		m_maximumRedirects = configuration.maximumRedirects.value();
 	}
 
+	if(configuration.httpVersion.has_value()) {
+		m_httpVersion = configuration.httpVersion.value();
+	}
+
+	if(configuration.maximumRetries.has_value()) {
+		m_maximumRetries = configuration.maximumRetries.value();
+	}
+
+	if(configuration.retryBaseDelay.has_value()) {
+		m_retryBaseDelay = configuration.retryBaseDelay.value();
+	}
+
+	if(configuration.retryMaximumDelay.has_value()) {
+		m_retryMaximumDelay = configuration.retryMaximumDelay.value();
+	}
+
+	if(configuration.retryableStatusCodes.has_value()) {
+		m_retryableStatusCodes = configuration.retryableStatusCodes.value();
+	}
+
+	if(configuration.retryNonIdempotentRequests.has_value()) {
+		m_retryNonIdempotentRequests = configuration.retryNonIdempotentRequests.value();
+	}
+
+	if(configuration.maximumActiveRequests.has_value()) {
+		m_scheduler.setMaximumActiveRequests(configuration.maximumActiveRequests.value());
+	}
+
+	if(configuration.maximumActiveRequestsPerHost.has_value()) {
+		m_scheduler.setMaximumActiveRequestsPerHost(configuration.maximumActiveRequestsPerHost.value());
+	}
+
+	if(configuration.cacheDirectoryPath.empty()) {
+		m_cache.reset();
+	}
+	else if(m_cache == nullptr || m_cache->getDirectoryPath() != configuration.cacheDirectoryPath || m_cache->getMaximumSize() != configuration.maximumCacheSize.value_or(HTTPCache::DEFAULT_MAXIMUM_SIZE)) {
+		m_cache = std::make_unique<HTTPCache>(configuration.cacheDirectoryPath, configuration.maximumCacheSize.value_or(HTTPCache::DEFAULT_MAXIMUM_SIZE));
+
+		if(!m_cache->load()) {
+			spdlog::warn("Failed to load HTTP cache from directory: '{}'.", configuration.cacheDirectoryPath);
+		}
+	}
+
+	m_cacheEnabled = m_cache != nullptr;
+
 	{
 		std::lock_guard<std::mutex> internetConnectivityLock(m_internetConnectivityMutex);
 
@@ -149,14 +205,34 @@ void HTTPService::stop() {
 		std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
 		m_stopRequested = true;
-	}
 
-	m_waitCondition.notify_one();
+		wakeUp();
+	}
 
 	m_caCertUpdateThread.reset();
 
 	m_httpThread.reset();
 
+	// submissions which passed the stop check before it was set are waited for, so that their requests are always drained below
+	while(m_numberOfSubmissionsInProgress.load() != 0) {
+		std::this_thread::yield();
+	}
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+		if(m_cache != nullptr) {
+			m_cache->flush(true);
+		}
+	}
+
+	// requests submitted while the service thread was shutting down never reached the scheduler, they have not started connecting and so cannot be aborted
+	std::shared_ptr<HTTPRequest> submittedRequest;
+
+	while((submittedRequest = m_submittedRequests.pop()) != nullptr) {
+		submittedRequest->getResponse()->onTransferError(fmt::format("HTTP service stopped before request #{} could be started.", submittedRequest->getID()));
+	}
+
 	std::lock_guard<std::mutex> internetConnectivityLock(m_internetConnectivityMutex);
 
 	m_connectedToInternet.reset();
@@ -164,35 +240,57 @@ void HTTPService::stop() {
 }
 
 bool HTTPService::hasMaximumActiveRequests() const {
+	return m_scheduler.hasMaximumActiveRequests();
+}
+
+size_t HTTPService::numberOfActiveRequests() const {
+	return m_numberOfActiveRequests.load();
+}
+
+size_t HTTPService::getMaximumActiveRequests() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_activeRequests.size() >= m_maximumActiveRequests;
+	return m_scheduler.getMaximumActiveRequests();
 }
 
-size_t HTTPService::numberOfActiveRequests() const {
+bool HTTPService::setMaximumActiveRequests(size_t maximumActiveRequests) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_activeRequests.size();
+	if(!m_scheduler.setMaximumActiveRequests(maximumActiveRequests)) {
+		return false;
+	}
+
+	wakeUp();
+
+	return true;
 }
 
-size_t HTTPService::getMaximumActiveRequests() const {
+size_t HTTPService::getMaximumActiveRequestsPerHost() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_maximumActiveRequests;
+	return m_scheduler.getMaximumActiveRequestsPerHost();
 }
 
-bool HTTPService::setMaximumActiveRequests(size_t maximumActiveRequests) {
+bool HTTPService::setMaximumActiveRequestsPerHost(size_t maximumActiveRequestsPerHost) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	if(maximumActiveRequests < 1) {
+	if(!m_scheduler.setMaximumActiveRequestsPerHost(maximumActiveRequestsPerHost)) {
 		return false;
 	}
 
-	m_maximumActiveRequests = maximumActiveRequests;
+	wakeUp();
 
 	return true;
 }
 
+size_t HTTPService::numberOfPendingRequests() const {
+	return m_submittedRequests.size() + m_scheduler.numberOfPendingRequests();
+}
+
+HTTPScheduler::Statistics HTTPService::getSchedulerStatistics() const {
+	return m_scheduler.getStatistics();
+}
+
 bool HTTPService::hasBaseURL() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -271,6 +369,18 @@ void HTTPService::clearAuthorization() {
 	m_authorizationToken.clear();
 }
 
+bool HTTPService::hasCache() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_cache != nullptr;
+}
+
+HTTPCache * HTTPService::getCache() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_cache.get();
+}
+
 bool HTTPService::checkForInternetConnectivity(bool force) {
 	std::lock_guard<std::mutex> internetConnectivityLock(m_internetConnectivityMutex);
 
@@ -358,6 +468,12 @@ std::shared_ptr<HTTPRequest> HTTPService::createRequest(HTTPRequest::Method meth
 	newRequest->setNetworkTimeout(m_networkTimeout);
 	newRequest->setMaximumRedirects(m_maximumRedirects);
 	newRequest->setVerboseLoggingEnabled(m_verboseLoggingEnabled);
+	newRequest->setHTTPVersion(m_httpVersion);
+	newRequest->setMaximumRetries(m_maximumRetries);
+	newRequest->setRetryBaseDelay(m_retryBaseDelay);
+	newRequest->setRetryMaximumDelay(m_retryMaximumDelay);
+	newRequest->setRetryableStatusCodes(m_retryableStatusCodes);
+	newRequest->setRetryingNonIdempotentRequestsEnabled(m_retryNonIdempotentRequests);
 
 	if(hasUserAgent()) {
 		newRequest->setUserAgent(m_userAgent);
@@ -373,10 +489,10 @@ std::shared_ptr<HTTPRequest> HTTPService::createRequest(HTTPRequest::Method meth
 }
 
 std::future<std::shared_ptr<HTTPResponse>> HTTPService::sendRequest(std::shared_ptr<HTTPRequest> request) {
-	std::lock_guard<std::recursive_mutex> lock(m_mutex);
-
+	// submission only takes the service lock to consult the response cache, requests are handed over to the service thread through a lock-free queue
 	if(!m_initialized ||
 	   !m_running ||
+	   m_stopRequested ||
 	   request == nullptr ||
 	   request->getService() != this ||
 	   request->isRequestInitiated()) {
@@ -384,9 +500,62 @@ std::future<std::shared_ptr<HTTPResponse>> HTTPService::sendRequest(std::shared_
 	}
 
 	std::shared_ptr<HTTPResponse> response(createResponse(request));
-	request->setResponse(response);
-	m_pendingRequests.push_back(request);
-	m_waitCondition.notify_one();
+	HTTPHeaders::HeaderMap cachedHeaders;
+	std::unique_ptr<ByteBuffer> cachedBody;
+
+	if(m_cacheEnabled) {
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+		if(isCacheable(*request)) {
+			request->m_cacheKey = request->getFormattedURL(m_configuration);
+
+			std::optional<HTTPCache::Entry> optionalCacheEntry(m_cache->getEntry(request->m_cacheKey));
+
+			if(optionalCacheEntry.has_value()) {
+				if(optionalCacheEntry->isFresh()) {
+					cachedBody = m_cache->getBody(optionalCacheEntry.value());
+
+					if(cachedBody != nullptr) {
+						cachedHeaders = std::move(optionalCacheEntry->headers);
+					}
+					else {
+						m_cache->removeEntry(request->m_cacheKey);
+					}
+				}
+				// stale responses are revalidated with a conditional request instead of being downloaded again
+				else if(optionalCacheEntry->hasValidators()) {
+					if(!optionalCacheEntry->getETag().empty()) {
+						request->setHeader(HTTPHeaders::IF_NONE_MATCH_HEADER_NAME, optionalCacheEntry->getETag());
+					}
+
+					if(!optionalCacheEntry->getLastModifiedDate().empty()) {
+						request->setHeader(HTTPHeaders::IF_MODIFIED_SINCE_HEADER_NAME, optionalCacheEntry->getLastModifiedDate());
+					}
+				}
+			}
+		}
+	}
+
+	// completion callbacks for cache hits are dispatched without holding the service lock
+	if(cachedBody != nullptr) {
+		request->setResponse(response);
+		response->onCacheHit(cachedHeaders, std::move(cachedBody));
+
+		return response->getFuture();
+	}
+
+	// the stop flag is checked again while the submission is counted, a request is then either rejected here or drained by stop
+	m_numberOfSubmissionsInProgress++;
+
+	if(m_stopRequested || !request->setResponse(response)) {
+		m_numberOfSubmissionsInProgress--;
+		return {};
+	}
+
+	m_submittedRequests.push(request);
+	m_numberOfSubmissionsInProgress--;
+
+	wakeUp();
 
 	return response->getFuture();
 }
@@ -414,12 +583,19 @@ bool HTTPService::abortRequest(HTTPRequest & request) {
 		return abortRequest(activeRequestIterator->second);
 	}
 
-	std::deque<std::shared_ptr<HTTPRequest>>::const_iterator pendingRequestIterator(std::find_if(m_pendingRequests.cbegin(), m_pendingRequests.cend(), [&request](const std::shared_ptr<HTTPRequest> & pendingRequest) {
-		return pendingRequest.get() == &request;
-	}));
+	std::shared_ptr<HTTPRequest> pendingRequest(m_scheduler.getPendingRequest(request));
+
+	if(pendingRequest != nullptr) {
+		return abortRequest(pendingRequest);
+	}
+
+	// submitted requests which have not been picked up by the service thread yet, or which are waiting to be retried
+	for(const std::weak_ptr<HTTPRequest> & weakRequest : m_requests) {
+		std::shared_ptr<HTTPRequest> sharedRequest(weakRequest.lock());
 
-	if(pendingRequestIterator != m_pendingRequests.cend()) {
-		return abortRequest(*pendingRequestIterator);
+		if(sharedRequest.get() == &request) {
+			return abortRequest(sharedRequest);
+		}
 	}
 
 	return false;
@@ -432,14 +608,108 @@ bool HTTPService::abortRequest(std::shared_ptr<HTTPRequest> request) {
 		return false;
 	}
 
-	m_pendingRequests.erase(std::remove(m_pendingRequests.begin(), m_pendingRequests.end(), request), m_pendingRequests.end());
-	m_activeRequests.erase(request->getCURLEasyHandle().get());
+	m_scheduler.removePendingRequest(*request);
+	m_scheduler.onRequestFinished(*request);
+
+	for(std::multimap<std::chrono::time_point<std::chrono::steady_clock>, std::shared_ptr<HTTPRequest>>::iterator i = m_retryingRequests.begin(); i != m_retryingRequests.end(); ++i) {
+		if(i->second == request) {
+			m_retryingRequests.erase(i);
+			break;
+		}
+	}
+
+	// active transfers are detached from the multi handle by the service thread
 	m_abortedRequests.push_back(request);
-	m_waitCondition.notify_one();
+	wakeUp();
 
 	return true;
 }
 
+void HTTPService::processSubmittedRequest(std::shared_ptr<HTTPRequest> request) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	// the request may have been aborted before the service thread picked it up
+	if(request == nullptr || request->getResponse() == nullptr || request->getResponse()->isDone()) {
+		return;
+	}
+
+	m_scheduler.enqueue(request, request->getFormattedURL(m_configuration));
+}
+
+void HTTPService::dispatchCompletedTransfer(std::shared_ptr<HTTPRequest> request, CURLcode result) {
+	std::optional<std::chrono::milliseconds> optionalRetryDelay(getRetryDelay(*request, result));
+	bool retrying = optionalRetryDelay.has_value() && request->getResponse()->onTransferRetrying();
+
+	// the cache is updated between finishing the body and completing the response so that the service lock is always taken before the response lock
+	if(!retrying && request->getResponse()->onTransferCompleted(HTTPUtilities::isSuccess(result), HTTPUtilities::getCURLErrorCodeName(result))) {
+		updateCache(*request, *request->getResponse());
+		request->getResponse()->onTransferFinished();
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	// requests aborted while their completion was being dispatched are detached by the abort stage instead
+	if(request->isAborted()) {
+		return;
+	}
+
+	if(!HTTPUtilities::isSuccess(curl_multi_remove_handle(m_curlMultiHandle.get(), request->getCURLEasyHandle().get()))) {
+		spdlog::error("Failed to remove CURL easy handle from multi handle.");
+	}
+
+	m_activeRequests.erase(request->getCURLEasyHandle().get());
+	m_numberOfActiveRequests = m_activeRequests.size();
+	m_scheduler.onRequestFinished(*request);
+
+	releaseCURLEasyHandle(request->getCURLEasyHandle());
+	request->closeBody();
+
+	if(retrying) {
+		scheduleRetry(request, optionalRetryDelay.value());
+	}
+}
+
+void HTTPService::wakeUp() {
+	std::lock_guard<std::mutex> curlMultiHandleLock(m_curlMultiHandleMutex);
+
+	if(m_curlMultiHandle != nullptr) {
+		if(!HTTPUtilities::isSuccess(curl_multi_wakeup(m_curlMultiHandle.get()))) {
+			spdlog::error("Failed to wake up cURL multi handle.");
+		}
+	}
+}
+
+HTTPUtilities::CURLEasyHandle HTTPService::acquireCURLEasyHandle() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_curlEasyHandlePool.empty()) {
+		return HTTPUtilities::createCURLEasyHandle();
+	}
+
+	HTTPUtilities::CURLEasyHandle curlEasyHandle(std::move(m_curlEasyHandlePool.back()));
+	m_curlEasyHandlePool.pop_back();
+
+	return curlEasyHandle;
+}
+
+void HTTPService::releaseCURLEasyHandle(HTTPUtilities::CURLEasyHandle & curlEasyHandle) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(curlEasyHandle == nullptr) {
+		return;
+	}
+
+	if(m_curlEasyHandlePool.size() >= m_scheduler.getMaximumActiveRequests()) {
+		curlEasyHandle.reset();
+		return;
+	}
+
+	// resetting clears all request options but keeps the share handle, live connections and session caches associated with the easy handle
+	curl_easy_reset(curlEasyHandle.get());
+
+	m_curlEasyHandlePool.push_back(std::move(curlEasyHandle));
+}
+
 std::shared_ptr<HTTPResponse> HTTPService::createResponse(std::shared_ptr<HTTPRequest> request) {
 	if(request == nullptr || request->getService() != this) {
 		return nullptr;
@@ -450,6 +720,123 @@ std::shared_ptr<HTTPResponse> HTTPService::createResponse(std::shared_ptr<HTTPRe
 	return response;
 }
 
+bool HTTPService::isCacheable(const HTTPRequest & request) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	// only plain buffered requests are served from the cache, conditional or partial requests made by the caller are passed through unchanged
+	// cache entries are shared between all requests, so responses to authorized requests are never stored or served
+	return m_cache != nullptr &&
+		   request.getMethod() == HTTPRequest::Method::Get &&
+		   request.isResponseBodyBuffered() &&
+		   !request.hasAuthorization() &&
+		   !request.hasHeader(HTTPHeaders::IF_NONE_MATCH_HEADER_NAME) &&
+		   !request.hasHeader(HTTPHeaders::IF_MATCH_HEADER_NAME) &&
+		   !request.hasHeader(HTTPHeaders::IF_MODIFIED_SINCE_HEADER_NAME) &&
+		   !request.hasHeader(HTTPHeaders::RANGE_HEADER_NAME);
+}
+
+void HTTPService::updateCache(HTTPRequest & request, HTTPResponse & response) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_cache == nullptr || request.m_cacheKey.empty()) {
+		return;
+	}
+
+	if(response.getStatusCode() == magic_enum::enum_integer(HTTPStatusCode::NotModified)) {
+		std::optional<HTTPCache::Entry> optionalCacheEntry(m_cache->getEntry(request.m_cacheKey));
+
+		if(!optionalCacheEntry.has_value()) {
+			return;
+		}
+
+		std::unique_ptr<ByteBuffer> cachedBody(m_cache->getBody(optionalCacheEntry.value()));
+
+		if(cachedBody == nullptr) {
+			m_cache->removeEntry(request.m_cacheKey);
+			return;
+		}
+
+		m_cache->refresh(request.m_cacheKey, response);
+		response.onCacheRevalidated(optionalCacheEntry->headers, std::move(cachedBody));
+	}
+	else if(response.getStatusCode() == magic_enum::enum_integer(HTTPStatusCode::Ok)) {
+		m_cache->store(request.m_cacheKey, response);
+	}
+}
+
+std::optional<std::chrono::milliseconds> HTTPService::getRetryDelay(const HTTPRequest & request, CURLcode result) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::shared_ptr<HTTPResponse> response(request.getResponse());
+
+	if(m_stopRequested ||
+	   response == nullptr ||
+	   response->isDone() ||
+	   request.getNumberOfAttempts() > request.getMaximumRetries() ||
+	   (!request.isIdempotent() && !request.isRetryingNonIdempotentRequestsEnabled()) ||
+	   !request.isBodyReplayable()) {
+		return {};
+	}
+
+	if(HTTPUtilities::isSuccess(result)) {
+		if(!request.isRetryableStatusCode(response->getStatusCode())) {
+			return {};
+		}
+	}
+	else if(!HTTPUtilities::isTransientError(result)) {
+		return {};
+	}
+
+	// exponential back off with equal jitter, so that clients which failed together do not retry together
+	std::chrono::milliseconds maximumDelay(request.getRetryMaximumDelay());
+	uint8_t backOffExponent = std::min<uint8_t>(request.getNumberOfAttempts() - 1, 16u);
+	std::chrono::milliseconds backOffDelay(std::min(std::chrono::milliseconds(request.getRetryBaseDelay().count() << backOffExponent), maximumDelay));
+	std::chrono::milliseconds delay(backOffDelay / 2 + std::chrono::milliseconds(Utilities::randomInteger(0, static_cast<int>(backOffDelay.count() / 2))));
+
+	std::string retryAfter(response->getHeaderValue(HTTPHeaders::RETRY_AFTER_HEADER_NAME));
+
+	if(!retryAfter.empty()) {
+		std::optional<std::chrono::milliseconds> optionalRetryAfterDelay;
+		std::optional<uint64_t> optionalRetryAfterSeconds(Utilities::parseUnsignedLong(retryAfter));
+
+		if(optionalRetryAfterSeconds.has_value()) {
+			optionalRetryAfterDelay = std::chrono::seconds(optionalRetryAfterSeconds.value());
+		}
+		else {
+			time_t retryAfterTime = curl_getdate(retryAfter.c_str(), nullptr);
+
+			if(retryAfterTime != -1) {
+				optionalRetryAfterDelay = std::max(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::from_time_t(retryAfterTime) - std::chrono::system_clock::now()), 0ms);
+			}
+		}
+
+		if(optionalRetryAfterDelay.has_value()) {
+			// give up instead of blocking the request for longer than allowed
+			if(optionalRetryAfterDelay.value() > maximumDelay) {
+				return {};
+			}
+
+			delay = std::max(delay, optionalRetryAfterDelay.value());
+		}
+	}
+
+	return delay;
+}
+
+bool HTTPService::scheduleRetry(std::shared_ptr<HTTPRequest> request, std::chrono::milliseconds delay) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(request == nullptr || !request->resetTransfer()) {
+		return false;
+	}
+
+	spdlog::debug("Retrying request #{} to '{}' in {} ms (attempt {} of {}).", request->getID(), request->getUrl(), delay.count(), request->getNumberOfAttempts() + 1, request->getMaximumRetries() + 1);
+
+	m_retryingRequests.emplace(std::chrono::steady_clock::now() + delay, request);
+
+	return true;
+}
+
 void HTTPService::runCertificateAuthorityCertificateStoreFileUpdate(std::shared_ptr<std::promise<bool>> promise, const std::string & caCertFilePath, bool force) {
 	if(!m_initialized || !m_running) {
 		promise->set_value(false);
@@ -518,6 +905,7 @@ void HTTPService::runCertificateAuthorityCertificateStoreFileUpdate(std::shared_
 	}
 
 	std::shared_ptr<HTTPRequest> caCertFileRequest(createRequest(HTTPRequest::Method::Get, Utilities::joinPaths(CERTIFICATE_AUTHORITY_CERTIFICATE_PAGE_BASE_URL, CERTIFICATE_AUTHORITY_CERTIFICATE_STORE_FILE_NAME)));
+	caCertFileRequest->addResponseBodyHashType(ByteBuffer::HashType::SHA256);
 
 	std::shared_ptr<HTTPResponse> caCertFileResponse(sendRequestAndWait(caCertFileRequest));
 
@@ -571,6 +959,11 @@ void HTTPService::run() {
 
 	HTTPUtilities::CURLMultiHandle curlMultiHandle;
 	HTTPUtilities::CURLSharedHandle curlSharedHandle;
+	static constexpr std::array<curl_lock_data, 3> SHARED_DATA_TYPES = {
+		CURL_LOCK_DATA_DNS,
+		CURL_LOCK_DATA_SSL_SESSION,
+		CURL_LOCK_DATA_CONNECT
+	};
 
 	if((curlMultiHandle = HTTPUtilities::createCURLMultiHandle()) == nullptr) {
 		m_running = false;
@@ -582,64 +975,155 @@ void HTTPService::run() {
 		return;
 	}
 
+	// share resolved host names, TLS sessions and open connections between all requests so that repeated requests to the same host can skip the handshakes
+	// all easy handles are only ever driven from this thread, so the share handle does not require lock callbacks
+	for(curl_lock_data sharedDataType : SHARED_DATA_TYPES) {
+		if(!HTTPUtilities::isSuccess(curl_share_setopt(curlSharedHandle.get(), CURLSHOPT_SHARE, sharedDataType), fmt::format("Failed to enable sharing of cURL data type '{}'.", magic_enum::enum_name(sharedDataType)))) {
+			m_running = false;
+			return;
+		}
+	}
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+		// multiplex concurrent requests to the same host over a single HTTP/2 connection instead of opening one connection per request
+		if(!HTTPUtilities::isSuccess(curl_multi_setopt(curlMultiHandle.get(), CURLMOPT_PIPELINING, m_configuration.multiplexingEnabled ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING), "Failed to configure cURL multi handle multiplexing.")) {
+			m_running = false;
+			return;
+		}
+
+		if(m_configuration.multiplexingEnabled && m_configuration.maximumConcurrentStreams.has_value()) {
+			HTTPUtilities::isSuccess(curl_multi_setopt(curlMultiHandle.get(), CURLMOPT_MAX_CONCURRENT_STREAMS, static_cast<long>(m_configuration.maximumConcurrentStreams.value())), fmt::format("Failed to set cURL multi handle maximum concurrent streams to {}.", m_configuration.maximumConcurrentStreams.value()));
+		}
+
+		std::lock_guard<std::mutex> curlMultiHandleLock(m_curlMultiHandleMutex);
+
+		m_curlMultiHandle = std::move(curlMultiHandle);
+		m_curlSharedHandle = std::move(curlSharedHandle);
+	}
+
+	std::shared_ptr<HTTPRequest> submittedRequest;
 	std::shared_ptr<HTTPRequest> pendingRequest;
-	std::shared_ptr<HTTPRequest> abortedRequest;
+	std::deque<std::shared_ptr<HTTPRequest>> abortedRequests;
+	std::vector<std::shared_ptr<HTTPRequest>> failedRequests;
+	std::vector<std::pair<std::shared_ptr<HTTPRequest>, CURLcode>> completedTransfers;
 	int32_t numberOfRunningHandles = 0;
-	int32_t totalNumberOfFileDescriptors = 0;
 
+	// the service lock is only held for book keeping, never while cURL performs network I/O or while completion callbacks are dispatched
 	while(true) {
-		std::unique_lock<std::recursive_mutex> lock(m_mutex);
+		while((submittedRequest = m_submittedRequests.pop()) != nullptr) {
+			processSubmittedRequest(submittedRequest);
+		}
 
-		if(m_stopRequested) {
-			while(!m_pendingRequests.empty()) {
-				pendingRequest = m_pendingRequests.front();
-				m_pendingRequests.pop_front();
-				abortRequest(pendingRequest);
-				pendingRequest.reset();
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+			if(m_stopRequested) {
+				for(std::shared_ptr<HTTPRequest> & cancelledRequest : m_scheduler.clear()) {
+					abortRequest(cancelledRequest);
+				}
+
+				std::multimap<std::chrono::time_point<std::chrono::steady_clock>, std::shared_ptr<HTTPRequest>> retryingRequests;
+				retryingRequests.swap(m_retryingRequests);
+
+				for(std::multimap<std::chrono::time_point<std::chrono::steady_clock>, std::shared_ptr<HTTPRequest>>::iterator i = retryingRequests.begin(); i != retryingRequests.end(); ++i) {
+					abortRequest(i->second);
+				}
+
+				for(std::map<CURL *, std::shared_ptr<HTTPRequest>>::iterator i = m_activeRequests.begin(); i != m_activeRequests.end(); ++i) {
+					abortRequest(i->second);
+				}
 			}
 
-			for(std::map<CURL *, std::shared_ptr<HTTPRequest>>::iterator i = m_activeRequests.begin(); i != m_activeRequests.end(); ++i) {
-				abortRequest(i->second);
+			m_requests.erase(std::remove_if(m_requests.begin(), m_requests.end(), [](const std::weak_ptr<HTTPRequest> & request) {
+				return request.expired();
+			}), m_requests.end());
+
+			// requests waiting to be retried stay out of the scheduler until their back off delay has elapsed
+			std::chrono::time_point<std::chrono::steady_clock> currentSteadyTimePoint(std::chrono::steady_clock::now());
+
+			while(!m_retryingRequests.empty() && m_retryingRequests.begin()->first <= currentSteadyTimePoint) {
+				m_scheduler.enqueue(m_retryingRequests.begin()->second, m_retryingRequests.begin()->second->getFormattedURL(m_configuration));
+				m_retryingRequests.erase(m_retryingRequests.begin());
 			}
 
-			m_activeRequests.clear();
-		}
+			while((pendingRequest = m_scheduler.dequeue()) != nullptr) {
+				pendingRequest->getResponse()->setState(HTTPResponse::State::Connecting);
 
-		std::vector<std::weak_ptr<HTTPRequest>>::const_iterator newRequestEnd(std::remove_if(m_requests.begin(), m_requests.end(), [](const std::weak_ptr<HTTPRequest> & request) {
-			return request.expired();
-		}));
-
-		while(!m_pendingRequests.empty() && !hasMaximumActiveRequests()) {
-			pendingRequest = m_pendingRequests.front();
-			m_pendingRequests.pop_front();
-			pendingRequest->getResponse()->setState(HTTPResponse::State::Connecting);
-			pendingRequest->startTransfer(m_configuration, curlMultiHandle);
-			m_activeRequests[pendingRequest->getCURLEasyHandle().get()] = pendingRequest;
-			pendingRequest.reset();
-		}
+				// requests which could not be started are never attached to the multi handle
+				if(!pendingRequest->startTransfer(m_configuration, acquireCURLEasyHandle(), m_curlSharedHandle, m_curlMultiHandle)) {
+					m_scheduler.onRequestFinished(*pendingRequest);
+					releaseCURLEasyHandle(pendingRequest->getCURLEasyHandle());
+					pendingRequest->closeBody();
+					failedRequests.push_back(std::move(pendingRequest));
+					continue;
+				}
 
-		while(!m_abortedRequests.empty()) {
-			abortedRequest = m_abortedRequests.front();
-			m_abortedRequests.pop_front();
+				m_activeRequests[pendingRequest->getCURLEasyHandle().get()] = pendingRequest;
+				pendingRequest.reset();
+			}
 
-			if(!HTTPUtilities::isSuccess(curl_multi_remove_handle(curlMultiHandle.get(), abortedRequest->getCURLEasyHandle().get()))) {
-				spdlog::error("Failed to remove CURL easy handle from multi handle.");
+			abortedRequests.swap(m_abortedRequests);
+
+			for(const std::shared_ptr<HTTPRequest> & abortedRequest : abortedRequests) {
+				if(abortedRequest->getCURLEasyHandle() != nullptr) {
+					m_activeRequests.erase(abortedRequest->getCURLEasyHandle().get());
+				}
+			}
+
+			m_numberOfActiveRequests = m_activeRequests.size();
+		}
+
+		for(std::shared_ptr<HTTPRequest> & abortedRequest : abortedRequests) {
+			// requests aborted before their transfer started are not attached to the multi handle
+			if(abortedRequest->getCURLEasyHandle() != nullptr) {
+				if(!HTTPUtilities::isSuccess(curl_multi_remove_handle(m_curlMultiHandle.get(), abortedRequest->getCURLEasyHandle().get()))) {
+					spdlog::error("Failed to remove CURL easy handle from multi handle.");
+				}
 			}
 
 			abortedRequest->getResponse()->onTransferAborted();
 
-			abortedRequest->getCURLEasyHandle().reset();
-			abortedRequest.reset();
+			releaseCURLEasyHandle(abortedRequest->getCURLEasyHandle());
+			abortedRequest->closeBody();
+		}
+
+		abortedRequests.clear();
+
+		for(std::shared_ptr<HTTPRequest> & failedRequest : failedRequests) {
+			failedRequest->getResponse()->onTransferError(fmt::format("Failed to start request #{} transfer.", failedRequest->getID()));
 		}
 
+		failedRequests.clear();
+
 		if(m_stopRequested) {
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+			// every easy handle must be detached from the share handle before it can be cleaned up
+			for(std::map<CURL *, std::shared_ptr<HTTPRequest>>::iterator i = m_activeRequests.begin(); i != m_activeRequests.end(); ++i) {
+				if(!HTTPUtilities::isSuccess(curl_multi_remove_handle(m_curlMultiHandle.get(), i->first))) {
+					spdlog::error("Failed to remove CURL easy handle from multi handle.");
+				}
+
+				i->second->getCURLEasyHandle().reset();
+			}
+
+			m_activeRequests.clear();
+			m_numberOfActiveRequests = 0;
+			m_curlEasyHandlePool.clear();
+
+			std::lock_guard<std::mutex> curlMultiHandleLock(m_curlMultiHandleMutex);
+
+			m_curlMultiHandle.reset();
+			m_curlSharedHandle.reset();
+
 			return;
 		}
 
-		curl_multi_wait(curlMultiHandle.get(), nullptr, 0, 100, &totalNumberOfFileDescriptors);
-
+		// active requests are only ever added or removed by this thread, so they can be read without the service lock
 		if(!m_activeRequests.empty()) {
-			if(!HTTPUtilities::isSuccess(curl_multi_perform(curlMultiHandle.get(), &numberOfRunningHandles))) {
+			if(!HTTPUtilities::isSuccess(curl_multi_perform(m_curlMultiHandle.get(), &numberOfRunningHandles))) {
 				spdlog::error("Failed to execute 'curl_multi_perform'.");
 			}
 
@@ -647,7 +1131,7 @@ void HTTPService::run() {
 			int32_t numberOfMessagesInQueue = 0;
 
 			while(true) {
-				curlMessage = curl_multi_info_read(curlMultiHandle.get(), &numberOfMessagesInQueue);
+				curlMessage = curl_multi_info_read(m_curlMultiHandle.get(), &numberOfMessagesInQueue);
 
 				if(curlMessage == nullptr) {
 					break;
@@ -663,47 +1147,73 @@ void HTTPService::run() {
 					continue;
 				}
 
-				std::shared_ptr<HTTPRequest> completedRequest(completedRequestIterator->second);
-
-				if(completedRequest == nullptr) {
+				if(completedRequestIterator->second == nullptr) {
 					spdlog::error("Could not find completed request using cURL easy handle!");
 					continue;
 				}
 
-				completedRequest->getResponse()->onTransferCompleted(HTTPUtilities::isSuccess(curlMessage->data.result), HTTPUtilities::getCURLErrorCodeName(curlMessage->data.result));
-
-				if(!HTTPUtilities::isSuccess(curl_multi_remove_handle(curlMultiHandle.get(), curlMessage->easy_handle))) {
-					spdlog::error("Failed to remove CURL easy handle from multi handle.");
-				}
-
-				m_activeRequests.erase(curlMessage->easy_handle);
+				completedTransfers.emplace_back(completedRequestIterator->second, curlMessage->data.result);
+			}
 
-				completedRequest->getCURLEasyHandle().reset();
+			for(std::pair<std::shared_ptr<HTTPRequest>, CURLcode> & completedTransfer : completedTransfers) {
+				dispatchCompletedTransfer(completedTransfer.first, completedTransfer.second);
 			}
+
+			completedTransfers.clear();
 		}
 
 		if(!m_activeRequests.empty()) {
-			std::vector<CURL *> timedOutRequestCURLEasyHandles;
+			std::vector<std::shared_ptr<HTTPRequest>> timedOutRequests;
 
 			for(std::map<CURL *, std::shared_ptr<HTTPRequest>>::iterator i = m_activeRequests.begin(); i != m_activeRequests.end(); ++i) {
 				if(i->second->getResponse()->checkTimeouts()) {
-					timedOutRequestCURLEasyHandles.push_back(i->first);
+					timedOutRequests.push_back(i->second);
 				}
 			}
 
-			for(CURL * curlEasyHandle : timedOutRequestCURLEasyHandles) {
-				m_activeRequests.erase(curlEasyHandle);
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+			// timed out transfers must also be detached from the multi handle, otherwise their sockets keep waking up the poll
+			for(std::shared_ptr<HTTPRequest> & timedOutRequest : timedOutRequests) {
+				m_activeRequests.erase(timedOutRequest->getCURLEasyHandle().get());
+				m_scheduler.onRequestFinished(*timedOutRequest);
+
+				if(!HTTPUtilities::isSuccess(curl_multi_remove_handle(m_curlMultiHandle.get(), timedOutRequest->getCURLEasyHandle().get()))) {
+					spdlog::error("Failed to remove CURL easy handle from multi handle.");
+				}
+
+				releaseCURLEasyHandle(timedOutRequest->getCURLEasyHandle());
+				timedOutRequest->closeBody();
 			}
-		}
 
-		if(m_activeRequests.empty() && m_pendingRequests.empty() && m_abortedRequests.empty()) {
-			m_waitCondition.wait(lock);
+			m_numberOfActiveRequests = m_activeRequests.size();
 		}
-		else if(!m_pendingRequests.empty() || !m_abortedRequests.empty()) {
-			std::this_thread::sleep_for(10ms);
+
+		std::chrono::milliseconds pollDuration(IDLE_POLL_DURATION);
+
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+			if(m_cache != nullptr) {
+				m_cache->flush();
+			}
+
+			if(!m_submittedRequests.isEmpty() || !m_abortedRequests.empty() || m_scheduler.hasSchedulableRequest()) {
+				continue;
+			}
+
+			if(!m_activeRequests.empty()) {
+				pollDuration = MAXIMUM_POLL_DURATION;
+			}
+
+			if(!m_retryingRequests.empty()) {
+				pollDuration = std::clamp(std::chrono::duration_cast<std::chrono::milliseconds>(m_retryingRequests.begin()->first - std::chrono::steady_clock::now()), 0ms, pollDuration);
+			}
 		}
-		else {
-			std::this_thread::sleep_for(30ms);
+
+		// returns as soon as a transfer socket is ready, cURL needs to handle an internal timeout, or another thread wakes the multi handle up
+		if(!HTTPUtilities::isSuccess(curl_multi_poll(m_curlMultiHandle.get(), nullptr, 0, static_cast<int>(pollDuration.count()), nullptr))) {
+			spdlog::error("Failed to execute 'curl_multi_poll'.");
 		}
 	}
 }
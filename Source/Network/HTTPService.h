@@ -1,23 +1,28 @@
 #ifndef _HTTP_SERVICE_H_
 #define _HTTP_SERVICE_H_
 
+#include "HTTPCache.h"
 #include "HTTPConfiguration.h"
 #include "HTTPRequest.h"
 #include "HTTPResponse.h"
+#include "HTTPScheduler.h"
 #include "HTTPStatusCode.h"
 #include "HTTPRequestSettings.h"
+#include "HTTPSubmissionQueue.h"
 #include "HTTPUtilities.h"
 #include "Singleton/Singleton.h"
 
 #include <curl/curl.h>
 
+#include <atomic>
 #include <cstdint>
 #include <chrono>
-#include <condition_variable>
 #include <deque>
 #include <future>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <vector>
@@ -26,6 +31,7 @@ class HTTPService final
 	: public Singleton<HTTPService>
 	, public HTTPRequestSettings {
 	friend class FactoryRegistry;
+	friend class HTTPResponse;
 
 public:
 	~HTTPService() override;
@@ -41,6 +47,10 @@ public:
 	size_t numberOfActiveRequests() const;
 	size_t getMaximumActiveRequests() const;
 	bool setMaximumActiveRequests(size_t maximumActiveRequests);
+	size_t getMaximumActiveRequestsPerHost() const;
+	bool setMaximumActiveRequestsPerHost(size_t maximumActiveRequestsPerHost);
+	size_t numberOfPendingRequests() const;
+	HTTPScheduler::Statistics getSchedulerStatistics() const;
 	bool hasBaseURL() const;
 	std::string getBaseURL() const;
 	void setBaseURL(const std::string & baseURL);
@@ -54,6 +64,8 @@ public:
 	void setAuthorization(const std::string & bearerToken);
 	void setAuthorization(const std::string & userName, const std::string & password);
 	void clearAuthorization();
+	bool hasCache() const;
+	HTTPCache * getCache() const;
 	bool checkForInternetConnectivity(bool force = false);
 	std::string getCertificateAuthorityCertificateStoreFilePath() const;
 	bool hasCertificateAuthorityCertificateStoreFile() const;
@@ -66,12 +78,15 @@ public:
 	bool abortRequest(std::shared_ptr<HTTPRequest> request);
 
 	static const size_t DEFAULT_MAXIMUM_ACTIVE_REQUESTS;
+	static const size_t DEFAULT_MAXIMUM_ACTIVE_REQUESTS_PER_HOST;
 	static const std::string CERTIFICATE_AUTHORITY_CERTIFICATE_PAGE_BASE_URL;
 	static const std::string CERTIFICATE_AUTHORITY_CERTIFICATE_STORE_FILE_NAME;
 	static const std::string CERTIFICATE_AUTHORITY_CERTIFICATE_STORE_SHA256_FILE_NAME_SUFFIX;
 	static const std::string INTERNET_CONNECTIVITY_CHECK_URL;
 	static const std::chrono::seconds DEFAULT_INTERNET_CONNECTIVITY_CHECK_INTERVAL;
 	static const std::chrono::seconds DEFAULT_INTERNET_CONNECTIVITY_CHECK_TIMEOUT;
+	static const std::chrono::milliseconds MAXIMUM_POLL_DURATION;
+	static const std::chrono::milliseconds IDLE_POLL_DURATION;
 
 private:
 	using HTTPThread = std::unique_ptr<std::thread, std::function<void (std::thread *)>>;
@@ -81,13 +96,22 @@ private:
 
 	void runCertificateAuthorityCertificateStoreFileUpdate(std::shared_ptr<std::promise<bool>> promise, const std::string & caCertFilePath, bool force);
 	void run();
+	void processSubmittedRequest(std::shared_ptr<HTTPRequest> request);
+	void dispatchCompletedTransfer(std::shared_ptr<HTTPRequest> request, CURLcode result);
+	void wakeUp();
+	HTTPUtilities::CURLEasyHandle acquireCURLEasyHandle();
+	void releaseCURLEasyHandle(HTTPUtilities::CURLEasyHandle & curlEasyHandle);
 	std::shared_ptr<HTTPResponse> createResponse(std::shared_ptr<HTTPRequest> request);
+	bool isCacheable(const HTTPRequest & request) const;
+	void updateCache(HTTPRequest & request, HTTPResponse & response);
+	std::optional<std::chrono::milliseconds> getRetryDelay(const HTTPRequest & request, CURLcode result) const;
+	bool scheduleRetry(std::shared_ptr<HTTPRequest> request, std::chrono::milliseconds delay);
 
-	bool m_initialized;
-	bool m_running;
-	bool m_stopRequested;
+	std::atomic<bool> m_initialized;
+	std::atomic<bool> m_running;
+	std::atomic<bool> m_stopRequested;
+	std::atomic<bool> m_cacheEnabled;
 	HTTPConfiguration m_configuration;
-	size_t m_maximumActiveRequests;
 	std::string m_baseURL;
 	std::string m_userAgent;
 	std::string m_authorizationToken;
@@ -100,11 +124,19 @@ private:
 	bool m_updatingCertificateAuthorityCertificateStoreFile;
 	CACertUpdateThread m_caCertUpdateThread;
 	std::vector<std::weak_ptr<HTTPRequest>> m_requests;
-	std::deque<std::shared_ptr<HTTPRequest>> m_pendingRequests;
+	HTTPSubmissionQueue m_submittedRequests;
+	std::atomic<size_t> m_numberOfSubmissionsInProgress;
+	HTTPScheduler m_scheduler;
 	std::deque<std::shared_ptr<HTTPRequest>> m_abortedRequests;
+	std::multimap<std::chrono::time_point<std::chrono::steady_clock>, std::shared_ptr<HTTPRequest>> m_retryingRequests;
 	std::map<CURL *, std::shared_ptr<HTTPRequest>> m_activeRequests;
+	std::atomic<size_t> m_numberOfActiveRequests;
+	HTTPUtilities::CURLMultiHandle m_curlMultiHandle;
+	HTTPUtilities::CURLSharedHandle m_curlSharedHandle;
+	std::vector<HTTPUtilities::CURLEasyHandle> m_curlEasyHandlePool;
+	std::unique_ptr<HTTPCache> m_cache;
 	mutable std::recursive_mutex m_mutex;
-	mutable std::condition_variable_any m_waitCondition;
+	mutable std::mutex m_curlMultiHandleMutex;
 
 	HTTPService(const HTTPService &) = delete;
 	const HTTPService & operator = (const HTTPService &) = delete;
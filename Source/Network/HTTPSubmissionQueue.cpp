@@ -0,0 +1,61 @@
+#include "HTTPSubmissionQueue.h"
+
+#include "HTTPRequest.h"
+
+HTTPSubmissionQueue::Node::Node(std::shared_ptr<HTTPRequest> request)
+	: request(std::move(request))
+	, next(nullptr) { }
+
+HTTPSubmissionQueue::HTTPSubmissionQueue()
+	: m_head(new Node())
+	, m_size(0) {
+	m_tail = m_head.load(std::memory_order_relaxed);
+}
+
+HTTPSubmissionQueue::~HTTPSubmissionQueue() {
+	while(pop() != nullptr) { }
+
+	delete m_tail;
+}
+
+bool HTTPSubmissionQueue::isEmpty() const {
+	return m_size.load(std::memory_order_acquire) == 0;
+}
+
+size_t HTTPSubmissionQueue::size() const {
+	return m_size.load(std::memory_order_acquire);
+}
+
+void HTTPSubmissionQueue::push(std::shared_ptr<HTTPRequest> request) {
+	if(request == nullptr) {
+		return;
+	}
+
+	Node * node = new Node(std::move(request));
+
+	// counted before it is linked so that the size never drops below zero when the consumer races ahead
+	m_size.fetch_add(1, std::memory_order_release);
+
+	Node * previousNode = m_head.exchange(node, std::memory_order_acq_rel);
+	previousNode->next.store(node, std::memory_order_release);
+}
+
+std::shared_ptr<HTTPRequest> HTTPSubmissionQueue::pop() {
+	Node * tail = m_tail;
+	Node * next = tail->next.load(std::memory_order_acquire);
+
+	// either empty, or a producer has swapped the head but not linked its node yet, in which case it is picked up on the next pop
+	if(next == nullptr) {
+		return nullptr;
+	}
+
+	m_tail = next;
+
+	std::shared_ptr<HTTPRequest> request(std::move(next->request));
+
+	delete tail;
+
+	m_size.fetch_sub(1, std::memory_order_acq_rel);
+
+	return request;
+}
@@ -0,0 +1,38 @@
+#ifndef _HTTP_SUBMISSION_QUEUE_H_
+#define _HTTP_SUBMISSION_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+class HTTPRequest;
+
+// lock-free multiple producer, single consumer queue
+// any thread may push, but only the HTTP service thread may pop
+class HTTPSubmissionQueue final {
+public:
+	HTTPSubmissionQueue();
+	~HTTPSubmissionQueue();
+
+	bool isEmpty() const;
+	size_t size() const;
+	void push(std::shared_ptr<HTTPRequest> request);
+	std::shared_ptr<HTTPRequest> pop();
+
+private:
+	struct Node {
+		Node(std::shared_ptr<HTTPRequest> request = nullptr);
+
+		std::shared_ptr<HTTPRequest> request;
+		std::atomic<Node *> next;
+	};
+
+	std::atomic<Node *> m_head;
+	Node * m_tail;
+	std::atomic<size_t> m_size;
+
+	HTTPSubmissionQueue(const HTTPSubmissionQueue &) = delete;
+	const HTTPSubmissionQueue & operator = (const HTTPSubmissionQueue &) = delete;
+};
+
+#endif // _HTTP_SUBMISSION_QUEUE_H_
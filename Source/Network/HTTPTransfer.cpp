@@ -80,25 +80,25 @@ ByteBuffer * HTTPTransfer::getBody() {
 std::string HTTPTransfer::getBodyMD5(ByteBuffer::HashFormat hashFormat) const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_body->getMD5(hashFormat);
+	return getBodyHash(ByteBuffer::HashType::MD5, hashFormat);
 }
 
 std::string HTTPTransfer::getBodySHA1(ByteBuffer::HashFormat hashFormat) const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_body->getSHA1(hashFormat);
+	return getBodyHash(ByteBuffer::HashType::SHA1, hashFormat);
 }
 
 std::string HTTPTransfer::getBodySHA256(ByteBuffer::HashFormat hashFormat) const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_body->getSHA256(hashFormat);
+	return getBodyHash(ByteBuffer::HashType::SHA256, hashFormat);
 }
 
 std::string HTTPTransfer::getBodySHA512(ByteBuffer::HashFormat hashFormat) const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_body->getSHA512(hashFormat);
+	return getBodyHash(ByteBuffer::HashType::SHA512, hashFormat);
 }
 
 std::string HTTPTransfer::getBodyHash(ByteBuffer::HashType hashType, ByteBuffer::HashFormat hashFormat) const {
@@ -204,7 +204,11 @@ bool HTTPTransfer::setBody(const rapidjson::Document & jsonDocument, bool update
 		return false;
 	}
 
-	m_body->setData(Utilities::valueToString(jsonDocument, false));
+	// serialize directly into the body instead of through an intermediate string
+	rapidjson::StringBuffer stringBuffer;
+	rapidjson::Writer<rapidjson::StringBuffer> stringBufferWriter(stringBuffer);
+	jsonDocument.Accept(stringBufferWriter);
+	m_body->setData(reinterpret_cast<const uint8_t *>(stringBuffer.GetString()), stringBuffer.GetSize());
 
 	if(updateContentType) {
 		setContentType(APPLICATION_JSON_CONTENT_TYPE);
@@ -3,6 +3,7 @@
 #include "HTTPStatusCode.h"
 #include "Utilities/StringUtilities.h"
 
+#include <fmt/core.h>
 #include <magic_enum/magic_enum.hpp>
 #include <spdlog/spdlog.h>
 
@@ -273,6 +274,30 @@ bool HTTPUtilities::isSuccess(CURLcode code, const std::string & errorMessage) {
 	return true;
 }
 
+bool HTTPUtilities::isTransientError(CURLcode code) {
+	switch(code) {
+		case CURLE_COULDNT_RESOLVE_PROXY:
+		case CURLE_COULDNT_RESOLVE_HOST:
+		case CURLE_COULDNT_CONNECT:
+		case CURLE_HTTP2:
+		case CURLE_PARTIAL_FILE:
+		case CURLE_OPERATION_TIMEDOUT:
+		case CURLE_SSL_CONNECT_ERROR:
+		case CURLE_GOT_NOTHING:
+		case CURLE_SEND_ERROR:
+		case CURLE_RECV_ERROR:
+		case CURLE_HTTP2_STREAM:
+		case CURLE_HTTP3:
+		case CURLE_QUIC_CONNECT_ERROR: {
+			return true;
+		}
+
+		default: {
+			return false;
+		}
+	}
+}
+
 bool HTTPUtilities::isSuccess(CURLMcode code, const std::string & errorMessage) {
 	if(code != CURLM_OK) {
 		if(!errorMessage.empty()) {
@@ -331,6 +356,46 @@ std::string HTTPUtilities::easyEscape(CURL * handle, std::string_view url) {
 	return std::string(escapedURL.get());
 }
 
+std::string HTTPUtilities::getHostName(const std::string & url, bool includePort) {
+	if(url.empty()) {
+		return {};
+	}
+
+	std::unique_ptr<CURLU, std::function<void (CURLU *)>> curlURL(curl_url(), [](CURLU * curlURL) {
+		curl_url_cleanup(curlURL);
+	});
+
+	if(curlURL == nullptr || curl_url_set(curlURL.get(), CURLUPART_URL, url.c_str(), CURLU_DEFAULT_SCHEME) != CURLUE_OK) {
+		return {};
+	}
+
+	char * rawHostName = nullptr;
+
+	if(curl_url_get(curlURL.get(), CURLUPART_HOST, &rawHostName, 0) != CURLUE_OK) {
+		return {};
+	}
+
+	std::unique_ptr<char, std::function<void (char *)>> hostName(rawHostName, [](char * hostName) {
+		curl_free(hostName);
+	});
+
+	if(!includePort) {
+		return Utilities::toLowerCase(hostName.get());
+	}
+
+	char * rawPort = nullptr;
+
+	if(curl_url_get(curlURL.get(), CURLUPART_PORT, &rawPort, CURLU_DEFAULT_PORT) != CURLUE_OK) {
+		return Utilities::toLowerCase(hostName.get());
+	}
+
+	std::unique_ptr<char, std::function<void (char *)>> port(rawPort, [](char * port) {
+		curl_free(port);
+	});
+
+	return fmt::format("{}:{}", Utilities::toLowerCase(hostName.get()), port.get());
+}
+
 HTTPUtilities::CURLStringList HTTPUtilities::createCURLStringList() {
 	return CURLStringList(nullptr, [](curl_slist * curlStringList) {
 		curl_slist_free_all(curlStringList);
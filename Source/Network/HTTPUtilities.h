@@ -23,10 +23,12 @@ namespace HTTPUtilities {
 	bool isSuccess(CURLcode code, const std::string & errorMessage = {});
 	bool isSuccess(CURLMcode code, const std::string & errorMessage = {});
 	bool isSuccess(CURLSHcode code, const std::string & errorMessage = {});
+	bool isTransientError(CURLcode code);
 	CURLEasyHandle createCURLEasyHandle();
 	CURLMultiHandle createCURLMultiHandle();
 	CURLSharedHandle createCURLSharedHandle();
 	std::string easyEscape(CURL * handle, std::string_view url);
+	std::string getHostName(const std::string & url, bool includePort = false);
 	CURLStringList createCURLStringList();
 	bool appendToCURLStringList(CURLStringList & curlStringList, const std::string & string);
 	CURLStringList copyCURLStringList(const CURLStringList & curlStringList);
@@ -57,6 +57,8 @@ bool TimeZoneDataManagerWindows::platformInitialize(const std::string & dataDire
 		request->setIfNoneMatchETag(windowsTimeZoneFileETag);
 	}
 
+	request->setResponseBodyFilePath(windowsTimeZoneFilePath);
+
 	std::shared_ptr<HTTPResponse> response(httpService->sendRequestAndWait(request));
 
 	if(response == nullptr || response->isFailure()) {
@@ -80,11 +82,6 @@ bool TimeZoneDataManagerWindows::platformInitialize(const std::string & dataDire
 
 	spdlog::debug("Windows time zone data file downloaded successfully after {} ms.", response->getRequestDuration().value().count());
 
-	if(!response->getBody()->writeTo(windowsTimeZoneFilePath, true)) {
-		spdlog::error("Failed to write Windows time zone data file to: '{}'.", windowsTimeZoneFilePath);
-		return windowsTimeZoneDataFileExists;
-	}
-
 	if(updated != nullptr) {
 		*updated = true;
 	}
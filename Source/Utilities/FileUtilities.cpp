@@ -1,5 +1,7 @@
 #include "FileUtilities.h"
 
+#include "Hasher.h"
+#include "MemoryMappedFile.h"
 #include "StringUtilities.h"
 
 #include <ByteBuffer.h>
@@ -360,30 +362,78 @@ std::string Utilities::getFileSHA512Hash(const std::string & filePath, ByteBuffe
 }
 
 std::string Utilities::getFileHash(const std::string & filePath, ByteBuffer::HashType hashType, ByteBuffer::HashFormat hashFormat) {
-	std::ifstream inputFileStream(filePath, std::ios::binary | std::ios::ate);
+	Hasher hasher(hashType);
 
-	if(!inputFileStream.is_open()) {
-		spdlog::error("Failed to open file '{}' for hashing.", filePath);
+	if(!hashFile(filePath, hasher)) {
 		return {};
 	}
 
-	std::streampos fileEnd = inputFileStream.tellg();
-	inputFileStream.seekg(0, std::ios::beg);
-	size_t fileSize = std::size_t(fileEnd - inputFileStream.tellg());
-
-	if(fileSize == 0) {
+	if(hasher.getNumberOfBytesHashed() == 0) {
 		spdlog::debug("File '{}' is empty, skipping hashing.", filePath);
 		return {};
 	}
 
-	ByteBuffer fileData(fileSize);
+	return hasher.getHash(hashType, hashFormat);
+}
+
+std::map<ByteBuffer::HashType, std::string> Utilities::getFileHashes(const std::string & filePath, const std::vector<ByteBuffer::HashType> & hashTypes, ByteBuffer::HashFormat hashFormat) {
+	// every digest is computed in a single pass over the file
+	Hasher hasher(hashTypes);
 
-	if(!inputFileStream.read(reinterpret_cast<char *>(fileData.getRawData()), fileData.getSize())) {
-		spdlog::error("Failed to read file '{}', skipping hashing.", filePath);
+	if(!hasher.hasHashTypes() || !hashFile(filePath, hasher)) {
+		return {};
+	}
+
+	if(hasher.getNumberOfBytesHashed() == 0) {
+		spdlog::debug("File '{}' is empty, skipping hashing.", filePath);
 		return {};
 	}
 
-	return fileData.getHash(hashType, hashFormat);
+	return hasher.getHashes(hashFormat);
+}
+
+bool Utilities::hashFile(const std::string & filePath, Hasher & hasher) {
+	static constexpr size_t READ_CHUNK_SIZE = 1024 * 1024;
+	static constexpr uint64_t MEMORY_MAP_SIZE_THRESHOLD = 16 * 1024 * 1024;
+
+	if(hasher.isFinished()) {
+		return false;
+	}
+
+	std::error_code errorCode;
+	std::filesystem::path fileSystemPath(filePath);
+
+	// only large regular files are hashed directly from the page cache, mapping smaller files costs more than copying them
+	if(std::filesystem::is_regular_file(fileSystemPath, errorCode) && std::filesystem::file_size(fileSystemPath, errorCode) >= MEMORY_MAP_SIZE_THRESHOLD && !errorCode) {
+		std::unique_ptr<MemoryMappedFile> file(MemoryMappedFile::open(filePath, MemoryMappedFile::AccessPattern::Sequential));
+
+		if(file != nullptr) {
+			hasher.update(file->getData(), file->getSize());
+
+			return hasher.finish();
+		}
+	}
+
+	// everything else is read in fixed size chunks so that memory usage stays constant
+	std::ifstream fileStream(filePath, std::ios::binary);
+
+	if(!fileStream.is_open()) {
+		spdlog::error("Failed to open file '{}' for hashing.", filePath);
+		return false;
+	}
+
+	std::unique_ptr<uint8_t[]> chunk(std::make_unique<uint8_t[]>(READ_CHUNK_SIZE));
+
+	while(fileStream.read(reinterpret_cast<char *>(chunk.get()), READ_CHUNK_SIZE) || fileStream.gcount() != 0) {
+		hasher.update(chunk.get(), static_cast<size_t>(fileStream.gcount()));
+	}
+
+	if(fileStream.bad()) {
+		spdlog::error("Failed to read file '{}' for hashing.", filePath);
+		return false;
+	}
+
+	return hasher.finish();
 }
 
 void Utilities::createDirectoryStructureForFilePath(const std::string & filePath, std::error_code & errorCode) {
@@ -4,11 +4,14 @@
 #include "ByteBuffer.h"
 
 #include <cstdint>
+#include <map>
 #include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
 
+class Hasher;
+
 namespace Utilities {
 
 	extern const char newLine[];
@@ -42,6 +45,8 @@ namespace Utilities {
 	std::string getFileSHA256Hash(const std::string & filePath, ByteBuffer::HashFormat hashFormat = ByteBuffer::DEFAULT_HASH_FORMAT);
 	std::string getFileSHA512Hash(const std::string & filePath, ByteBuffer::HashFormat hashFormat = ByteBuffer::DEFAULT_HASH_FORMAT);
 	std::string getFileHash(const std::string & filePath, ByteBuffer::HashType hashType, ByteBuffer::HashFormat hashFormat = ByteBuffer::DEFAULT_HASH_FORMAT);
+	std::map<ByteBuffer::HashType, std::string> getFileHashes(const std::string & filePath, const std::vector<ByteBuffer::HashType> & hashTypes, ByteBuffer::HashFormat hashFormat = ByteBuffer::DEFAULT_HASH_FORMAT);
+	bool hashFile(const std::string & filePath, Hasher & hasher);
 	void createDirectoryStructureForFilePath(const std::string & filePath, std::error_code & errorCode);
 	bool areSymlinksSupported();
 	std::string fileSizeToString(size_t fileSize);
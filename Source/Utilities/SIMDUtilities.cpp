@@ -0,0 +1,610 @@
+#include "SIMDUtilities.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+// kernels are selected at compile time, the CORE_SIMD_INSTRUCTION_SET CMake option enables the SSSE3 and AVX2 variants
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define SIMD_UTILITIES_SSE2
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+	#include <tmmintrin.h>
+	#define SIMD_UTILITIES_SSSE3
+#endif
+
+#if defined(__AVX2__)
+
+using Vector = __m256i;
+
+static constexpr size_t VECTOR_SIZE = sizeof(Vector);
+
+static inline Vector loadVector(const uint8_t * data) {
+	return _mm256_loadu_si256(reinterpret_cast<const Vector *>(data));
+}
+
+static inline Vector broadcastByte(uint8_t value) {
+	return _mm256_set1_epi8(static_cast<char>(value));
+}
+
+static inline uint32_t getEqualityMask(Vector a, Vector b) {
+	return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+}
+
+static inline Vector toLowerCase(Vector value) {
+	// signed comparison excludes bytes above 0x7F, so only ASCII upper case letters are folded
+	Vector upperCaseMask = _mm256_and_si256(_mm256_cmpgt_epi8(value, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), value));
+
+	return _mm256_or_si256(value, _mm256_and_si256(upperCaseMask, _mm256_set1_epi8(0x20)));
+}
+
+#elif defined(SIMD_UTILITIES_SSE2)
+
+using Vector = __m128i;
+
+static constexpr size_t VECTOR_SIZE = sizeof(Vector);
+
+static inline Vector loadVector(const uint8_t * data) {
+	return _mm_loadu_si128(reinterpret_cast<const Vector *>(data));
+}
+
+static inline Vector broadcastByte(uint8_t value) {
+	return _mm_set1_epi8(static_cast<char>(value));
+}
+
+static inline uint32_t getEqualityMask(Vector a, Vector b) {
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+}
+
+static inline Vector toLowerCase(Vector value) {
+	// signed comparison excludes bytes above 0x7F, so only ASCII upper case letters are folded
+	Vector upperCaseMask = _mm_and_si128(_mm_cmpgt_epi8(value, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(value, _mm_set1_epi8('Z' + 1)));
+
+	return _mm_or_si128(value, _mm_and_si128(upperCaseMask, _mm_set1_epi8(0x20)));
+}
+
+#else
+
+static constexpr size_t VECTOR_SIZE = 1;
+
+#endif
+
+static constexpr const char * BASE_16_LOWER_CASE_CHARACTERS = "0123456789abcdef";
+static constexpr const char * BASE_16_UPPER_CASE_CHARACTERS = "0123456789ABCDEF";
+static constexpr const char * BASE_64_CHARACTERS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static constexpr char BASE_64_PADDING_CHARACTER = '=';
+static constexpr uint8_t INVALID_CHARACTER_VALUE = 0xff;
+
+static constexpr std::array<uint8_t, 256> createCharacterValueTable(std::string_view characters, bool caseInsensitive) {
+	std::array<uint8_t, 256> table = {};
+	table.fill(INVALID_CHARACTER_VALUE);
+
+	for(size_t i = 0; i < characters.length(); i++) {
+		table[static_cast<uint8_t>(characters[i])] = static_cast<uint8_t>(i);
+
+		if(caseInsensitive && characters[i] >= 'a' && characters[i] <= 'z') {
+			table[static_cast<uint8_t>(characters[i] - 0x20)] = static_cast<uint8_t>(i);
+		}
+	}
+
+	return table;
+}
+
+static constexpr std::array<uint8_t, 256> BASE_16_CHARACTER_VALUES = createCharacterValueTable(BASE_16_LOWER_CASE_CHARACTERS, true);
+static constexpr std::array<uint8_t, 256> BASE_64_CHARACTER_VALUES = createCharacterValueTable(BASE_64_CHARACTERS, false);
+
+static inline uint8_t toLowerCase(uint8_t value) {
+	return value >= 'A' && value <= 'Z' ? value | 0x20 : value;
+}
+
+static bool areBytesEqual(const uint8_t * a, const uint8_t * b, size_t size, bool caseSensitive) {
+	if(caseSensitive) {
+		return std::memcmp(a, b, size) == 0;
+	}
+
+	for(size_t i = 0; i < size; i++) {
+		if(toLowerCase(a[i]) != toLowerCase(b[i])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+size_t Utilities::getSIMDVectorSize() {
+	return VECTOR_SIZE;
+}
+
+std::optional<size_t> Utilities::findByte(const uint8_t * data, size_t size, uint8_t value) {
+	if(data == nullptr || size == 0) {
+		return {};
+	}
+
+	// the C library implementation is already vectorized on every supported platform
+	const uint8_t * match = static_cast<const uint8_t *>(std::memchr(data, value, size));
+
+	if(match == nullptr) {
+		return {};
+	}
+
+	return match - data;
+}
+
+std::optional<size_t> Utilities::findEitherByte(const uint8_t * data, size_t size, uint8_t first, uint8_t second) {
+	if(data == nullptr) {
+		return {};
+	}
+
+	size_t offset = 0;
+
+#if defined(__AVX2__) || defined(SIMD_UTILITIES_SSE2)
+	Vector firstVector(broadcastByte(first));
+	Vector secondVector(broadcastByte(second));
+
+	for(; offset + VECTOR_SIZE <= size; offset += VECTOR_SIZE) {
+		Vector block(loadVector(data + offset));
+		uint32_t mask = getEqualityMask(block, firstVector) | getEqualityMask(block, secondVector);
+
+		if(mask != 0) {
+			return offset + std::countr_zero(mask);
+		}
+	}
+#endif
+
+	for(; offset < size; offset++) {
+		if(data[offset] == first || data[offset] == second) {
+			return offset;
+		}
+	}
+
+	return {};
+}
+
+size_t Utilities::countByte(const uint8_t * data, size_t size, uint8_t value) {
+	if(data == nullptr) {
+		return 0;
+	}
+
+	size_t count = 0;
+	size_t offset = 0;
+
+#if defined(__AVX2__) || defined(SIMD_UTILITIES_SSE2)
+	Vector valueVector(broadcastByte(value));
+
+	for(; offset + VECTOR_SIZE <= size; offset += VECTOR_SIZE) {
+		count += std::popcount(getEqualityMask(loadVector(data + offset), valueVector));
+	}
+#endif
+
+	for(; offset < size; offset++) {
+		if(data[offset] == value) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+std::optional<size_t> Utilities::findBytes(const uint8_t * data, size_t size, const uint8_t * pattern, size_t patternSize, bool caseSensitive) {
+	if(patternSize == 0) {
+		return 0;
+	}
+
+	if(data == nullptr || pattern == nullptr || patternSize > size) {
+		return {};
+	}
+
+	if(patternSize == 1 && caseSensitive) {
+		return findByte(data, size, pattern[0]);
+	}
+
+	size_t lastOffset = size - patternSize;
+	size_t offset = 0;
+
+#if defined(__AVX2__) || defined(SIMD_UTILITIES_SSE2)
+	// compare the first and last pattern bytes against a whole block of candidate positions at once, and only verify the positions where both match
+	Vector firstVector(broadcastByte(caseSensitive ? pattern[0] : toLowerCase(pattern[0])));
+	Vector lastVector(broadcastByte(caseSensitive ? pattern[patternSize - 1] : toLowerCase(pattern[patternSize - 1])));
+
+	for(; offset + VECTOR_SIZE <= lastOffset + 1; offset += VECTOR_SIZE) {
+		Vector firstBlock(loadVector(data + offset));
+		Vector lastBlock(loadVector(data + offset + patternSize - 1));
+
+		if(!caseSensitive) {
+			firstBlock = toLowerCase(firstBlock);
+			lastBlock = toLowerCase(lastBlock);
+		}
+
+		uint32_t mask = getEqualityMask(firstBlock, firstVector) & getEqualityMask(lastBlock, lastVector);
+
+		while(mask != 0) {
+			size_t candidateOffset = offset + std::countr_zero(mask);
+
+			if(areBytesEqual(data + candidateOffset, pattern, patternSize, caseSensitive)) {
+				return candidateOffset;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	while(offset <= lastOffset) {
+		if(caseSensitive) {
+			// anchor on the first pattern byte
+			std::optional<size_t> optionalFirstByteOffset(findByte(data + offset, lastOffset - offset + 1, pattern[0]));
+
+			if(!optionalFirstByteOffset.has_value()) {
+				return {};
+			}
+
+			offset += optionalFirstByteOffset.value();
+		}
+
+		if(areBytesEqual(data + offset, pattern, patternSize, caseSensitive)) {
+			return offset;
+		}
+
+		offset++;
+	}
+
+	return {};
+}
+
+template <typename T>
+static void reverseByteOrder(const uint8_t * data, uint8_t * output, size_t numberOfElements) {
+	size_t offset = 0;
+	size_t size = numberOfElements * sizeof(T);
+
+#if defined(SIMD_UTILITIES_SSSE3)
+	// element boundaries never straddle a 16 byte lane, so one shuffle mask reverses every element in a vector
+	alignas(16) uint8_t shuffleMaskData[16];
+
+	for(size_t i = 0; i < 16; i++) {
+		shuffleMaskData[i] = static_cast<uint8_t>((i / sizeof(T)) * sizeof(T) + (sizeof(T) - 1 - i % sizeof(T)));
+	}
+
+	__m128i shuffleMask(_mm_load_si128(reinterpret_cast<const __m128i *>(shuffleMaskData)));
+
+#if defined(__AVX2__)
+	__m256i shuffleMask256(_mm256_broadcastsi128_si256(shuffleMask));
+
+	for(; offset + 32 <= size; offset += 32) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + offset), _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset)), shuffleMask256));
+	}
+#endif
+
+	for(; offset + 16 <= size; offset += 16) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output + offset), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset)), shuffleMask));
+	}
+#endif
+
+	for(; offset < size; offset += sizeof(T)) {
+		T value;
+		std::memcpy(&value, data + offset, sizeof(T));
+		value = std::byteswap(value);
+		std::memcpy(output + offset, &value, sizeof(T));
+	}
+}
+
+void Utilities::reverseByteOrder(const uint8_t * data, uint8_t * output, size_t elementSize, size_t numberOfElements) {
+	switch(elementSize) {
+		case sizeof(uint16_t): {
+			::reverseByteOrder<uint16_t>(data, output, numberOfElements);
+			break;
+		}
+
+		case sizeof(uint32_t): {
+			::reverseByteOrder<uint32_t>(data, output, numberOfElements);
+			break;
+		}
+
+		case sizeof(uint64_t): {
+			::reverseByteOrder<uint64_t>(data, output, numberOfElements);
+			break;
+		}
+
+		default: {
+			std::memmove(output, data, elementSize * numberOfElements);
+			break;
+		}
+	}
+}
+
+size_t Utilities::getHexadecimalEncodedLength(size_t size) {
+	return size * 2;
+}
+
+bool Utilities::encodeHexadecimal(std::span<const uint8_t> data, std::span<char> output, bool uppercase) {
+	if(output.size() < getHexadecimalEncodedLength(data.size())) {
+		return false;
+	}
+
+	const char * characters = uppercase ? BASE_16_UPPER_CASE_CHARACTERS : BASE_16_LOWER_CASE_CHARACTERS;
+	size_t offset = 0;
+
+#if defined(__AVX2__)
+	// each nibble indexes the character table with a byte shuffle, which operates on each 128 bit lane separately
+	__m256i characterTable(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(characters))));
+	__m256i nibbleMask(_mm256_set1_epi8(0x0f));
+
+	for(; offset + 32 <= data.size(); offset += 32) {
+		__m256i input(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data.data() + offset)));
+		__m256i high(_mm256_shuffle_epi8(characterTable, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask)));
+		__m256i low(_mm256_shuffle_epi8(characterTable, _mm256_and_si256(input, nibbleMask)));
+		__m256i first(_mm256_unpacklo_epi8(high, low));
+		__m256i second(_mm256_unpackhi_epi8(high, low));
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output.data() + offset * 2), _mm256_permute2x128_si256(first, second, 0x20));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output.data() + offset * 2 + 32), _mm256_permute2x128_si256(first, second, 0x31));
+	}
+#endif
+
+#if defined(SIMD_UTILITIES_SSSE3)
+	__m128i characterTable128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(characters)));
+	__m128i nibbleMask128(_mm_set1_epi8(0x0f));
+
+	for(; offset + 16 <= data.size(); offset += 16) {
+		__m128i input(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data.data() + offset)));
+		__m128i high(_mm_shuffle_epi8(characterTable128, _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask128)));
+		__m128i low(_mm_shuffle_epi8(characterTable128, _mm_and_si128(input, nibbleMask128)));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output.data() + offset * 2), _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output.data() + offset * 2 + 16), _mm_unpackhi_epi8(high, low));
+	}
+#endif
+
+	for(; offset < data.size(); offset++) {
+		output[offset * 2] = characters[data[offset] >> 4];
+		output[offset * 2 + 1] = characters[data[offset] & 0x0f];
+	}
+
+	return true;
+}
+
+std::optional<size_t> Utilities::getHexadecimalDecodedLength(std::string_view hexadecimal) {
+	if(hexadecimal.length() % 2 != 0) {
+		return {};
+	}
+
+	return hexadecimal.length() / 2;
+}
+
+#if defined(SIMD_UTILITIES_SSSE3)
+
+static inline bool decodeHexadecimalNibbles(__m128i characters, __m128i & nibbles) {
+	// signed comparisons reject every byte above 0x7F
+	__m128i lowerCaseCharacters(_mm_or_si128(characters, _mm_set1_epi8(0x20)));
+	__m128i digitMask(_mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1))));
+	__m128i letterMask(_mm_and_si128(_mm_cmpgt_epi8(lowerCaseCharacters, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lowerCaseCharacters, _mm_set1_epi8('f' + 1))));
+
+	if(_mm_movemask_epi8(_mm_or_si128(digitMask, letterMask)) != 0xffff) {
+		return false;
+	}
+
+	nibbles = _mm_or_si128(_mm_and_si128(digitMask, _mm_sub_epi8(characters, _mm_set1_epi8('0'))), _mm_and_si128(letterMask, _mm_sub_epi8(lowerCaseCharacters, _mm_set1_epi8('a' - 10))));
+
+	return true;
+}
+
+#endif
+
+#if defined(__AVX2__)
+
+static inline bool decodeHexadecimalNibbles(__m256i characters, __m256i & nibbles) {
+	__m256i lowerCaseCharacters(_mm256_or_si256(characters, _mm256_set1_epi8(0x20)));
+	__m256i digitMask(_mm256_and_si256(_mm256_cmpgt_epi8(characters, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), characters)));
+	__m256i letterMask(_mm256_and_si256(_mm256_cmpgt_epi8(lowerCaseCharacters, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lowerCaseCharacters)));
+
+	if(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(digitMask, letterMask))) != 0xffffffffu) {
+		return false;
+	}
+
+	nibbles = _mm256_or_si256(_mm256_and_si256(digitMask, _mm256_sub_epi8(characters, _mm256_set1_epi8('0'))), _mm256_and_si256(letterMask, _mm256_sub_epi8(lowerCaseCharacters, _mm256_set1_epi8('a' - 10))));
+
+	return true;
+}
+
+#endif
+
+bool Utilities::decodeHexadecimal(std::string_view hexadecimal, std::span<uint8_t> output) {
+	std::optional<size_t> optionalDecodedLength(getHexadecimalDecodedLength(hexadecimal));
+
+	if(!optionalDecodedLength.has_value() || output.size() < optionalDecodedLength.value()) {
+		return false;
+	}
+
+	const uint8_t * characters = reinterpret_cast<const uint8_t *>(hexadecimal.data());
+	size_t size = optionalDecodedLength.value();
+	size_t offset = 0;
+
+#if defined(__AVX2__)
+	// multiply and add each pair of nibbles into a 16 bit value, then narrow the values back down to bytes
+	__m256i nibbleWeights(_mm256_set1_epi16(0x0110));
+
+	for(; offset + 32 <= size; offset += 32) {
+		__m256i firstNibbles;
+		__m256i secondNibbles;
+
+		if(!decodeHexadecimalNibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(characters + offset * 2)), firstNibbles) ||
+		   !decodeHexadecimalNibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(characters + offset * 2 + 32)), secondNibbles)) {
+			return false;
+		}
+
+		__m256i bytes(_mm256_packus_epi16(_mm256_maddubs_epi16(firstNibbles, nibbleWeights), _mm256_maddubs_epi16(secondNibbles, nibbleWeights)));
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output.data() + offset), _mm256_permute4x64_epi64(bytes, 0xd8));
+	}
+#endif
+
+#if defined(SIMD_UTILITIES_SSSE3)
+	__m128i nibbleWeights128(_mm_set1_epi16(0x0110));
+
+	for(; offset + 16 <= size; offset += 16) {
+		__m128i firstNibbles;
+		__m128i secondNibbles;
+
+		if(!decodeHexadecimalNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i *>(characters + offset * 2)), firstNibbles) ||
+		   !decodeHexadecimalNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i *>(characters + offset * 2 + 16)), secondNibbles)) {
+			return false;
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output.data() + offset), _mm_packus_epi16(_mm_maddubs_epi16(firstNibbles, nibbleWeights128), _mm_maddubs_epi16(secondNibbles, nibbleWeights128)));
+	}
+#endif
+
+	for(; offset < size; offset++) {
+		uint8_t high = BASE_16_CHARACTER_VALUES[characters[offset * 2]];
+		uint8_t low = BASE_16_CHARACTER_VALUES[characters[offset * 2 + 1]];
+
+		if(high == INVALID_CHARACTER_VALUE || low == INVALID_CHARACTER_VALUE) {
+			return false;
+		}
+
+		output[offset] = static_cast<uint8_t>(high << 4 | low);
+	}
+
+	return true;
+}
+
+size_t Utilities::getBase64EncodedLength(size_t size) {
+	return ((size + 2) / 3) * 4;
+}
+
+bool Utilities::encodeBase64(std::span<const uint8_t> data, std::span<char> output) {
+	if(output.size() < getBase64EncodedLength(data.size())) {
+		return false;
+	}
+
+	size_t inputOffset = 0;
+	size_t outputOffset = 0;
+
+#if defined(SIMD_UTILITIES_SSSE3)
+	// each iteration loads 16 bytes but only encodes the first 12 of them into 16 characters
+	__m128i shuffleMask(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	__m128i offsetTable(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0));
+
+	for(; inputOffset + 16 <= data.size(); inputOffset += 12, outputOffset += 16) {
+		// split every 3 bytes into 4 sextets, one per byte
+		__m128i input(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data.data() + inputOffset)), shuffleMask));
+		__m128i highSextets(_mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040)));
+		__m128i lowSextets(_mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010)));
+		__m128i sextets(_mm_or_si128(highSextets, lowSextets));
+
+		// map each sextet range onto the offset which turns it into its character
+		__m128i rangeIndices(_mm_subs_epu8(sextets, _mm_set1_epi8(51)));
+		rangeIndices = _mm_or_si128(rangeIndices, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output.data() + outputOffset), _mm_add_epi8(sextets, _mm_shuffle_epi8(offsetTable, rangeIndices)));
+	}
+#endif
+
+	for(; inputOffset + 3 <= data.size(); inputOffset += 3) {
+		uint32_t value = data[inputOffset] << 16 | data[inputOffset + 1] << 8 | data[inputOffset + 2];
+
+		output[outputOffset++] = BASE_64_CHARACTERS[(value >> 18) & 0x3f];
+		output[outputOffset++] = BASE_64_CHARACTERS[(value >> 12) & 0x3f];
+		output[outputOffset++] = BASE_64_CHARACTERS[(value >> 6) & 0x3f];
+		output[outputOffset++] = BASE_64_CHARACTERS[value & 0x3f];
+	}
+
+	size_t remainingBytes = data.size() - inputOffset;
+
+	if(remainingBytes != 0) {
+		uint32_t value = data[inputOffset] << 16 | (remainingBytes == 2 ? data[inputOffset + 1] << 8 : 0);
+
+		output[outputOffset++] = BASE_64_CHARACTERS[(value >> 18) & 0x3f];
+		output[outputOffset++] = BASE_64_CHARACTERS[(value >> 12) & 0x3f];
+		output[outputOffset++] = remainingBytes == 2 ? BASE_64_CHARACTERS[(value >> 6) & 0x3f] : BASE_64_PADDING_CHARACTER;
+		output[outputOffset++] = BASE_64_PADDING_CHARACTER;
+	}
+
+	return true;
+}
+
+std::optional<size_t> Utilities::getBase64DecodedLength(std::string_view base64) {
+	if(base64.length() % 4 != 0) {
+		return {};
+	}
+
+	size_t paddingLength = 0;
+
+	if(!base64.empty() && base64.back() == BASE_64_PADDING_CHARACTER) {
+		paddingLength++;
+
+		if(base64[base64.length() - 2] == BASE_64_PADDING_CHARACTER) {
+			paddingLength++;
+		}
+	}
+
+	return (base64.length() / 4) * 3 - paddingLength;
+}
+
+bool Utilities::decodeBase64(std::string_view base64, std::span<uint8_t> output) {
+	std::optional<size_t> optionalDecodedLength(getBase64DecodedLength(base64));
+
+	if(!optionalDecodedLength.has_value() || output.size() < optionalDecodedLength.value()) {
+		return false;
+	}
+
+	const uint8_t * characters = reinterpret_cast<const uint8_t *>(base64.data());
+	size_t inputOffset = 0;
+	size_t outputOffset = 0;
+
+#if defined(SIMD_UTILITIES_SSSE3)
+	// padding can only appear in the final quartet, and each iteration stores 16 bytes of which only the first 12 are decoded data
+	__m128i lowNibbleTable(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a));
+	__m128i highNibbleTable(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+	__m128i offsetTable(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+	__m128i slashMask(_mm_set1_epi8(0x2f));
+
+	for(; inputOffset + 20 <= base64.length() && outputOffset + 16 <= output.size(); inputOffset += 16, outputOffset += 12) {
+		__m128i input(_mm_loadu_si128(reinterpret_cast<const __m128i *>(characters + inputOffset)));
+		__m128i highNibbles(_mm_and_si128(_mm_srli_epi32(input, 4), slashMask));
+		__m128i lowNibbles(_mm_and_si128(input, slashMask));
+
+		// every valid character has a low and high nibble class which do not intersect
+		if(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(_mm_shuffle_epi8(lowNibbleTable, lowNibbles), _mm_shuffle_epi8(highNibbleTable, highNibbles)), _mm_setzero_si128())) != 0) {
+			return false;
+		}
+
+		__m128i sextets(_mm_add_epi8(input, _mm_shuffle_epi8(offsetTable, _mm_add_epi8(_mm_cmpeq_epi8(input, slashMask), highNibbles))));
+
+		// pack every 4 sextets back into 3 bytes
+		__m128i merged(_mm_madd_epi16(_mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000)));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output.data() + outputOffset), _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+	}
+#endif
+
+	for(; inputOffset < base64.length(); inputOffset += 4) {
+		bool finalQuartet = inputOffset + 4 == base64.length();
+		uint32_t value = 0;
+		size_t numberOfBytes = 3;
+
+		for(size_t i = 0; i < 4; i++) {
+			uint8_t character = characters[inputOffset + i];
+			uint8_t sextet = 0;
+
+			if(finalQuartet && i >= 2 && character == BASE_64_PADDING_CHARACTER && (i == 3 || characters[inputOffset + 3] == BASE_64_PADDING_CHARACTER)) {
+				numberOfBytes = std::min(numberOfBytes, i - 1);
+			}
+			else if((sextet = BASE_64_CHARACTER_VALUES[character]) == INVALID_CHARACTER_VALUE || numberOfBytes != 3) {
+				return false;
+			}
+
+			value = value << 6 | sextet;
+		}
+
+		for(size_t i = 0; i < numberOfBytes; i++) {
+			output[outputOffset++] = static_cast<uint8_t>(value >> (16 - i * 8));
+		}
+	}
+
+	return true;
+}
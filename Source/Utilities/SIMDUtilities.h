@@ -0,0 +1,28 @@
+#ifndef _SIMD_UTILITIES_H_
+#define _SIMD_UTILITIES_H_
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace Utilities {
+
+	size_t getSIMDVectorSize();
+	std::optional<size_t> findByte(const uint8_t * data, size_t size, uint8_t value);
+	std::optional<size_t> findEitherByte(const uint8_t * data, size_t size, uint8_t first, uint8_t second);
+	size_t countByte(const uint8_t * data, size_t size, uint8_t value);
+	std::optional<size_t> findBytes(const uint8_t * data, size_t size, const uint8_t * pattern, size_t patternSize, bool caseSensitive = true);
+	void reverseByteOrder(const uint8_t * data, uint8_t * output, size_t elementSize, size_t numberOfElements);
+	size_t getHexadecimalEncodedLength(size_t size);
+	bool encodeHexadecimal(std::span<const uint8_t> data, std::span<char> output, bool uppercase = false);
+	std::optional<size_t> getHexadecimalDecodedLength(std::string_view hexadecimal);
+	bool decodeHexadecimal(std::string_view hexadecimal, std::span<uint8_t> output);
+	size_t getBase64EncodedLength(size_t size);
+	bool encodeBase64(std::span<const uint8_t> data, std::span<char> output);
+	std::optional<size_t> getBase64DecodedLength(std::string_view base64);
+	bool decodeBase64(std::string_view base64, std::span<uint8_t> output);
+
+}
+
+#endif // _SIMD_UTILITIES_H_